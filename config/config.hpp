@@ -29,6 +29,12 @@
 #define MFEM_HAVE_GCC_PRAGMA_DIAGNOSTIC
 #endif
 
+// Element-colored OpenMP assembly of BilinearForm and LinearForm requires the
+// OpenMP backend and thread-safe integrators.
+#if defined(MFEM_USE_OPENMP) && defined(MFEM_THREAD_SAFE)
+#define MFEM_USE_THREADED_ASSEMBLY
+#endif
+
 // Windows specific options
 #ifdef _WIN32
 // Macro needed to get defines like M_PI from <cmath>. (Visual Studio C++ only?)
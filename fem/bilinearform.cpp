@@ -13,6 +13,7 @@
 
 #include "fem.hpp"
 #include "../general/device.hpp"
+#include "../general/profiler.hpp"
 #include <cmath>
 
 namespace mfem
@@ -22,13 +23,26 @@ void BilinearForm::AllocMat()
 {
    if (static_cond) { return; }
 
-   if (precompute_sparsity == 0 || fes->GetVDim() > 1)
+#ifdef MFEM_USE_THREADED_ASSEMBLY
+   // The element-colored assembly requires a preallocated sparsity pattern.
+   const bool precompute = (precompute_sparsity != 0 || fbfi.Size() == 0);
+#else
+   const bool precompute = (precompute_sparsity != 0);
+#endif
+   if (!precompute || fes->GetVDim() > 1)
    {
       mat = new SparseMatrix(height);
       return;
    }
 
-   const Table &elem_dof = fes->GetElementToDofTable();
+   // The element-to-dof table of ND and RT spaces encodes the orientation of
+   // the dofs in the sign of their indices, which is not needed here.
+   Table elem_dof(fes->GetElementToDofTable());
+   int *elem_dof_j = elem_dof.GetJ();
+   for (int k = 0; k < elem_dof.Size_of_connections(); k++)
+   {
+      if (elem_dof_j[k] < 0) { elem_dof_j[k] = -1 - elem_dof_j[k]; }
+   }
    Table dof_dof;
 
    if (fbfi.Size() > 0)
@@ -132,8 +146,7 @@ void BilinearForm::SetAssemblyLevel(AssemblyLevel assembly_level)
          ext = new PABilinearFormExtension(this);
          break;
       case AssemblyLevel::NONE:
-         mfem_error("Matrix-free action not supported yet... stay tuned!");
-         // ext = new MFBilinearFormExtension(this);
+         ext = new MFBilinearFormExtension(this);
          break;
       default:
          mfem_error("Unknown assembly level");
@@ -373,8 +386,87 @@ void BilinearForm::AssembleBdrElementMatrix(
    }
 }
 
+#ifdef MFEM_USE_THREADED_ASSEMBLY
+// Add the element matrix @a elmat to the finalized matrix @a mat, which must
+// already contain all entries. Unlike SparseMatrix::AddSubMatrix(), this does
+// not use the "current row" of @a mat, so it can be called concurrently for
+// elements that do not share any vdofs.
+static void AddElementMatrixFinalized(SparseMatrix &mat,
+                                      const Array<int> &vdofs,
+                                      const DenseMatrix &elmat,
+                                      int skip_zeros)
+{
+   for (int i = 0; i < vdofs.Size(); i++)
+   {
+      int gi = vdofs[i], s = 1;
+      if (gi < 0) { gi = -1-gi; s = -1; }
+      for (int j = 0; j < vdofs.Size(); j++)
+      {
+         int gj = vdofs[j], t = s;
+         if (gj < 0) { gj = -1-gj; t = -s; }
+         const double a = elmat(i, j);
+         if (skip_zeros && a == 0.0 && elmat(j, i) == 0.0) { continue; }
+         mat._Add_(gi, gj, (t < 0) ? -a : a);
+      }
+   }
+}
+
+// Assemble the domain integrators in parallel: the elements of one color do
+// not share any vdofs, see Mesh::GetVertexElementColoring(), so they can be
+// added to the rows of the finalized matrix @a mat without locks. Unless the
+// element matrices are precomputed, all the integrators must support threaded
+// assembly, see BilinearFormIntegrator::SupportsThreadedAssembly().
+static void ColoredAssembleDomain(FiniteElementSpace &fes,
+                                  Array<BilinearFormIntegrator*> &dbfi,
+                                  DenseTensor *element_matrices,
+                                  SparseMatrix &mat, int skip_zeros)
+{
+   Array<int> colors;
+   const int num_colors = fes.GetMesh()->GetVertexElementColoring(colors);
+   Table color_el;
+   Transpose(colors, color_el, num_colors);
+
+   #pragma omp parallel
+   {
+      Array<int> vdofs;
+      DenseMatrix elmat, tmp;
+      IsoparametricTransformation eltrans;
+      for (int c = 0; c < num_colors; c++)
+      {
+         const int *el = color_el.GetRow(c);
+         const int num_el = color_el.RowSize(c);
+         #pragma omp for schedule(static)
+         for (int k = 0; k < num_el; k++)
+         {
+            const int i = el[k];
+            fes.GetElementVDofs(i, vdofs);
+            if (element_matrices)
+            {
+               elmat.UseExternalData((*element_matrices)(i).Data(),
+                                     vdofs.Size(), vdofs.Size());
+            }
+            else
+            {
+               const FiniteElement &fe = *fes.GetFE(i);
+               fes.GetElementTransformation(i, &eltrans);
+               dbfi[0]->AssembleElementMatrix(fe, eltrans, elmat);
+               for (int j = 1; j < dbfi.Size(); j++)
+               {
+                  dbfi[j]->AssembleElementMatrix(fe, eltrans, tmp);
+                  elmat += tmp;
+               }
+            }
+            AddElementMatrixFinalized(mat, vdofs, elmat, skip_zeros);
+         }
+      }
+      if (element_matrices) { elmat.ClearExternalData(); }
+   }
+}
+#endif
+
 void BilinearForm::Assemble(int skip_zeros)
 {
+   MFEM_PERF_SCOPE("BilinearForm::Assemble");
    if (ext)
    {
       ext->Assemble();
@@ -399,7 +491,22 @@ void BilinearForm::Assemble(int skip_zeros)
    }
 #endif
 
-   if (dbfi.Size())
+#ifdef MFEM_USE_THREADED_ASSEMBLY
+   bool colored = dbfi.Size() && mat && mat->Finalized() &&
+                  !static_cond && !hybridization;
+   for (int k = 0; k < dbfi.Size() && !element_matrices; k++)
+   {
+      colored = colored && dbfi[k]->SupportsThreadedAssembly();
+   }
+   if (colored)
+   {
+      ColoredAssembleDomain(*fes, dbfi, element_matrices, *mat, skip_zeros);
+   }
+#else
+   const bool colored = false;
+#endif
+
+   if (dbfi.Size() && !colored)
    {
       for (int i = 0; i < fes -> GetNE(); i++)
       {
@@ -619,6 +726,17 @@ void BilinearForm::ConformingAssemble()
    width = mat->Width();
 }
 
+void BilinearForm::ReassembleCoefficients(int skip_zeros)
+{
+   if (ext)
+   {
+      ext->ReassembleCoefficients();
+      return;
+   }
+   Update();
+   Assemble(skip_zeros);
+}
+
 void BilinearForm::AssembleDiagonal(Vector &diag) const
 {
    if (ext)
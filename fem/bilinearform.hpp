@@ -320,6 +320,15 @@ public:
    /// Assembles the form i.e. sums over all domain/bdr integrators.
    void Assemble(int skip_zeros = 1);
 
+   /** @brief Reassemble the form after a change in the values of the
+       coefficients of its integrators. */
+   /** The mesh and the FE space must be unchanged since the last call to
+       Assemble(). With partial assembly, the coefficient-independent
+       quadrature data of the integrators is reused, see
+       BilinearFormIntegrator::ReassemblePA(). With the other assembly levels,
+       this is equivalent to calling Update() and Assemble(). */
+   void ReassembleCoefficients(int skip_zeros = 1);
+
    /** @brief Assemble the diagonal of the bilinear form into diag
 
        For adaptively refined meshes, this returns P^T d_e, where d_e is the
@@ -44,6 +44,9 @@ public:
 
    virtual void Assemble() = 0;
 
+   /// Reassemble after a change in the values of the coefficients.
+   virtual void ReassembleCoefficients() { Assemble(); }
+
    virtual void AssembleDiagonal(Vector &diag) const
    {
       MFEM_ABORT("AssembleDiagonal not implemented for this assembly level!");
@@ -89,11 +92,16 @@ protected:
    const Operator *elem_restrict; // Not owned
    const Operator *int_face_restrict_lex; // Not owned
    const Operator *bdr_face_restrict_lex; // Not owned
+   /** Gather map of the element restriction used by the fused domain kernels,
+       see BilinearFormIntegrator::AddMultFusedPA(); NULL if the restriction is
+       applied separately. Not owned. */
+   const Array<int> *fused_gather_map;
 
 public:
    PABilinearFormExtension(BilinearForm*);
 
    void Assemble();
+   void ReassembleCoefficients();
    void AssembleDiagonal(Vector &diag) const;
    void FormSystemMatrix(const Array<int> &ess_tdof_list, OperatorHandle &A);
    void FormLinearSystem(const Array<int> &ess_tdof_list,
@@ -106,6 +114,7 @@ public:
 
 protected:
    void SetupRestrictionOperators(const L2FaceValues m);
+   void SetupFusedRestriction();
 };
 
 /// Data and methods for element-assembled bilinear forms
@@ -123,6 +132,7 @@ public:
    EABilinearFormExtension(BilinearForm *form);
 
    void Assemble();
+   void ReassembleCoefficients() { Assemble(); }
    void Mult(const Vector &x, Vector &y) const;
    void MultTranspose(const Vector &x, Vector &y) const;
 };
@@ -130,21 +140,26 @@ public:
 /// Data and methods for matrix-free bilinear forms
 class MFBilinearFormExtension : public BilinearFormExtension
 {
+protected:
+   const FiniteElementSpace *trialFes, *testFes; // Not owned
+   mutable Vector localX, localY;
+   const Operator *elem_restrict; // Not owned
+
 public:
-   MFBilinearFormExtension(BilinearForm *form)
-      : BilinearFormExtension(form) { }
+   MFBilinearFormExtension(BilinearForm *form);
 
-   /// TODO
-   void Assemble() {}
-   void FormSystemMatrix(const Array<int> &ess_tdof_list, OperatorHandle &A) {}
+   void Assemble();
+   void FormSystemMatrix(const Array<int> &ess_tdof_list, OperatorHandle &A);
    void FormLinearSystem(const Array<int> &ess_tdof_list,
                          Vector &x, Vector &b,
                          OperatorHandle &A, Vector &X, Vector &B,
-                         int copy_interior = 0) {}
-   void Mult(const Vector &x, Vector &y) const {}
-   void MultTranspose(const Vector &x, Vector &y) const {}
-   void Update() {}
-   ~MFBilinearFormExtension() {}
+                         int copy_interior = 0);
+   void Mult(const Vector &x, Vector &y) const;
+   void MultTranspose(const Vector &x, Vector &y) const;
+   void Update();
+
+protected:
+   void SetupRestrictionOperators();
 };
 
 /** @brief Class extending the MixedBilinearForm class to support the different
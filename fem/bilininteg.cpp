@@ -12,6 +12,7 @@
 // Implementation of Bilinear Form Integrators
 
 #include "fem.hpp"
+#include "bilininteg_mf.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -93,6 +94,53 @@ void BilinearFormIntegrator::AddMultTransposePA(const Vector &, Vector &) const
                "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AddMultFusedPA(const Array<int> &,
+                                            const Vector &, Vector &) const
+{
+   mfem_error ("BilinearFormIntegrator::AddMultFusedPA(...)\n"
+               "   is not implemented for this class.");
+}
+
+void BilinearFormIntegrator::AssembleMF(const FiniteElementSpace&)
+{
+   mfem_error ("BilinearFormIntegrator::AssembleMF(...)\n"
+               "   is not implemented for this class.");
+}
+
+void BilinearFormIntegrator::AddMultMF(const Vector &, Vector &) const
+{
+   mfem_error ("BilinearFormIntegrator::AddMultMF(...)\n"
+               "   is not implemented for this class.");
+}
+
+void BilinearFormIntegrator::AddMultTransposeMF(const Vector &, Vector &) const
+{
+   mfem_error ("BilinearFormIntegrator::AddMultTransposeMF(...)\n"
+               "   is not implemented for this class.");
+}
+
+namespace internal
+{
+
+void MFSetupNodes(const FiniteElementSpace &fes, const IntegrationRule &ir,
+                  Vector &nodes, const DofToQuad *&geom_maps)
+{
+   Mesh *mesh = fes.GetMesh();
+   mesh->EnsureNodes();
+   const GridFunction *mesh_nodes = mesh->GetNodes();
+   const FiniteElementSpace *nfes = mesh_nodes->FESpace();
+   MFEM_VERIFY(dynamic_cast<const TensorBasisElement*>(nfes->GetFE(0)),
+               "MF requires a tensor-product mesh nodal space!");
+   const ElementDofOrdering ordering = ElementDofOrdering::LEXICOGRAPHIC;
+   const Operator *R = nfes->GetElementRestriction(ordering);
+   nodes.SetSize(R->Height(), Device::GetMemoryType());
+   nodes.UseDevice(true);
+   R->Mult(*mesh_nodes, nodes);
+   geom_maps = &nfes->GetFE(0)->GetDofToQuad(ir, DofToQuad::TENSOR);
+}
+
+} // namespace internal
+
 void BilinearFormIntegrator::AssembleElementMatrix (
    const FiniteElement &el, ElementTransformation &Trans,
    DenseMatrix &elmat )
@@ -50,6 +50,15 @@ public:
    virtual void AssemblePA(const FiniteElementSpace &trial_fes,
                            const FiniteElementSpace &test_fes);
 
+   /** @brief Update the partial assembly data after a change in the values of
+       the coefficients. */
+   /** Derived classes can reuse the coefficient-independent (geometric) part
+       of the quadrature data computed for the same @a fes, so the mesh must not
+       have changed since the last call to AssemblePA(). The default
+       implementation calls AssemblePA(). */
+   virtual void ReassemblePA(const FiniteElementSpace &fes)
+   { AssemblePA(fes); }
+
    virtual void AssemblePAInteriorFaces(const FiniteElementSpace &fes);
 
    virtual void AssemblePABoundaryFaces(const FiniteElementSpace &fes);
@@ -78,6 +87,55 @@ public:
        called. */
    virtual void AddMultTransposePA(const Vector &x, Vector &y) const;
 
+   /// Method for partially assembled action fused with the element restriction.
+   /** Perform the action of integrator on the L-vector @a x and add the result
+       to the L-vector @a y. The element dofs are gathered from @a x and the
+       element contributions are scattered into @a y inside the element kernel
+       using @a gather_map, see ElementRestriction::GatherMap(), so that no
+       E-vectors are formed.
+
+       This method can be called only after the method AssemblePA() has been
+       called, and only if SupportsFusedPA() returns true. */
+   virtual void AddMultFusedPA(const Array<int> &gather_map,
+                               const Vector &x, Vector &y) const;
+
+   /// Return true if the integrator implements AddMultFusedPA().
+   virtual bool SupportsFusedPA() const { return false; }
+
+   /** @brief Returns true if AssembleElementMatrix() can be called for
+       different elements from several threads at the same time.
+
+       This requires the integrator to keep its work arrays local when MFEM is
+       built with MFEM_THREAD_SAFE. It is used by BilinearForm::Assemble() with
+       MFEM_USE_THREADED_ASSEMBLY, which falls back to a serial loop when any
+       domain integrator returns false. */
+   virtual bool SupportsThreadedAssembly() const { return false; }
+
+   /// Method defining matrix-free assembly.
+   /** The result of matrix-free setup is stored internally so that it can be
+       used later in the methods AddMultMF() and AddMultTransposeMF(). Unlike
+       AssemblePA(), no data is stored at the quadrature points: the geometric
+       factors are recomputed from the mesh nodes during each action. */
+   virtual void AssembleMF(const FiniteElementSpace &fes);
+
+   /// Method for matrix-free action.
+   /** Perform the action of integrator on the input @a x and add the result to
+       the output @a y. Both @a x and @a y are E-vectors, i.e. they represent
+       the element-wise discontinuous version of the FE space.
+
+       This method can be called only after the method AssembleMF() has been
+       called. */
+   virtual void AddMultMF(const Vector &x, Vector &y) const;
+
+   /// Method for matrix-free transposed action.
+   /** Perform the transpose action of integrator on the input @a x and add the
+       result to the output @a y. Both @a x and @a y are E-vectors, i.e. they
+       represent the element-wise discontinuous version of the FE space.
+
+       This method can be called only after the method AssembleMF() has been
+       called. */
+   virtual void AddMultTransposeMF(const Vector &x, Vector &y) const;
+
    /// Method defining element assembly.
    /** The result of the element assembly is added and stored in the @a emat
        Vector. */
@@ -1833,6 +1891,13 @@ private:
    const GeometricFactors *geom;  ///< Not owned
    int dim, ne, dofs1D, quad1D;
    Vector pa_data;
+   Vector pa_geom; ///< pa_data with a unit coefficient, see ReassemblePA()
+
+   // MF extension
+   const DofToQuad *mf_geom_maps;     ///< Not owned
+   const Array<double> *mf_weights;   ///< Not owned
+   Vector mf_nodes;
+   double mf_coeff;
 
 #ifdef MFEM_USE_CEED
    // CEED extension
@@ -1847,6 +1912,8 @@ public:
       MQ = NULL;
       maps = NULL;
       geom = NULL;
+      mf_geom_maps = NULL;
+      mf_weights = NULL;
 #ifdef MFEM_USE_CEED
       ceedDataPtr = NULL;
 #endif
@@ -1859,6 +1926,8 @@ public:
       MQ = NULL;
       maps = NULL;
       geom = NULL;
+      mf_geom_maps = NULL;
+      mf_weights = NULL;
 #ifdef MFEM_USE_CEED
       ceedDataPtr = NULL;
 #endif
@@ -1871,6 +1940,8 @@ public:
       Q = NULL;
       maps = NULL;
       geom = NULL;
+      mf_geom_maps = NULL;
+      mf_weights = NULL;
 #ifdef MFEM_USE_CEED
       ceedDataPtr = NULL;
 #endif
@@ -1895,6 +1966,8 @@ public:
                                        ElementTransformation &Trans,
                                        DenseMatrix &elmat);
 
+   virtual bool SupportsThreadedAssembly() const { return true; }
+
    /// Perform the local action of the BilinearFormIntegrator
    virtual void AssembleElementVector(const FiniteElement &el,
                                       ElementTransformation &Tr,
@@ -1913,12 +1986,26 @@ public:
 
    virtual void AssemblePA(const FiniteElementSpace &fes);
 
+   virtual void ReassemblePA(const FiniteElementSpace &fes);
+
    virtual void AssembleEA(const FiniteElementSpace &fes, Vector &emat);
 
    virtual void AssembleDiagonalPA(Vector &diag);
 
    virtual void AddMultPA(const Vector&, Vector&) const;
 
+   virtual void AddMultFusedPA(const Array<int> &gather_map,
+                               const Vector &x, Vector &y) const;
+
+   virtual bool SupportsFusedPA() const;
+
+   virtual void AssembleMF(const FiniteElementSpace &fes);
+
+   virtual void AddMultMF(const Vector&, Vector&) const;
+
+   virtual void AddMultTransposeMF(const Vector &x, Vector &y) const
+   { AddMultMF(x, y); }
+
    static const IntegrationRule &GetRule(const FiniteElement &trial_fe,
                                          const FiniteElement &test_fe);
 
@@ -1936,10 +2023,17 @@ protected:
    // PA extension
    const FiniteElementSpace *fespace;
    Vector pa_data;
+   Vector pa_geom; ///< pa_data with a unit coefficient, see ReassemblePA()
    const DofToQuad *maps;         ///< Not owned
    const GeometricFactors *geom;  ///< Not owned
    int dim, ne, nq, dofs1D, quad1D;
 
+   // MF extension
+   const DofToQuad *mf_geom_maps;     ///< Not owned
+   const Array<double> *mf_weights;   ///< Not owned
+   Vector mf_nodes;
+   double mf_coeff;
+
 #ifdef MFEM_USE_CEED
    // CEED extension
    CeedData* ceedDataPtr;
@@ -1952,6 +2046,8 @@ public:
       Q = NULL;
       maps = NULL;
       geom = NULL;
+      mf_geom_maps = NULL;
+      mf_weights = NULL;
 #ifdef MFEM_USE_CEED
       ceedDataPtr = NULL;
 #endif
@@ -1963,6 +2059,8 @@ public:
    {
       maps = NULL;
       geom = NULL;
+      mf_geom_maps = NULL;
+      mf_weights = NULL;
 #ifdef MFEM_USE_CEED
       ceedDataPtr = NULL;
 #endif
@@ -1984,16 +2082,32 @@ public:
                                        ElementTransformation &Trans,
                                        DenseMatrix &elmat);
 
+   virtual bool SupportsThreadedAssembly() const { return true; }
+
    using BilinearFormIntegrator::AssemblePA;
 
    virtual void AssemblePA(const FiniteElementSpace &fes);
 
+   virtual void ReassemblePA(const FiniteElementSpace &fes);
+
    virtual void AssembleEA(const FiniteElementSpace &fes, Vector &emat);
 
    virtual void AssembleDiagonalPA(Vector &diag);
 
    virtual void AddMultPA(const Vector&, Vector&) const;
 
+   virtual void AddMultFusedPA(const Array<int> &gather_map,
+                               const Vector &x, Vector &y) const;
+
+   virtual bool SupportsFusedPA() const;
+
+   virtual void AssembleMF(const FiniteElementSpace &fes);
+
+   virtual void AddMultMF(const Vector&, Vector&) const;
+
+   virtual void AddMultTransposeMF(const Vector &x, Vector &y) const
+   { AddMultMF(x, y); }
+
    static const IntegrationRule &GetRule(const FiniteElement &trial_fe,
                                          const FiniteElement &test_fe,
                                          ElementTransformation &Trans);
@@ -2039,6 +2153,8 @@ public:
                                       ElementTransformation &,
                                       DenseMatrix &);
 
+   virtual bool SupportsThreadedAssembly() const { return true; }
+
    using BilinearFormIntegrator::AssemblePA;
 
    virtual void AssemblePA(const FiniteElementSpace&);
@@ -2274,6 +2390,9 @@ protected:
    const DofToQuad *mapsC;         ///< Not owned. DOF-to-quad map, closed.
    const GeometricFactors *geom;   ///< Not owned
    int dim, ne, nq, dofs1D, quad1D;
+   /// Reference curl shape functions at the quadrature points (simplices)
+   Vector simplex_shape;
+   int simplex_ndof;               ///< Zero for tensor-product elements
 
 public:
    CurlCurlIntegrator() { Q = NULL; MQ = NULL; }
@@ -2359,6 +2478,9 @@ protected:
    const DofToQuad *mapsC;         ///< Not owned. DOF-to-quad map, closed.
    const GeometricFactors *geom;   ///< Not owned
    int dim, ne, nq, dofs1D, quad1D, fetype;
+   /// Reference shape functions at the quadrature points (simplices)
+   Vector simplex_shape;
+   int simplex_ndof;               ///< Zero for tensor-product elements
 
 public:
    VectorFEMassIntegrator() { Init(NULL, NULL, NULL); }
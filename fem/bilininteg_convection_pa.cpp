@@ -791,20 +791,9 @@ void ConvectionIntegrator::AssemblePA(const FiniteElementSpace &fes)
    else
    {
       vel.SetSize(dim * nq * ne);
-      auto C = Reshape(vel.HostWrite(), dim, nq, ne);
-      Vector Vq(dim);
-      for (int e = 0; e < ne; ++e)
-      {
-         ElementTransformation& T = *fes.GetElementTransformation(e);
-         for (int q = 0; q < nq; ++q)
-         {
-            Q->Eval(Vq, T, ir->IntPoint(q));
-            for (int i = 0; i < dim; ++i)
-            {
-               C(i,q,e) = Vq(i);
-            }
-         }
-      }
+      QuadratureSpace qs(mesh, *ir);
+      QuadratureFunction qf(&qs, vel.HostWrite(), dim);
+      Q->Project(qf);
    }
    PAConvectionSetup(dim, dofs1D, quad1D, ne, ir->GetWeights(), geom->J,
                      vel, alpha, pa_data);
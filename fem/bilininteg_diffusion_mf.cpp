@@ -0,0 +1,466 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../general/forall.hpp"
+#include "bilininteg.hpp"
+#include "bilininteg_mf.hpp"
+#include "gridfunc.hpp"
+
+using namespace std;
+
+namespace mfem
+{
+
+// MF Diffusion Integrator
+
+void DiffusionIntegrator::AssembleMF(const FiniteElementSpace &fes)
+{
+   // Assuming the same element type
+   fespace = &fes;
+   Mesh *mesh = fes.GetMesh();
+   if (mesh->GetNE() == 0) { return; }
+   const FiniteElement &el = *fes.GetFE(0);
+   MFEM_VERIFY(dynamic_cast<const TensorBasisElement*>(&el) != NULL,
+               "MF is only supported on tensor-product elements!");
+   MFEM_VERIFY(MQ == NULL, "MF does not support MatrixCoefficient!");
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el);
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == mesh->SpaceDimension(),
+               "MF requires dim == space dimension!");
+   ne = fes.GetNE();
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   dofs1D = maps->ndof;
+   quad1D = maps->nqpt;
+   mf_weights = &ir->GetWeights();
+   internal::MFSetupNodes(fes, *ir, mf_nodes, mf_geom_maps);
+   if (Q == nullptr)
+   {
+      mf_coeff = 1.0;
+   }
+   else if (ConstantCoefficient* cQ = dynamic_cast<ConstantCoefficient*>(Q))
+   {
+      mf_coeff = cQ->constant;
+   }
+   else
+   {
+      MFEM_ABORT("MF only supports constant coefficients!");
+   }
+}
+
+// MF Diffusion Apply 2D kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void MFDiffusionApply2D(const int NE,
+                               const int GD1D,
+                               const Array<double> &b,
+                               const Array<double> &g,
+                               const Array<double> &gb,
+                               const Array<double> &gg,
+                               const Array<double> &w,
+                               const double coeff,
+                               const Vector &nodes,
+                               const Vector &x_,
+                               Vector &y_,
+                               const int d1d = 0,
+                               const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   MFEM_VERIFY(GD1D <= MAX_D1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto GB = Reshape(gb.Read(), Q1D, GD1D);
+   auto GG = Reshape(gg.Read(), Q1D, GD1D);
+   auto W = Reshape(w.Read(), Q1D, Q1D);
+   auto X = Reshape(nodes.Read(), GD1D, GD1D, 2, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double J[max_Q1D][max_Q1D][2][2];
+      internal::MFJacobians2D<max_Q1D>(e, GD1D, Q1D, GB, GG, X, J);
+
+      double grad[max_Q1D][max_Q1D][2];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            grad[qy][qx][0] = 0.0;
+            grad[qy][qx][1] = 0.0;
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         double gradX[max_Q1D][2];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            gradX[qx][0] = 0.0;
+            gradX[qx][1] = 0.0;
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            const double s = x(dx,dy,e);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradX[qx][0] += s * B(qx,dx);
+               gradX[qx][1] += s * G(qx,dx);
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const double wy  = B(qy,dy);
+            const double wDy = G(qy,dy);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               grad[qy][qx][0] += gradX[qx][1] * wy;
+               grad[qy][qx][1] += gradX[qx][0] * wDy;
+            }
+         }
+      }
+      // Calculate Dxy, xDy in plane
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const double J11 = J[qy][qx][0][0];
+            const double J21 = J[qy][qx][1][0];
+            const double J12 = J[qy][qx][0][1];
+            const double J22 = J[qy][qx][1][1];
+            // D = coeff * w * adj(J) adj(J)^T / det(J)
+            const double w_det = coeff * W(qx,qy) / ((J11*J22)-(J21*J12));
+            const double O11 = w_det * (J12*J12 + J22*J22);
+            const double O12 = -w_det * (J12*J11 + J22*J21);
+            const double O22 = w_det * (J11*J11 + J21*J21);
+            const double gradX = grad[qy][qx][0];
+            const double gradY = grad[qy][qx][1];
+            grad[qy][qx][0] = (O11 * gradX) + (O12 * gradY);
+            grad[qy][qx][1] = (O12 * gradX) + (O22 * gradY);
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         double gradX[max_D1D][2];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            gradX[dx][0] = 0;
+            gradX[dx][1] = 0;
+         }
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const double gX = grad[qy][qx][0];
+            const double gY = grad[qy][qx][1];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const double wx  = B(qx,dx);
+               const double wDx = G(qx,dx);
+               gradX[dx][0] += gX * wDx;
+               gradX[dx][1] += gY * wx;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            const double wy  = B(qy,dy);
+            const double wDy = G(qy,dy);
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               y(dx,dy,e) += ((gradX[dx][0] * wy) + (gradX[dx][1] * wDy));
+            }
+         }
+      }
+   });
+}
+
+// MF Diffusion Apply 3D kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void MFDiffusionApply3D(const int NE,
+                               const int GD1D,
+                               const Array<double> &b,
+                               const Array<double> &g,
+                               const Array<double> &gb,
+                               const Array<double> &gg,
+                               const Array<double> &w,
+                               const double coeff,
+                               const Vector &nodes,
+                               const Vector &x_,
+                               Vector &y_,
+                               const int d1d = 0,
+                               const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   MFEM_VERIFY(GD1D <= MAX_D1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto GB = Reshape(gb.Read(), Q1D, GD1D);
+   auto GG = Reshape(gg.Read(), Q1D, GD1D);
+   auto W = Reshape(w.Read(), Q1D, Q1D, Q1D);
+   auto X = Reshape(nodes.Read(), GD1D, GD1D, GD1D, 3, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, D1D, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double J[max_Q1D][max_Q1D][max_Q1D][3][3];
+      internal::MFJacobians3D<max_Q1D>(e, GD1D, Q1D, GB, GG, X, J);
+
+      double grad[max_Q1D][max_Q1D][max_Q1D][3];
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               grad[qz][qy][qx][0] = 0.0;
+               grad[qz][qy][qx][1] = 0.0;
+               grad[qz][qy][qx][2] = 0.0;
+            }
+         }
+      }
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         double gradXY[max_Q1D][max_Q1D][3];
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradXY[qy][qx][0] = 0.0;
+               gradXY[qy][qx][1] = 0.0;
+               gradXY[qy][qx][2] = 0.0;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            double gradX[max_Q1D][2];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradX[qx][0] = 0.0;
+               gradX[qx][1] = 0.0;
+            }
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const double s = x(dx,dy,dz,e);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  gradX[qx][0] += s * B(qx,dx);
+                  gradX[qx][1] += s * G(qx,dx);
+               }
+            }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               const double wy  = B(qy,dy);
+               const double wDy = G(qy,dy);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  const double wx  = gradX[qx][0];
+                  const double wDx = gradX[qx][1];
+                  gradXY[qy][qx][0] += wDx * wy;
+                  gradXY[qy][qx][1] += wx  * wDy;
+                  gradXY[qy][qx][2] += wx  * wy;
+               }
+            }
+         }
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            const double wz  = B(qz,dz);
+            const double wDz = G(qz,dz);
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  grad[qz][qy][qx][0] += gradXY[qy][qx][0] * wz;
+                  grad[qz][qy][qx][1] += gradXY[qy][qx][1] * wz;
+                  grad[qz][qy][qx][2] += gradXY[qy][qx][2] * wDz;
+               }
+            }
+         }
+      }
+      // Calculate Dxyz, xDyz, xyDz in plane
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double J11 = J[qz][qy][qx][0][0];
+               const double J21 = J[qz][qy][qx][1][0];
+               const double J31 = J[qz][qy][qx][2][0];
+               const double J12 = J[qz][qy][qx][0][1];
+               const double J22 = J[qz][qy][qx][1][1];
+               const double J32 = J[qz][qy][qx][2][1];
+               const double J13 = J[qz][qy][qx][0][2];
+               const double J23 = J[qz][qy][qx][1][2];
+               const double J33 = J[qz][qy][qx][2][2];
+               const double detJ = J11 * (J22 * J33 - J32 * J23) -
+               /* */               J21 * (J12 * J33 - J32 * J13) +
+               /* */               J31 * (J12 * J23 - J22 * J13);
+               const double w_det = coeff * W(qx,qy,qz) / detJ;
+               // adj(J)
+               const double A11 = (J22 * J33) - (J23 * J32);
+               const double A12 = (J32 * J13) - (J12 * J33);
+               const double A13 = (J12 * J23) - (J22 * J13);
+               const double A21 = (J31 * J23) - (J21 * J33);
+               const double A22 = (J11 * J33) - (J13 * J31);
+               const double A23 = (J21 * J13) - (J11 * J23);
+               const double A31 = (J21 * J32) - (J31 * J22);
+               const double A32 = (J31 * J12) - (J11 * J32);
+               const double A33 = (J11 * J22) - (J12 * J21);
+               // D = coeff * w * adj(J) adj(J)^T / det(J)
+               const double O11 = w_det * (A11*A11 + A12*A12 + A13*A13);
+               const double O12 = w_det * (A11*A21 + A12*A22 + A13*A23);
+               const double O13 = w_det * (A11*A31 + A12*A32 + A13*A33);
+               const double O22 = w_det * (A21*A21 + A22*A22 + A23*A23);
+               const double O23 = w_det * (A21*A31 + A22*A32 + A23*A33);
+               const double O33 = w_det * (A31*A31 + A32*A32 + A33*A33);
+               const double gradX = grad[qz][qy][qx][0];
+               const double gradY = grad[qz][qy][qx][1];
+               const double gradZ = grad[qz][qy][qx][2];
+               grad[qz][qy][qx][0] = (O11*gradX)+(O12*gradY)+(O13*gradZ);
+               grad[qz][qy][qx][1] = (O12*gradX)+(O22*gradY)+(O23*gradZ);
+               grad[qz][qy][qx][2] = (O13*gradX)+(O23*gradY)+(O33*gradZ);
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         double gradXY[max_D1D][max_D1D][3];
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               gradXY[dy][dx][0] = 0;
+               gradXY[dy][dx][1] = 0;
+               gradXY[dy][dx][2] = 0;
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            double gradX[max_D1D][3];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               gradX[dx][0] = 0;
+               gradX[dx][1] = 0;
+               gradX[dx][2] = 0;
+            }
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double gX = grad[qz][qy][qx][0];
+               const double gY = grad[qz][qy][qx][1];
+               const double gZ = grad[qz][qy][qx][2];
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const double wx  = B(qx,dx);
+                  const double wDx = G(qx,dx);
+                  gradX[dx][0] += gX * wDx;
+                  gradX[dx][1] += gY * wx;
+                  gradX[dx][2] += gZ * wx;
+               }
+            }
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               const double wy  = B(qy,dy);
+               const double wDy = G(qy,dy);
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  gradXY[dy][dx][0] += gradX[dx][0] * wy;
+                  gradXY[dy][dx][1] += gradX[dx][1] * wDy;
+                  gradXY[dy][dx][2] += gradX[dx][2] * wy;
+               }
+            }
+         }
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            const double wz  = B(qz,dz);
+            const double wDz = G(qz,dz);
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  y(dx,dy,dz,e) +=
+                     ((gradXY[dy][dx][0] * wz) +
+                      (gradXY[dy][dx][1] * wz) +
+                      (gradXY[dy][dx][2] * wDz));
+               }
+            }
+         }
+      }
+   });
+}
+
+static void MFDiffusionApply(const int dim,
+                             const int D1D,
+                             const int Q1D,
+                             const int GD1D,
+                             const int NE,
+                             const Array<double> &B,
+                             const Array<double> &G,
+                             const Array<double> &GB,
+                             const Array<double> &GG,
+                             const Array<double> &W,
+                             const double coeff,
+                             const Vector &nodes,
+                             const Vector &X,
+                             Vector &Y)
+{
+   if (dim == 2)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x22: return MFDiffusionApply2D<2,2>(NE,GD1D,B,G,GB,GG,W,coeff,
+                                                      nodes,X,Y);
+         case 0x33: return MFDiffusionApply2D<3,3>(NE,GD1D,B,G,GB,GG,W,coeff,
+                                                      nodes,X,Y);
+         case 0x44: return MFDiffusionApply2D<4,4>(NE,GD1D,B,G,GB,GG,W,coeff,
+                                                      nodes,X,Y);
+         case 0x55: return MFDiffusionApply2D<5,5>(NE,GD1D,B,G,GB,GG,W,coeff,
+                                                      nodes,X,Y);
+         default:   return MFDiffusionApply2D(NE,GD1D,B,G,GB,GG,W,coeff,
+                                                 nodes,X,Y,D1D,Q1D);
+      }
+   }
+   else if (dim == 3)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x23: return MFDiffusionApply3D<2,3>(NE,GD1D,B,G,GB,GG,W,coeff,
+                                                      nodes,X,Y);
+         case 0x34: return MFDiffusionApply3D<3,4>(NE,GD1D,B,G,GB,GG,W,coeff,
+                                                      nodes,X,Y);
+         case 0x45: return MFDiffusionApply3D<4,5>(NE,GD1D,B,G,GB,GG,W,coeff,
+                                                      nodes,X,Y);
+         case 0x56: return MFDiffusionApply3D<5,6>(NE,GD1D,B,G,GB,GG,W,coeff,
+                                                      nodes,X,Y);
+         default:   return MFDiffusionApply3D(NE,GD1D,B,G,GB,GG,W,coeff,
+                                                 nodes,X,Y,D1D,Q1D);
+      }
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+void DiffusionIntegrator::AddMultMF(const Vector &x, Vector &y) const
+{
+   MFDiffusionApply(dim, dofs1D, quad1D, mf_geom_maps->ndof, ne,
+                    maps->B, maps->G, mf_geom_maps->B, mf_geom_maps->G,
+                    *mf_weights, mf_coeff, mf_nodes, x, y);
+}
+
+} // namespace mfem
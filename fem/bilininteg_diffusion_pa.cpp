@@ -21,6 +21,16 @@ namespace mfem
 
 // PA Diffusion Integrator
 
+void PAEvalCoefficient(Coefficient *Q, Mesh *mesh, const IntegrationRule &ir,
+                       Vector &coeff);
+
+void PAScaleByCoefficient(const int NQ,
+                          const int S,
+                          const int NE,
+                          const Vector &geo,
+                          const Vector &coeff,
+                          Vector &op);
+
 // OCCA 2D Assemble kernel
 #ifdef MFEM_USE_OCCA
 static void OccaPADiffusionSetup2D(const int D1D,
@@ -82,21 +92,20 @@ static void OccaPADiffusionSetup3D(const int D1D,
 
 // PA Diffusion Assemble 2D kernel
 template<const int T_SDIM>
-static void PADiffusionSetup2D(const int Q1D,
+static void PADiffusionSetup2D(const int NQ,
                                const int NE,
                                const Array<double> &w,
                                const Vector &j,
                                const Vector &c,
                                Vector &d);
 template<>
-void PADiffusionSetup2D<2>(const int Q1D,
+void PADiffusionSetup2D<2>(const int NQ,
                            const int NE,
                            const Array<double> &w,
                            const Vector &j,
                            const Vector &c,
                            Vector &d)
 {
-   const int NQ = Q1D*Q1D;
    const bool const_c = c.Size() == 1;
    auto W = w.Read();
    auto J = Reshape(j.Read(), NQ, 2, 2, NE);
@@ -122,7 +131,7 @@ void PADiffusionSetup2D<2>(const int Q1D,
 
 // PA Diffusion Assemble 2D kernel with 3D node coords
 template<>
-void PADiffusionSetup2D<3>(const int Q1D,
+void PADiffusionSetup2D<3>(const int NQ,
                            const int NE,
                            const Array<double> &w,
                            const Vector &j,
@@ -131,7 +140,6 @@ void PADiffusionSetup2D<3>(const int Q1D,
 {
    constexpr int DIM = 2;
    constexpr int SDIM = 3;
-   const int NQ = Q1D*Q1D;
    const bool const_c = c.Size() == 1;
 
    auto W = w.Read();
@@ -163,14 +171,13 @@ void PADiffusionSetup2D<3>(const int Q1D,
 }
 
 // PA Diffusion Assemble 3D kernel
-static void PADiffusionSetup3D(const int Q1D,
+static void PADiffusionSetup3D(const int NQ,
                                const int NE,
                                const Array<double> &w,
                                const Vector &j,
                                const Vector &c,
                                Vector &d)
 {
-   const int NQ = Q1D*Q1D*Q1D;
    const bool const_c = c.Size() == 1;
    auto W = w.Read();
    auto J = Reshape(j.Read(), NQ, 3, 3, NE);
@@ -219,6 +226,7 @@ static void PADiffusionSetup(const int dim,
                              const int sdim,
                              const int D1D,
                              const int Q1D,
+                             const int NQ,
                              const int NE,
                              const Array<double> &W,
                              const Vector &J,
@@ -229,27 +237,29 @@ static void PADiffusionSetup(const int dim,
    if (dim == 2)
    {
 #ifdef MFEM_USE_OCCA
-      if (DeviceCanUseOcca())
+      // The OCCA kernels assume tensor-product elements, i.e. Q1D > 0
+      if (DeviceCanUseOcca() && Q1D > 0)
       {
          OccaPADiffusionSetup2D(D1D, Q1D, NE, W, J, C, D);
          return;
       }
 #else
       MFEM_CONTRACT_VAR(D1D);
+      MFEM_CONTRACT_VAR(Q1D);
 #endif // MFEM_USE_OCCA
-      if (sdim == 2) { PADiffusionSetup2D<2>(Q1D, NE, W, J, C, D); }
-      if (sdim == 3) { PADiffusionSetup2D<3>(Q1D, NE, W, J, C, D); }
+      if (sdim == 2) { PADiffusionSetup2D<2>(NQ, NE, W, J, C, D); }
+      if (sdim == 3) { PADiffusionSetup2D<3>(NQ, NE, W, J, C, D); }
    }
    if (dim == 3)
    {
 #ifdef MFEM_USE_OCCA
-      if (DeviceCanUseOcca())
+      if (DeviceCanUseOcca() && Q1D > 0)
       {
          OccaPADiffusionSetup3D(D1D, Q1D, NE, W, J, C, D);
          return;
       }
 #endif // MFEM_USE_OCCA
-      PADiffusionSetup3D(Q1D, NE, W, J, C, D);
+      PADiffusionSetup3D(NQ, NE, W, J, C, D);
    }
 }
 
@@ -281,36 +291,43 @@ void DiffusionIntegrator::SetupPA(const FiniteElementSpace &fes,
    ne = fes.GetNE();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS);
    const int sdim = mesh->SpaceDimension();
-   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
-   dofs1D = maps->ndof;
-   quad1D = maps->nqpt;
+   // Non-tensor elements, e.g. simplices, use the dense basis matrices
+   const bool tensor = UsesTensorBasis(fes);
+   maps = &el.GetDofToQuad(*ir, tensor ? DofToQuad::TENSOR : DofToQuad::FULL);
+   dofs1D = tensor ? maps->ndof : 0;
+   quad1D = tensor ? maps->nqpt : 0;
    pa_data.SetSize(symmDims * nq * ne, Device::GetDeviceMemoryType());
    Vector coeff;
-   if (Q == nullptr)
+   PAEvalCoefficient(Q, mesh, *ir, coeff);
+   PADiffusionSetup(dim, sdim, dofs1D, quad1D, nq, ne, ir->GetWeights(),
+                    geom->J, coeff, pa_data);
+   pa_geom.Destroy();
+}
+
+void DiffusionIntegrator::ReassemblePA(const FiniteElementSpace &fes)
+{
+   Mesh *mesh = fes.GetMesh();
+   if (pa_data.Size() == 0 || fespace != &fes || ne != mesh->GetNE())
    {
-      coeff.SetSize(1);
-      coeff(0) = 1.0;
+      // No reusable data, e.g. when using libCEED
+      SetupPA(fes);
+      return;
    }
-   else if (ConstantCoefficient* cQ = dynamic_cast<ConstantCoefficient*>(Q))
+   const FiniteElement &el = *fes.GetFE(0);
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el);
+   const int nq = ir->GetNPoints();
+   if (pa_geom.Size() == 0)
    {
-      coeff.SetSize(1);
-      coeff(0) = cQ->constant;
+      Vector one(1);
+      one(0) = 1.0;
+      pa_geom.SetSize(pa_data.Size(), Device::GetDeviceMemoryType());
+      PADiffusionSetup(dim, mesh->SpaceDimension(), dofs1D, quad1D, nq, ne,
+                       ir->GetWeights(), geom->J, one, pa_geom);
    }
-   else
-   {
-      coeff.SetSize(nq * ne);
-      auto C = Reshape(coeff.HostWrite(), nq, ne);
-      for (int e = 0; e < ne; ++e)
-      {
-         ElementTransformation& T = *fes.GetElementTransformation(e);
-         for (int q = 0; q < nq; ++q)
-         {
-            C(q,e) = Q->Eval(T, ir->IntPoint(q));
-         }
-      }
-   }
-   PADiffusionSetup(dim, sdim, dofs1D, quad1D, ne, ir->GetWeights(), geom->J,
-                    coeff, pa_data);
+   Vector coeff;
+   PAEvalCoefficient(Q, mesh, *ir, coeff);
+   PAScaleByCoefficient(nq, pa_data.Size()/(nq*ne), ne, pa_geom, coeff,
+                        pa_data);
 }
 
 void DiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
@@ -734,9 +751,62 @@ static void PADiffusionAssembleDiagonal(const int dim,
    MFEM_ABORT("Unknown kernel.");
 }
 
+// PA Diffusion Diagonal kernel for non-tensor elements, with the dense
+// ND x NQ x DIM matrix Gt of the reference gradients at the quadrature points
+template<int DIM>
+static void PADiffusionDiagonalDense(const int ND,
+                                     const int NQ,
+                                     const int NE,
+                                     const Array<double> &gt,
+                                     const Vector &d,
+                                     Vector &y)
+{
+   constexpr int SYM = (DIM*(DIM+1))/2;
+   auto Gt = Reshape(gt.Read(), ND, NQ, DIM);
+   auto D = Reshape(d.Read(), NQ, SYM, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   MFEM_FORALL(e, NE,
+   {
+      for (int dof = 0; dof < ND; ++dof)
+      {
+         double val = 0.0;
+         for (int q = 0; q < NQ; ++q)
+         {
+            const double gx = Gt(dof,q,0);
+            const double gy = Gt(dof,q,1);
+            if (DIM == 2)
+            {
+               val += D(q,0,e)*gx*gx + 2.0*D(q,1,e)*gx*gy + D(q,2,e)*gy*gy;
+            }
+            else
+            {
+               const double gz = Gt(dof,q,DIM-1);
+               val += D(q,0,e)*gx*gx + D(q,3,e)*gy*gy + D(q,5,e)*gz*gz +
+                      2.0*(D(q,1,e)*gx*gy + D(q,2,e)*gx*gz + D(q,4,e)*gy*gz);
+            }
+         }
+         Y(dof,e) += val;
+      }
+   });
+}
+
 void DiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
 {
    if (pa_data.Size()==0) { SetupPA(*fespace, true); }
+   if (maps->mode == DofToQuad::FULL)
+   {
+      if (dim == 2)
+      {
+         return PADiffusionDiagonalDense<2>(maps->ndof, maps->nqpt, ne,
+                                            maps->Gt, pa_data, diag);
+      }
+      if (dim == 3)
+      {
+         return PADiffusionDiagonalDense<3>(maps->ndof, maps->nqpt, ne,
+                                            maps->Gt, pa_data, diag);
+      }
+      MFEM_ABORT("Unknown kernel.");
+   }
    PADiffusionAssembleDiagonal(dim, dofs1D, quad1D, ne,
                                maps->B, maps->G, pa_data, diag);
 }
@@ -843,7 +913,7 @@ static void OccaPADiffusionApply3D(const int D1D,
 #endif // MFEM_USE_OCCA
 
 // PA Diffusion Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, bool FUSED = false>
 static void PADiffusionApply2D(const int NE,
                                const Array<double> &b_,
                                const Array<double> &g_,
@@ -853,7 +923,8 @@ static void PADiffusionApply2D(const int NE,
                                const Vector &x_,
                                Vector &y_,
                                const int d1d = 0,
-                               const int q1d = 0)
+                               const int q1d = 0,
+                               const int *map_ = nullptr)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
@@ -866,6 +937,9 @@ static void PADiffusionApply2D(const int NE,
    auto D = Reshape(d_.Read(), Q1D*Q1D, 3, NE);
    auto X = Reshape(x_.Read(), D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
+   auto M = Reshape(map_, D1D, D1D, NE);
+   auto xl = x_.Read();
+   auto yl = y_.ReadWrite();
    MFEM_FORALL(e, NE,
    {
       const int D1D = T_D1D ? T_D1D : d1d;
@@ -893,7 +967,8 @@ static void PADiffusionApply2D(const int NE,
          }
          for (int dx = 0; dx < D1D; ++dx)
          {
-            const double s = X(dx,dy,e);
+            const double s = FUSED ? internal::GatherL(xl, M(dx,dy,e)) :
+                             X(dx,dy,e);
             for (int qx = 0; qx < Q1D; ++qx)
             {
                gradX[qx][0] += s * B(qx,dx);
@@ -955,7 +1030,9 @@ static void PADiffusionApply2D(const int NE,
             const double wDy = Gt(dy,qy);
             for (int dx = 0; dx < D1D; ++dx)
             {
-               Y(dx,dy,e) += ((gradX[dx][0] * wy) + (gradX[dx][1] * wDy));
+               const double val = (gradX[dx][0] * wy) + (gradX[dx][1] * wDy);
+               if (FUSED) { internal::ScatterAddL(yl, M(dx,dy,e), val); }
+               else { Y(dx,dy,e) += val; }
             }
          }
       }
@@ -963,7 +1040,7 @@ static void PADiffusionApply2D(const int NE,
 }
 
 // Shared memory PA Diffusion Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0, int T_NBZ = 0>
+template<int T_D1D = 0, int T_Q1D = 0, int T_NBZ = 0, bool FUSED = false>
 static void SmemPADiffusionApply2D(const int NE,
                                    const Array<double> &b_,
                                    const Array<double> &g_,
@@ -971,7 +1048,8 @@ static void SmemPADiffusionApply2D(const int NE,
                                    const Vector &x_,
                                    Vector &y_,
                                    const int d1d = 0,
-                                   const int q1d = 0)
+                                   const int q1d = 0,
+                                   const int *map_ = nullptr)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
@@ -985,6 +1063,9 @@ static void SmemPADiffusionApply2D(const int NE,
    auto D = Reshape(d_.Read(), Q1D*Q1D, 3, NE);
    auto x = Reshape(x_.Read(), D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
+   auto M = Reshape(map_, D1D, D1D, NE);
+   auto xl = x_.Read();
+   auto yl = y_.ReadWrite();
    MFEM_FORALL_2D(e, NE, Q1D, Q1D, NBZ,
    {
       const int tidz = MFEM_THREAD_ID(z);
@@ -1010,7 +1091,8 @@ static void SmemPADiffusionApply2D(const int NE,
       {
          MFEM_FOREACH_THREAD(dx,x,D1D)
          {
-            X[dy][dx] = x(dx,dy,e);
+            X[dy][dx] = FUSED ? internal::GatherL(xl, M(dx,dy,e)) :
+                        x(dx,dy,e);
          }
       }
       if (tidz == 0)
@@ -1112,14 +1194,16 @@ static void SmemPADiffusionApply2D(const int NE,
                u += DQ0[qy][dx] * Bt[dy][qy];
                v += DQ1[qy][dx] * Gt[dy][qy];
             }
-            Y(dx,dy,e) += (u + v);
+            const double val = u + v;
+            if (FUSED) { internal::ScatterAddL(yl, M(dx,dy,e), val); }
+            else { Y(dx,dy,e) += val; }
          }
       }
    });
 }
 
 // PA Diffusion Apply 3D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, bool FUSED = false>
 static void PADiffusionApply3D(const int NE,
                                const Array<double> &b,
                                const Array<double> &g,
@@ -1128,7 +1212,8 @@ static void PADiffusionApply3D(const int NE,
                                const Vector &d_,
                                const Vector &x_,
                                Vector &y_,
-                               int d1d = 0, int q1d = 0)
+                               int d1d = 0, int q1d = 0,
+                               const int *map_ = nullptr)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
@@ -1141,6 +1226,9 @@ static void PADiffusionApply3D(const int NE,
    auto D = Reshape(d_.Read(), Q1D*Q1D*Q1D, 6, NE);
    auto X = Reshape(x_.Read(), D1D, D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
+   auto M = Reshape(map_, D1D, D1D, D1D, NE);
+   auto xl = x_.Read();
+   auto yl = y_.ReadWrite();
    MFEM_FORALL(e, NE,
    {
       const int D1D = T_D1D ? T_D1D : d1d;
@@ -1182,7 +1270,8 @@ static void PADiffusionApply3D(const int NE,
             }
             for (int dx = 0; dx < D1D; ++dx)
             {
-               const double s = X(dx,dy,dz,e);
+               const double s = FUSED ? internal::GatherL(xl, M(dx,dy,dz,e)) :
+                                X(dx,dy,dz,e);
                for (int qx = 0; qx < Q1D; ++qx)
                {
                   gradX[qx][0] += s * B(qx,dx);
@@ -1296,10 +1385,11 @@ static void PADiffusionApply3D(const int NE,
             {
                for (int dx = 0; dx < D1D; ++dx)
                {
-                  Y(dx,dy,dz,e) +=
-                     ((gradXY[dy][dx][0] * wz) +
-                      (gradXY[dy][dx][1] * wz) +
-                      (gradXY[dy][dx][2] * wDz));
+                  const double val = (gradXY[dy][dx][0] * wz) +
+                                     (gradXY[dy][dx][1] * wz) +
+                                     (gradXY[dy][dx][2] * wDz);
+                  if (FUSED) { internal::ScatterAddL(yl, M(dx,dy,dz,e), val); }
+                  else { Y(dx,dy,dz,e) += val; }
                }
             }
          }
@@ -1308,7 +1398,7 @@ static void PADiffusionApply3D(const int NE,
 }
 
 // Shared memory PA Diffusion Apply 3D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, bool FUSED = false>
 static void SmemPADiffusionApply3D(const int NE,
                                    const Array<double> &b_,
                                    const Array<double> &g_,
@@ -1316,7 +1406,8 @@ static void SmemPADiffusionApply3D(const int NE,
                                    const Vector &x_,
                                    Vector &y_,
                                    const int d1d = 0,
-                                   const int q1d = 0)
+                                   const int q1d = 0,
+                                   const int *map_ = nullptr)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
@@ -1329,6 +1420,9 @@ static void SmemPADiffusionApply3D(const int NE,
    auto d = Reshape(d_.Read(), Q1D*Q1D*Q1D, 6, NE);
    auto x = Reshape(x_.Read(), D1D, D1D, D1D, NE);
    auto y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
+   auto M = Reshape(map_, D1D, D1D, D1D, NE);
+   auto xl = x_.Read();
+   auto yl = y_.ReadWrite();
    MFEM_FORALL_3D(e, NE, Q1D, Q1D, Q1D,
    {
       const int tidz = MFEM_THREAD_ID(z);
@@ -1365,7 +1459,8 @@ static void SmemPADiffusionApply3D(const int NE,
          {
             MFEM_FOREACH_THREAD(dx,x,D1D)
             {
-               X[dz][dy][dx] = x(dx,dy,dz,e);
+               X[dz][dy][dx] = FUSED ? internal::GatherL(xl, M(dx,dy,dz,e)) :
+                               x(dx,dy,dz,e);
             }
          }
       }
@@ -1539,7 +1634,9 @@ static void SmemPADiffusionApply3D(const int NE,
                   v += QDD1[qz][dy][dx] * Bt[dz][qz];
                   w += QDD2[qz][dy][dx] * Gt[dz][qz];
                }
-               y(dx,dy,dz,e) += (u + v + w);
+               const double val = u + v + w;
+               if (FUSED) { internal::ScatterAddL(yl, M(dx,dy,dz,e), val); }
+               else { y(dx,dy,dz,e) += val; }
             }
          }
       }
@@ -1608,6 +1705,167 @@ static void PADiffusionApply(const int dim,
    MFEM_ABORT("Unknown kernel.");
 }
 
+// PA Diffusion Apply kernel, reading and writing L-vectors through the gather
+// map
+static void PADiffusionApplyFused(const int dim,
+                                  const int D1D,
+                                  const int Q1D,
+                                  const int NE,
+                                  const Array<double> &B,
+                                  const Array<double> &G,
+                                  const Array<double> &Bt,
+                                  const Array<double> &Gt,
+                                  const Vector &D,
+                                  const Array<int> &gather_map,
+                                  const Vector &X,
+                                  Vector &Y)
+{
+   const int *M = gather_map.Read();
+   if (dim == 2)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x22:
+            return SmemPADiffusionApply2D<2,2,16,true>(NE,B,G,D,X,Y,D1D,Q1D,M);
+         case 0x33:
+            return SmemPADiffusionApply2D<3,3,16,true>(NE,B,G,D,X,Y,D1D,Q1D,M);
+         case 0x44:
+            return SmemPADiffusionApply2D<4,4,8,true>(NE,B,G,D,X,Y,D1D,Q1D,M);
+         case 0x55:
+            return SmemPADiffusionApply2D<5,5,8,true>(NE,B,G,D,X,Y,D1D,Q1D,M);
+         default:
+            return PADiffusionApply2D<0,0,true>(NE,B,G,Bt,Gt,D,X,Y,
+                                                D1D,Q1D,M);
+      }
+   }
+   else if (dim == 3)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x23:
+            return SmemPADiffusionApply3D<2,3,true>(NE,B,G,D,X,Y,D1D,Q1D,M);
+         case 0x34:
+            return SmemPADiffusionApply3D<3,4,true>(NE,B,G,D,X,Y,D1D,Q1D,M);
+         case 0x45:
+            return SmemPADiffusionApply3D<4,5,true>(NE,B,G,D,X,Y,D1D,Q1D,M);
+         case 0x56:
+            return SmemPADiffusionApply3D<5,6,true>(NE,B,G,D,X,Y,D1D,Q1D,M);
+         default:
+            return PADiffusionApply3D<0,0,true>(NE,B,G,Bt,Gt,D,X,Y,
+                                                D1D,Q1D,M);
+      }
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+// PA Diffusion Apply kernel for non-tensor elements, e.g. simplices. The dense
+// ND x NQ x DIM matrix Gt of the reference gradients at the quadrature points
+// is applied to all elements: for each point, the gradient is computed from
+// the element dofs, multiplied by the symmetric quadrature data and added back
+// with Gt. The inner loops are over the contiguous dofs, with a compile-time
+// size for common orders.
+template<int DIM, int T_ND = 0>
+static void PADiffusionApplyDense(const int NQ,
+                                  const int NE,
+                                  const Array<double> &gt,
+                                  const Vector &d,
+                                  const Vector &x,
+                                  Vector &y,
+                                  const int nd = 0)
+{
+   constexpr int SYM = (DIM*(DIM+1))/2;
+   const int ND = T_ND ? T_ND : nd;
+   auto Gt = Reshape(gt.Read(), ND, NQ, DIM);
+   auto D = Reshape(d.Read(), NQ, SYM, NE);
+   auto X = Reshape(x.Read(), ND, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int ND = T_ND ? T_ND : nd; // nvcc workaround
+      for (int q = 0; q < NQ; ++q)
+      {
+         double grad[3] = {0.0, 0.0, 0.0};
+         for (int c = 0; c < DIM; ++c)
+         {
+            for (int dof = 0; dof < ND; ++dof)
+            {
+               grad[c] += Gt(dof,q,c) * X(dof,e);
+            }
+         }
+         double v[3];
+         if (DIM == 2)
+         {
+            v[0] = D(q,0,e)*grad[0] + D(q,1,e)*grad[1];
+            v[1] = D(q,1,e)*grad[0] + D(q,2,e)*grad[1];
+         }
+         else
+         {
+            v[0] = D(q,0,e)*grad[0] + D(q,1,e)*grad[1] + D(q,2,e)*grad[2];
+            v[1] = D(q,1,e)*grad[0] + D(q,3,e)*grad[1] + D(q,4,e)*grad[2];
+            v[2] = D(q,2,e)*grad[0] + D(q,4,e)*grad[1] + D(q,5,e)*grad[2];
+         }
+         for (int c = 0; c < DIM; ++c)
+         {
+            for (int dof = 0; dof < ND; ++dof)
+            {
+               Y(dof,e) += Gt(dof,q,c) * v[c];
+            }
+         }
+      }
+   });
+}
+
+static void PADiffusionApplyDense(const int dim,
+                                  const int ND,
+                                  const int NQ,
+                                  const int NE,
+                                  const Array<double> &Gt,
+                                  const Vector &D,
+                                  const Vector &X,
+                                  Vector &Y)
+{
+   // Triangles and tetrahedra of order 1 to 4
+   if (dim == 2)
+   {
+      switch (ND)
+      {
+         case 3:  return PADiffusionApplyDense<2,3>(NQ,NE,Gt,D,X,Y);
+         case 6:  return PADiffusionApplyDense<2,6>(NQ,NE,Gt,D,X,Y);
+         case 10: return PADiffusionApplyDense<2,10>(NQ,NE,Gt,D,X,Y);
+         case 15: return PADiffusionApplyDense<2,15>(NQ,NE,Gt,D,X,Y);
+         default: return PADiffusionApplyDense<2>(NQ,NE,Gt,D,X,Y,ND);
+      }
+   }
+   else if (dim == 3)
+   {
+      switch (ND)
+      {
+         case 4:  return PADiffusionApplyDense<3,4>(NQ,NE,Gt,D,X,Y);
+         case 10: return PADiffusionApplyDense<3,10>(NQ,NE,Gt,D,X,Y);
+         case 20: return PADiffusionApplyDense<3,20>(NQ,NE,Gt,D,X,Y);
+         case 35: return PADiffusionApplyDense<3,35>(NQ,NE,Gt,D,X,Y);
+         default: return PADiffusionApplyDense<3>(NQ,NE,Gt,D,X,Y,ND);
+      }
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+bool DiffusionIntegrator::SupportsFusedPA() const
+{
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca()) { return false; }
+#endif
+   return !DeviceCanUseCeed() && maps && maps->mode == DofToQuad::TENSOR;
+}
+
+void DiffusionIntegrator::AddMultFusedPA(const Array<int> &gather_map,
+                                         const Vector &x, Vector &y) const
+{
+   PADiffusionApplyFused(dim, dofs1D, quad1D, ne,
+                         maps->B, maps->G, maps->Bt, maps->Gt,
+                         pa_data, gather_map, x, y);
+}
+
 // PA Diffusion Apply kernel
 void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
@@ -1640,6 +1898,12 @@ void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
    }
    else
 #endif
+   if (maps->mode == DofToQuad::FULL)
+   {
+      PADiffusionApplyDense(dim, maps->ndof, maps->nqpt, ne, maps->Gt,
+                            pa_data, x, y);
+   }
+   else
    {
       PADiffusionApply(dim, dofs1D, quad1D, ne,
                        maps->B, maps->G, maps->Bt, maps->Gt,
@@ -23,15 +23,36 @@ namespace mfem
 constexpr int HCURL_MAX_D1D = 5;
 constexpr int HCURL_MAX_Q1D = 6;
 
+void PAVectorFESimplexShape(const FiniteElement &el,
+                            const IntegrationRule &ir,
+                            const int deriv_type,
+                            Vector &shape);
+
+void PAVectorFESimplexApply(const int vdim,
+                            const int ND,
+                            const int NQ,
+                            const int NE,
+                            const Vector &B,
+                            const Vector &op,
+                            const Vector &x,
+                            Vector &y);
+
+void PAVectorFESimplexAssembleDiagonal(const int vdim,
+                                       const int ND,
+                                       const int NQ,
+                                       const int NE,
+                                       const Vector &B,
+                                       const Vector &op,
+                                       Vector &diag);
+
 // PA H(curl) Mass Assemble 2D kernel
-void PAHcurlSetup2D(const int Q1D,
+void PAHcurlSetup2D(const int NQ,
                     const int NE,
                     const Array<double> &w,
                     const Vector &j,
                     Vector &_coeff,
                     Vector &op)
 {
-   const int NQ = Q1D*Q1D;
    auto W = w.Read();
 
    auto J = Reshape(j.Read(), NQ, 2, 2, NE);
@@ -55,14 +76,13 @@ void PAHcurlSetup2D(const int Q1D,
 }
 
 // PA H(curl) Mass Assemble 3D kernel
-void PAHcurlSetup3D(const int Q1D,
+void PAHcurlSetup3D(const int NQ,
                     const int NE,
                     const Array<double> &w,
                     const Vector &j,
                     Vector &_coeff,
                     Vector &op)
 {
-   const int NQ = Q1D*Q1D*Q1D;
    auto W = w.Read();
    auto J = Reshape(j.Read(), NQ, 3, 3, NE);
    auto coeff = Reshape(_coeff.Read(), NQ, NE);
@@ -548,14 +568,13 @@ void PAHcurlMassApply3D(const int D1D,
 }
 
 // PA H(curl) curl-curl assemble 2D kernel
-static void PACurlCurlSetup2D(const int Q1D,
+static void PACurlCurlSetup2D(const int NQ,
                               const int NE,
                               const Array<double> &w,
                               const Vector &j,
                               Vector &_coeff,
                               Vector &op)
 {
-   const int NQ = Q1D*Q1D;
    auto W = w.Read();
    auto J = Reshape(j.Read(), NQ, 2, 2, NE);
    auto coeff = Reshape(_coeff.Read(), NQ, NE);
@@ -575,14 +594,13 @@ static void PACurlCurlSetup2D(const int Q1D,
 }
 
 // PA H(curl) curl-curl assemble 3D kernel
-static void PACurlCurlSetup3D(const int Q1D,
+static void PACurlCurlSetup3D(const int NQ,
                               const int NE,
                               const Array<double> &w,
                               const Vector &j,
                               Vector &_coeff,
                               Vector &op)
 {
-   const int NQ = Q1D*Q1D*Q1D;
    auto W = w.Read();
    auto J = Reshape(j.Read(), NQ, 3, 3, NE);
    auto coeff = Reshape(_coeff.Read(), NQ, NE);
@@ -619,32 +637,52 @@ static void PACurlCurlSetup3D(const int Q1D,
 
 void CurlCurlIntegrator::AssemblePA(const FiniteElementSpace &fes)
 {
-   // Assumes tensor-product elements
+   // Assumes tensor-product elements or simplices
    Mesh *mesh = fes.GetMesh();
    const FiniteElement *fel = fes.GetFE(0);
 
    const VectorTensorFiniteElement *el =
       dynamic_cast<const VectorTensorFiniteElement*>(fel);
-   MFEM_VERIFY(el != NULL, "Only VectorTensorFiniteElement is supported!");
-
+   const Geometry::Type geom_type = fel->GetGeomType();
+   const bool simplex = (geom_type == Geometry::TRIANGLE ||
+                         geom_type == Geometry::TETRAHEDRON);
+   MFEM_VERIFY(el != NULL || (simplex &&
+                              fel->GetDerivType() == FiniteElement::CURL),
+               "Only VectorTensorFiniteElement and Nedelec elements on "
+               "simplices are supported!");
+
+   // On simplices, use the same rule as AssembleElementMatrix()
    const IntegrationRule *ir
-      = IntRule ? IntRule : &MassIntegrator::GetRule(*el, *el,
-                                                     *mesh->GetElementTransformation(0));
-   const int dims = el->GetDim();
+      = IntRule ? IntRule : (el ? &MassIntegrator::GetRule(*fel, *fel,
+                                                           *mesh->GetElementTransformation(0)) :
+                             &IntRules.Get(geom_type, 2*fel->GetOrder() - 2));
+   const int dims = fel->GetDim();
    MFEM_VERIFY(dims == 2 || dims == 3, "");
 
-   const int nq = ir->GetNPoints();
+   nq = ir->GetNPoints();
    dim = mesh->Dimension();
    MFEM_VERIFY(dim == 2 || dim == 3, "");
 
    ne = fes.GetNE();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS);
-   mapsC = &el->GetDofToQuad(*ir, DofToQuad::TENSOR);
-   mapsO = &el->GetDofToQuadOpen(*ir, DofToQuad::TENSOR);
-   dofs1D = mapsC->ndof;
-   quad1D = mapsC->nqpt;
+   if (el)
+   {
+      mapsC = &el->GetDofToQuad(*ir, DofToQuad::TENSOR);
+      mapsO = &el->GetDofToQuadOpen(*ir, DofToQuad::TENSOR);
+      dofs1D = mapsC->ndof;
+      quad1D = mapsC->nqpt;
+      simplex_ndof = 0;
 
-   MFEM_VERIFY(dofs1D == mapsO->ndof + 1 && quad1D == mapsO->nqpt, "");
+      MFEM_VERIFY(dofs1D == mapsO->ndof + 1 && quad1D == mapsO->nqpt, "");
+   }
+   else
+   {
+      mapsC = mapsO = NULL;
+      dofs1D = quad1D = 0;
+      simplex_ndof = fel->GetDof();
+      PAVectorFESimplexShape(*fel, *ir, mfem::FiniteElement::CURL,
+                             simplex_shape);
+   }
 
    const int ndata = (dim == 2) ? 1 : 6;
    pa_data.SetSize(ndata * nq * ne, Device::GetMemoryType());
@@ -653,26 +691,21 @@ void CurlCurlIntegrator::AssemblePA(const FiniteElementSpace &fes)
    coeff = 1.0;
    if (Q)
    {
-      for (int e=0; e<ne; ++e)
-      {
-         ElementTransformation *tr = mesh->GetElementTransformation(e);
-         for (int p=0; p<nq; ++p)
-         {
-            coeff[p + (e * nq)] = Q->Eval(*tr, ir->IntPoint(p));
-         }
-      }
+      QuadratureSpace qs(mesh, *ir);
+      QuadratureFunction qf(&qs, coeff.HostWrite());
+      Q->Project(qf);
    }
 
-   if (el->GetDerivType() == mfem::FiniteElement::CURL && dim == 3)
+   if (fel->GetDerivType() == mfem::FiniteElement::CURL && dim == 3)
    {
       // pa_data_2.SetSize(6 * nq * ne, Device::GetMemoryType());
 
-      PACurlCurlSetup3D(quad1D, ne, ir->GetWeights(), geom->J,
+      PACurlCurlSetup3D(nq, ne, ir->GetWeights(), geom->J,
                         coeff, pa_data);
    }
-   else if (el->GetDerivType() == mfem::FiniteElement::CURL && dim == 2)
+   else if (fel->GetDerivType() == mfem::FiniteElement::CURL && dim == 2)
    {
-      PACurlCurlSetup2D(quad1D, ne, ir->GetWeights(), geom->J,
+      PACurlCurlSetup2D(nq, ne, ir->GetWeights(), geom->J,
                         coeff, pa_data);
    }
    else
@@ -1309,6 +1342,12 @@ static void PACurlCurlApply3D(const int D1D,
 
 void CurlCurlIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
+   if (simplex_ndof > 0)
+   {
+      PAVectorFESimplexApply(dim == 3 ? 3 : 1, simplex_ndof, nq, ne,
+                             simplex_shape, pa_data, x, y);
+      return;
+   }
    if (dim == 3)
    {
       PACurlCurlApply3D(dofs1D, quad1D, ne, mapsO->B, mapsC->B, mapsO->Bt,
@@ -1575,6 +1614,12 @@ static void PACurlCurlAssembleDiagonal3D(const int D1D,
 
 void CurlCurlIntegrator::AssembleDiagonalPA(Vector& diag)
 {
+   if (simplex_ndof > 0)
+   {
+      PAVectorFESimplexAssembleDiagonal(dim == 3 ? 3 : 1, simplex_ndof, nq, ne,
+                                        simplex_shape, pa_data, diag);
+      return;
+   }
    if (dim == 3)
    {
       // Reduce HCURL_MAX_D1D/Q1D to avoid using too much memory
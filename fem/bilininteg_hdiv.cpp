@@ -29,14 +29,13 @@ constexpr int HDIV_MAX_Q1D = 6;
 
 
 // PA H(div) Mass Assemble 2D kernel
-void PAHdivSetup2D(const int Q1D,
+void PAHdivSetup2D(const int NQ,
                    const int NE,
                    const Array<double> &w,
                    const Vector &j,
                    Vector &_coeff,
                    Vector &op)
 {
-   const int NQ = Q1D*Q1D;
    auto W = w.Read();
 
    auto J = Reshape(j.Read(), NQ, 2, 2, NE);
@@ -61,14 +60,13 @@ void PAHdivSetup2D(const int Q1D,
 }
 
 // PA H(div) Mass Assemble 3D kernel
-void PAHdivSetup3D(const int Q1D,
+void PAHdivSetup3D(const int NQ,
                    const int NE,
                    const Array<double> &w,
                    const Vector &j,
                    Vector &_coeff,
                    Vector &op)
 {
-   const int NQ = Q1D*Q1D*Q1D;
    auto W = w.Read();
    auto J = Reshape(j.Read(), NQ, 3, 3, NE);
    auto coeff = Reshape(_coeff.Read(), NQ, NE);
@@ -930,14 +928,9 @@ void DivDivIntegrator::AssemblePA(const FiniteElementSpace &fes)
    coeff = 1.0;
    if (Q)
    {
-      for (int e=0; e<ne; ++e)
-      {
-         ElementTransformation *tr = mesh->GetElementTransformation(e);
-         for (int p=0; p<nq; ++p)
-         {
-            coeff[p + (e * nq)] = Q->Eval(*tr, ir->IntPoint(p));
-         }
-      }
+      QuadratureSpace qs(mesh, *ir);
+      QuadratureFunction qf(&qs, coeff.HostWrite());
+      Q->Project(qf);
    }
 
    if (el->GetDerivType() == mfem::FiniteElement::DIV && dim == 3)
@@ -1199,14 +1192,9 @@ VectorFEDivergenceIntegrator::AssemblePA(const FiniteElementSpace &trial_fes,
    coeff = 1.0;
    if (Q)
    {
-      for (int e=0; e<ne; ++e)
-      {
-         ElementTransformation *tr = mesh->GetElementTransformation(e);
-         for (int p=0; p<nq; ++p)
-         {
-            coeff[p + (e * nq)] = Q->Eval(*tr, ir->IntPoint(p));
-         }
-      }
+      QuadratureSpace qs(mesh, *ir);
+      QuadratureFunction qf(&qs, coeff.HostWrite());
+      Q->Project(qf);
    }
 
    if (trial_el->GetDerivType() == mfem::FiniteElement::DIV && dim == 3)
@@ -203,6 +203,8 @@ void MassIntegrator::AssembleEA(const FiniteElementSpace &fes,
                                 Vector &ea_data)
 {
    AssemblePA(fes);
+   MFEM_VERIFY(maps->mode == DofToQuad::TENSOR,
+               "Only tensor-product elements are supported!");
    const int ne = fes.GetMesh()->GetNE();
    const Array<double> &B = maps->B;
    if (dim == 1)
@@ -0,0 +1,380 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../general/forall.hpp"
+#include "bilininteg.hpp"
+#include "bilininteg_mf.hpp"
+#include "gridfunc.hpp"
+
+using namespace std;
+
+namespace mfem
+{
+
+// MF Mass Integrator
+
+void MassIntegrator::AssembleMF(const FiniteElementSpace &fes)
+{
+   // Assuming the same element type
+   fespace = &fes;
+   Mesh *mesh = fes.GetMesh();
+   if (mesh->GetNE() == 0) { return; }
+   const FiniteElement &el = *fes.GetFE(0);
+   MFEM_VERIFY(dynamic_cast<const TensorBasisElement*>(&el) != NULL,
+               "MF is only supported on tensor-product elements!");
+   ElementTransformation *T = mesh->GetElementTransformation(0);
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el, *T);
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == mesh->SpaceDimension(),
+               "MF requires dim == space dimension!");
+   ne = fes.GetMesh()->GetNE();
+   nq = ir->GetNPoints();
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   dofs1D = maps->ndof;
+   quad1D = maps->nqpt;
+   mf_weights = &ir->GetWeights();
+   internal::MFSetupNodes(fes, *ir, mf_nodes, mf_geom_maps);
+   if (Q == nullptr)
+   {
+      mf_coeff = 1.0;
+   }
+   else if (ConstantCoefficient* cQ = dynamic_cast<ConstantCoefficient*>(Q))
+   {
+      mf_coeff = cQ->constant;
+   }
+   else
+   {
+      MFEM_ABORT("MF only supports constant coefficients!");
+   }
+}
+
+// MF Mass Apply 2D kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void MFMassApply2D(const int NE,
+                          const int GD1D,
+                          const Array<double> &b,
+                          const Array<double> &gb,
+                          const Array<double> &gg,
+                          const Array<double> &w,
+                          const double coeff,
+                          const Vector &nodes,
+                          const Vector &x_,
+                          Vector &y_,
+                          const int d1d = 0,
+                          const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   MFEM_VERIFY(GD1D <= MAX_D1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto GB = Reshape(gb.Read(), Q1D, GD1D);
+   auto GG = Reshape(gg.Read(), Q1D, GD1D);
+   auto W = Reshape(w.Read(), Q1D, Q1D);
+   auto X = Reshape(nodes.Read(), GD1D, GD1D, 2, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double J[max_Q1D][max_Q1D][2][2];
+      internal::MFJacobians2D<max_Q1D>(e, GD1D, Q1D, GB, GG, X, J);
+
+      double sol_xy[max_Q1D][max_Q1D];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            sol_xy[qy][qx] = 0.0;
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         double sol_x[max_Q1D];
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            sol_x[qy] = 0.0;
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            const double s = x(dx,dy,e);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               sol_x[qx] += B(qx,dx)* s;
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const double d2q = B(qy,dy);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               sol_xy[qy][qx] += d2q * sol_x[qx];
+            }
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const double detJ = J[qy][qx][0][0]*J[qy][qx][1][1] -
+                                J[qy][qx][1][0]*J[qy][qx][0][1];
+            sol_xy[qy][qx] *= coeff * W(qx,qy) * detJ;
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         double sol_x[max_D1D];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            sol_x[dx] = 0.0;
+         }
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const double s = sol_xy[qy][qx];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               sol_x[dx] += B(qx,dx) * s;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            const double q2d = B(qy,dy);
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               y(dx,dy,e) += q2d * sol_x[dx];
+            }
+         }
+      }
+   });
+}
+
+// MF Mass Apply 3D kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void MFMassApply3D(const int NE,
+                          const int GD1D,
+                          const Array<double> &b,
+                          const Array<double> &gb,
+                          const Array<double> &gg,
+                          const Array<double> &w,
+                          const double coeff,
+                          const Vector &nodes,
+                          const Vector &x_,
+                          Vector &y_,
+                          const int d1d = 0,
+                          const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   MFEM_VERIFY(GD1D <= MAX_D1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto GB = Reshape(gb.Read(), Q1D, GD1D);
+   auto GG = Reshape(gg.Read(), Q1D, GD1D);
+   auto W = Reshape(w.Read(), Q1D, Q1D, Q1D);
+   auto X = Reshape(nodes.Read(), GD1D, GD1D, GD1D, 3, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, D1D, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double J[max_Q1D][max_Q1D][max_Q1D][3][3];
+      internal::MFJacobians3D<max_Q1D>(e, GD1D, Q1D, GB, GG, X, J);
+
+      double sol_xyz[max_Q1D][max_Q1D][max_Q1D];
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               sol_xyz[qz][qy][qx] = 0.0;
+            }
+         }
+      }
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         double sol_xy[max_Q1D][max_Q1D];
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               sol_xy[qy][qx] = 0.0;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            double sol_x[max_Q1D];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               sol_x[qx] = 0;
+            }
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const double s = x(dx,dy,dz,e);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  sol_x[qx] += B(qx,dx) * s;
+               }
+            }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               const double wy = B(qy,dy);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  sol_xy[qy][qx] += wy * sol_x[qx];
+               }
+            }
+         }
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            const double wz = B(qz,dz);
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  sol_xyz[qz][qy][qx] += wz * sol_xy[qy][qx];
+               }
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double (&Jq)[3][3] = J[qz][qy][qx];
+               const double detJ =
+                  Jq[0][0] * (Jq[1][1] * Jq[2][2] - Jq[2][1] * Jq[1][2]) -
+                  Jq[1][0] * (Jq[0][1] * Jq[2][2] - Jq[2][1] * Jq[0][2]) +
+                  Jq[2][0] * (Jq[0][1] * Jq[1][2] - Jq[1][1] * Jq[0][2]);
+               sol_xyz[qz][qy][qx] *= coeff * W(qx,qy,qz) * detJ;
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         double sol_xy[max_D1D][max_D1D];
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               sol_xy[dy][dx] = 0;
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            double sol_x[max_D1D];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               sol_x[dx] = 0;
+            }
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double s = sol_xyz[qz][qy][qx];
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  sol_x[dx] += B(qx,dx) * s;
+               }
+            }
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               const double wy = B(qy,dy);
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  sol_xy[dy][dx] += wy * sol_x[dx];
+               }
+            }
+         }
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            const double wz = B(qz,dz);
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  y(dx,dy,dz,e) += wz * sol_xy[dy][dx];
+               }
+            }
+         }
+      }
+   });
+}
+
+static void MFMassApply(const int dim,
+                        const int D1D,
+                        const int Q1D,
+                        const int GD1D,
+                        const int NE,
+                        const Array<double> &B,
+                        const Array<double> &GB,
+                        const Array<double> &GG,
+                        const Array<double> &W,
+                        const double coeff,
+                        const Vector &nodes,
+                        const Vector &X,
+                        Vector &Y)
+{
+   if (dim == 2)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x22: return MFMassApply2D<2,2>(NE,GD1D,B,GB,GG,W,coeff,
+                                                 nodes,X,Y);
+         case 0x24: return MFMassApply2D<2,4>(NE,GD1D,B,GB,GG,W,coeff,
+                                                 nodes,X,Y);
+         case 0x33: return MFMassApply2D<3,3>(NE,GD1D,B,GB,GG,W,coeff,
+                                                 nodes,X,Y);
+         case 0x35: return MFMassApply2D<3,5>(NE,GD1D,B,GB,GG,W,coeff,
+                                                 nodes,X,Y);
+         case 0x46: return MFMassApply2D<4,6>(NE,GD1D,B,GB,GG,W,coeff,
+                                                 nodes,X,Y);
+         default:   return MFMassApply2D(NE,GD1D,B,GB,GG,W,coeff,
+                                            nodes,X,Y,D1D,Q1D);
+      }
+   }
+   else if (dim == 3)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x23: return MFMassApply3D<2,3>(NE,GD1D,B,GB,GG,W,coeff,
+                                                 nodes,X,Y);
+         case 0x24: return MFMassApply3D<2,4>(NE,GD1D,B,GB,GG,W,coeff,
+                                                 nodes,X,Y);
+         case 0x35: return MFMassApply3D<3,5>(NE,GD1D,B,GB,GG,W,coeff,
+                                                 nodes,X,Y);
+         case 0x46: return MFMassApply3D<4,6>(NE,GD1D,B,GB,GG,W,coeff,
+                                                 nodes,X,Y);
+         default:   return MFMassApply3D(NE,GD1D,B,GB,GG,W,coeff,
+                                            nodes,X,Y,D1D,Q1D);
+      }
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+void MassIntegrator::AddMultMF(const Vector &x, Vector &y) const
+{
+   MFMassApply(dim, dofs1D, quad1D, mf_geom_maps->ndof, ne, maps->B,
+               mf_geom_maps->B, mf_geom_maps->G, *mf_weights, mf_coeff,
+               mf_nodes, x, y);
+}
+
+} // namespace mfem
@@ -23,69 +23,25 @@ namespace mfem
 
 // PA Mass Assemble kernel
 
-void MassIntegrator::SetupPA(const FiniteElementSpace &fes, const bool force)
+// Setup the quadrature data of the mass operator, W * coeff * det(J), where
+// @a coeff has size 1 for a constant coefficient or NQ x NE otherwise.
+static void PAMassSetup(const int dim,
+                        const int NQ,
+                        const int NE,
+                        const Array<double> &w_,
+                        const Vector &j,
+                        const Vector &coeff,
+                        Vector &op)
 {
-   // Assuming the same element type
-   fespace = &fes;
-   Mesh *mesh = fes.GetMesh();
-   if (mesh->GetNE() == 0) { return; }
-   const FiniteElement &el = *fes.GetFE(0);
-   ElementTransformation *T = mesh->GetElementTransformation(0);
-   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el, *T);
-#ifdef MFEM_USE_CEED
-   if (DeviceCanUseCeed() && !force)
-   {
-      if (ceedDataPtr) { delete ceedDataPtr; }
-      CeedData* ptr = new CeedData();
-      ceedDataPtr = ptr;
-      InitCeedCoeff(Q, ptr);
-      return CeedPAMassAssemble(fes, *ir, *ptr);
-   }
-#endif
-   dim = mesh->Dimension();
-   ne = fes.GetMesh()->GetNE();
-   nq = ir->GetNPoints();
-   geom = mesh->GetGeometricFactors(*ir, GeometricFactors::COORDINATES |
-                                    GeometricFactors::JACOBIANS);
-   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
-   dofs1D = maps->ndof;
-   quad1D = maps->nqpt;
-   pa_data.SetSize(ne*nq, Device::GetDeviceMemoryType());
-   Vector coeff;
-   if (Q == nullptr)
-   {
-      coeff.SetSize(1);
-      coeff(0) = 1.0;
-   }
-   else if (ConstantCoefficient* cQ = dynamic_cast<ConstantCoefficient*>(Q))
-   {
-      coeff.SetSize(1);
-      coeff(0) = cQ->constant;
-   }
-   else
-   {
-      coeff.SetSize(nq * ne);
-      auto C = Reshape(coeff.HostWrite(), nq, ne);
-      for (int e = 0; e < ne; ++e)
-      {
-         ElementTransformation& T = *fes.GetElementTransformation(e);
-         for (int q = 0; q < nq; ++q)
-         {
-            C(q,e) = Q->Eval(T, ir->IntPoint(q));
-         }
-      }
-   }
    if (dim==1) { MFEM_ABORT("Not supported yet... stay tuned!"); }
    if (dim==2)
    {
-      const int NE = ne;
-      const int NQ = nq;
       const bool const_c = coeff.Size() == 1;
-      auto w = ir->GetWeights().Read();
-      auto J = Reshape(geom->J.Read(), NQ,2,2,NE);
+      auto w = w_.Read();
+      auto J = Reshape(j.Read(), NQ,2,2,NE);
       auto C =
          const_c ? Reshape(coeff.Read(), 1,1) : Reshape(coeff.Read(), NQ,NE);
-      auto v = Reshape(pa_data.Write(), NQ, NE);
+      auto v = Reshape(op.Write(), NQ, NE);
       MFEM_FORALL(e, NE,
       {
          for (int q = 0; q < NQ; ++q)
@@ -102,14 +58,12 @@ void MassIntegrator::SetupPA(const FiniteElementSpace &fes, const bool force)
    }
    if (dim==3)
    {
-      const int NE = ne;
-      const int NQ = nq;
       const bool const_c = coeff.Size() == 1;
-      auto W = ir->GetWeights().Read();
-      auto J = Reshape(geom->J.Read(), NQ,3,3,NE);
+      auto W = w_.Read();
+      auto J = Reshape(j.Read(), NQ,3,3,NE);
       auto C =
          const_c ? Reshape(coeff.Read(), 1,1) : Reshape(coeff.Read(), NQ,NE);
-      auto v = Reshape(pa_data.Write(), NQ,NE);
+      auto v = Reshape(op.Write(), NQ,NE);
       MFEM_FORALL(e, NE,
       {
          for (int q = 0; q < NQ; ++q)
@@ -127,6 +81,116 @@ void MassIntegrator::SetupPA(const FiniteElementSpace &fes, const bool force)
    }
 }
 
+// Evaluate the scalar coefficient @a Q at the points of @a ir in all elements
+// of @a mesh. A NULL or constant coefficient gives a @a coeff of size 1.
+void PAEvalCoefficient(Coefficient *Q, Mesh *mesh, const IntegrationRule &ir,
+                       Vector &coeff)
+{
+   if (Q == nullptr)
+   {
+      coeff.SetSize(1);
+      coeff(0) = 1.0;
+   }
+   else if (ConstantCoefficient* cQ = dynamic_cast<ConstantCoefficient*>(Q))
+   {
+      coeff.SetSize(1);
+      coeff(0) = cQ->constant;
+   }
+   else
+   {
+      coeff.SetSize(ir.GetNPoints() * mesh->GetNE());
+      QuadratureSpace qs(mesh, ir);
+      QuadratureFunction qf(&qs, coeff.HostWrite());
+      Q->Project(qf);
+   }
+}
+
+// Multiply the coefficient-independent quadrature data @a geo, of size
+// NQ x S x NE, by the coefficient values @a coeff, see PAEvalCoefficient().
+void PAScaleByCoefficient(const int NQ,
+                          const int S,
+                          const int NE,
+                          const Vector &geo,
+                          const Vector &coeff,
+                          Vector &op)
+{
+   const bool const_c = coeff.Size() == 1;
+   auto G = Reshape(geo.Read(), NQ, S, NE);
+   auto C = const_c ? Reshape(coeff.Read(), 1,1) : Reshape(coeff.Read(), NQ,NE);
+   auto D = Reshape(op.Write(), NQ, S, NE);
+   MFEM_FORALL(e, NE,
+   {
+      for (int q = 0; q < NQ; ++q)
+      {
+         const double c = const_c ? C(0,0) : C(q,e);
+         for (int s = 0; s < S; ++s)
+         {
+            D(q,s,e) = c * G(q,s,e);
+         }
+      }
+   });
+}
+
+void MassIntegrator::SetupPA(const FiniteElementSpace &fes, const bool force)
+{
+   // Assuming the same element type
+   fespace = &fes;
+   Mesh *mesh = fes.GetMesh();
+   if (mesh->GetNE() == 0) { return; }
+   const FiniteElement &el = *fes.GetFE(0);
+   ElementTransformation *T = mesh->GetElementTransformation(0);
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el, *T);
+#ifdef MFEM_USE_CEED
+   if (DeviceCanUseCeed() && !force)
+   {
+      if (ceedDataPtr) { delete ceedDataPtr; }
+      CeedData* ptr = new CeedData();
+      ceedDataPtr = ptr;
+      InitCeedCoeff(Q, ptr);
+      return CeedPAMassAssemble(fes, *ir, *ptr);
+   }
+#endif
+   dim = mesh->Dimension();
+   ne = fes.GetMesh()->GetNE();
+   nq = ir->GetNPoints();
+   geom = mesh->GetGeometricFactors(*ir, GeometricFactors::COORDINATES |
+                                    GeometricFactors::JACOBIANS);
+   // Non-tensor elements, e.g. simplices, use the dense basis matrices
+   const bool tensor = UsesTensorBasis(fes);
+   maps = &el.GetDofToQuad(*ir, tensor ? DofToQuad::TENSOR : DofToQuad::FULL);
+   dofs1D = tensor ? maps->ndof : 0;
+   quad1D = tensor ? maps->nqpt : 0;
+   pa_data.SetSize(ne*nq, Device::GetDeviceMemoryType());
+   Vector coeff;
+   PAEvalCoefficient(Q, mesh, *ir, coeff);
+   PAMassSetup(dim, nq, ne, ir->GetWeights(), geom->J, coeff, pa_data);
+   pa_geom.Destroy();
+}
+
+void MassIntegrator::ReassemblePA(const FiniteElementSpace &fes)
+{
+   Mesh *mesh = fes.GetMesh();
+   if (pa_data.Size() == 0 || fespace != &fes || ne != mesh->GetNE())
+   {
+      // No reusable data, e.g. when using libCEED
+      SetupPA(fes);
+      return;
+   }
+   const FiniteElement &el = *fes.GetFE(0);
+   ElementTransformation *T = mesh->GetElementTransformation(0);
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el, *T);
+   if (pa_geom.Size() == 0)
+   {
+      Vector one(1);
+      one(0) = 1.0;
+      pa_geom.SetSize(ne*nq, Device::GetDeviceMemoryType());
+      PAMassSetup(dim, nq, ne, ir->GetWeights(), geom->J, one, pa_geom);
+   }
+   Vector coeff;
+   PAEvalCoefficient(Q, mesh, *ir, coeff);
+   PAScaleByCoefficient(nq, 1, ne, pa_geom, coeff, pa_data);
+}
+
 void MassIntegrator::AssemblePA(const FiniteElementSpace &fes)
 {
    SetupPA(fes);
@@ -438,9 +502,41 @@ static void PAMassAssembleDiagonal(const int dim, const int D1D,
    MFEM_ABORT("Unknown kernel.");
 }
 
+// PA Mass Diagonal kernel for non-tensor elements, with the dense ND x NQ
+// matrix Bt of the basis functions at the quadrature points
+static void PAMassAssembleDiagonalDense(const int ND,
+                                        const int NQ,
+                                        const int NE,
+                                        const Array<double> &bt_,
+                                        const Vector &d_,
+                                        Vector &y_)
+{
+   auto Bt = Reshape(bt_.Read(), ND, NQ);
+   auto D = Reshape(d_.Read(), NQ, NE);
+   auto Y = Reshape(y_.ReadWrite(), ND, NE);
+   MFEM_FORALL(e, NE,
+   {
+      for (int d = 0; d < ND; ++d)
+      {
+         double val = 0.0;
+         for (int q = 0; q < NQ; ++q)
+         {
+            val += Bt(d,q) * Bt(d,q) * D(q,e);
+         }
+         Y(d,e) += val;
+      }
+   });
+}
+
 void MassIntegrator::AssembleDiagonalPA(Vector &diag)
 {
    if (pa_data.Size()==0) { SetupPA(*fespace, true); }
+   if (maps->mode == DofToQuad::FULL)
+   {
+      PAMassAssembleDiagonalDense(maps->ndof, maps->nqpt, ne, maps->Bt,
+                                  pa_data, diag);
+      return;
+   }
    PAMassAssembleDiagonal(dim, dofs1D, quad1D, ne, maps->B, pa_data, diag);
 }
 
@@ -537,7 +633,7 @@ static void OccaPAMassApply3D(const int D1D,
 }
 #endif // MFEM_USE_OCCA
 
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, bool FUSED = false>
 static void PAMassApply2D(const int NE,
                           const Array<double> &b_,
                           const Array<double> &bt_,
@@ -545,7 +641,8 @@ static void PAMassApply2D(const int NE,
                           const Vector &x_,
                           Vector &y_,
                           const int d1d = 0,
-                          const int q1d = 0)
+                          const int q1d = 0,
+                          const int *map_ = nullptr)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
@@ -556,6 +653,9 @@ static void PAMassApply2D(const int NE,
    auto D = Reshape(d_.Read(), Q1D, Q1D, NE);
    auto X = Reshape(x_.Read(), D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
+   auto M = Reshape(map_, D1D, D1D, NE);
+   auto xl = x_.Read();
+   auto yl = y_.ReadWrite();
    MFEM_FORALL(e, NE,
    {
       const int D1D = T_D1D ? T_D1D : d1d; // nvcc workaround
@@ -580,7 +680,8 @@ static void PAMassApply2D(const int NE,
          }
          for (int dx = 0; dx < D1D; ++dx)
          {
-            const double s = X(dx,dy,e);
+            const double s = FUSED ? internal::GatherL(xl, M(dx,dy,e)) :
+                             X(dx,dy,e);
             for (int qx = 0; qx < Q1D; ++qx)
             {
                sol_x[qx] += B(qx,dx)* s;
@@ -622,14 +723,16 @@ static void PAMassApply2D(const int NE,
             const double q2d = Bt(dy,qy);
             for (int dx = 0; dx < D1D; ++dx)
             {
-               Y(dx,dy,e) += q2d * sol_x[dx];
+               const double val = q2d * sol_x[dx];
+               if (FUSED) { internal::ScatterAddL(yl, M(dx,dy,e), val); }
+               else { Y(dx,dy,e) += val; }
             }
          }
       }
    });
 }
 
-template<int T_D1D = 0, int T_Q1D = 0, int T_NBZ = 0>
+template<int T_D1D = 0, int T_Q1D = 0, int T_NBZ = 0, bool FUSED = false>
 static void SmemPAMassApply2D(const int NE,
                               const Array<double> &b_,
                               const Array<double> &bt_,
@@ -637,7 +740,8 @@ static void SmemPAMassApply2D(const int NE,
                               const Vector &x_,
                               Vector &y_,
                               const int d1d = 0,
-                              const int q1d = 0)
+                              const int q1d = 0,
+                              const int *map_ = nullptr)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
@@ -650,6 +754,9 @@ static void SmemPAMassApply2D(const int NE,
    auto D = Reshape(d_.Read(), Q1D, Q1D, NE);
    auto x = Reshape(x_.Read(), D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
+   auto M = Reshape(map_, D1D, D1D, NE);
+   auto xl = x_.Read();
+   auto yl = y_.ReadWrite();
    MFEM_FORALL_2D(e, NE, Q1D, Q1D, NBZ,
    {
       const int tidz = MFEM_THREAD_ID(z);
@@ -672,7 +779,8 @@ static void SmemPAMassApply2D(const int NE,
       {
          MFEM_FOREACH_THREAD(dx,x,D1D)
          {
-            X[dy][dx] = x(dx,dy,e);
+            X[dy][dx] = FUSED ? internal::GatherL(xl, M(dx,dy,e)) :
+                        x(dx,dy,e);
          }
       }
       if (tidz == 0)
@@ -745,13 +853,14 @@ static void SmemPAMassApply2D(const int NE,
             {
                dd += (QD[qy][dx] * Bt[dy][qy]);
             }
-            Y(dx, dy, e) += dd;
+            if (FUSED) { internal::ScatterAddL(yl, M(dx,dy,e), dd); }
+            else { Y(dx, dy, e) += dd; }
          }
       }
    });
 }
 
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, bool FUSED = false>
 static void PAMassApply3D(const int NE,
                           const Array<double> &b_,
                           const Array<double> &bt_,
@@ -759,7 +868,8 @@ static void PAMassApply3D(const int NE,
                           const Vector &x_,
                           Vector &y_,
                           const int d1d = 0,
-                          const int q1d = 0)
+                          const int q1d = 0,
+                          const int *map_ = nullptr)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
@@ -770,6 +880,9 @@ static void PAMassApply3D(const int NE,
    auto D = Reshape(d_.Read(), Q1D, Q1D, Q1D, NE);
    auto X = Reshape(x_.Read(), D1D, D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
+   auto M = Reshape(map_, D1D, D1D, D1D, NE);
+   auto xl = x_.Read();
+   auto yl = y_.ReadWrite();
    MFEM_FORALL(e, NE,
    {
       const int D1D = T_D1D ? T_D1D : d1d;
@@ -806,7 +919,8 @@ static void PAMassApply3D(const int NE,
             }
             for (int dx = 0; dx < D1D; ++dx)
             {
-               const double s = X(dx,dy,dz,e);
+               const double s = FUSED ? internal::GatherL(xl, M(dx,dy,dz,e)) :
+                                X(dx,dy,dz,e);
                for (int qx = 0; qx < Q1D; ++qx)
                {
                   sol_x[qx] += B(qx,dx) * s;
@@ -884,7 +998,9 @@ static void PAMassApply3D(const int NE,
             {
                for (int dx = 0; dx < D1D; ++dx)
                {
-                  Y(dx,dy,dz,e) += wz * sol_xy[dy][dx];
+                  const double val = wz * sol_xy[dy][dx];
+                  if (FUSED) { internal::ScatterAddL(yl, M(dx,dy,dz,e), val); }
+                  else { Y(dx,dy,dz,e) += val; }
                }
             }
          }
@@ -892,7 +1008,7 @@ static void PAMassApply3D(const int NE,
    });
 }
 
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, bool FUSED = false>
 static void SmemPAMassApply3D(const int NE,
                               const Array<double> &b_,
                               const Array<double> &bt_,
@@ -900,7 +1016,8 @@ static void SmemPAMassApply3D(const int NE,
                               const Vector &x_,
                               Vector &y_,
                               const int d1d = 0,
-                              const int q1d = 0)
+                              const int q1d = 0,
+                              const int *map_ = nullptr)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
@@ -912,6 +1029,9 @@ static void SmemPAMassApply3D(const int NE,
    auto d = Reshape(d_.Read(), Q1D, Q1D, Q1D, NE);
    auto x = Reshape(x_.Read(), D1D, D1D, D1D, NE);
    auto y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
+   auto M = Reshape(map_, D1D, D1D, D1D, NE);
+   auto xl = x_.Read();
+   auto yl = y_.ReadWrite();
    MFEM_FORALL_3D(e, NE, Q1D, Q1D, 1,
    {
       const int D1D = T_D1D ? T_D1D : d1d;
@@ -937,7 +1057,8 @@ static void SmemPAMassApply3D(const int NE,
             MFEM_UNROLL(MD1)
             for (int dz = 0; dz < D1D; ++dz)
             {
-               X[dz][dy][dx] = x(dx,dy,dz,e);
+               X[dz][dy][dx] = FUSED ? internal::GatherL(xl, M(dx,dy,dz,e)) :
+                               x(dx,dy,dz,e);
             }
          }
          MFEM_FOREACH_THREAD(dx,x,Q1D)
@@ -1111,7 +1232,9 @@ static void SmemPAMassApply3D(const int NE,
             MFEM_UNROLL(MD1)
             for (int dz = 0; dz < D1D; ++dz)
             {
-               y(dx,dy,dz,e) += u[dz];
+               const double val = u[dz];
+               if (FUSED) { internal::ScatterAddL(yl, M(dx,dy,dz,e), val); }
+               else { y(dx,dy,dz,e) += val; }
             }
          }
       }
@@ -1187,6 +1310,129 @@ static void PAMassApply(const int dim,
    MFEM_ABORT("Unknown kernel.");
 }
 
+// PA Mass Apply kernel for non-tensor elements, e.g. simplices. The dense
+// ND x NQ matrix Bt of the basis functions at the quadrature points is applied
+// to all elements: for each point, the value is interpolated from the element
+// dofs, scaled by the quadrature data and added back with Bt. The inner loops
+// are over the contiguous dofs, with a compile-time size for common orders.
+template<int T_ND = 0>
+static void PAMassApplyDense(const int NQ,
+                             const int NE,
+                             const Array<double> &bt_,
+                             const Vector &d_,
+                             const Vector &x_,
+                             Vector &y_,
+                             const int nd = 0)
+{
+   const int ND = T_ND ? T_ND : nd;
+   auto Bt = Reshape(bt_.Read(), ND, NQ);
+   auto D = Reshape(d_.Read(), NQ, NE);
+   auto X = Reshape(x_.Read(), ND, NE);
+   auto Y = Reshape(y_.ReadWrite(), ND, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int ND = T_ND ? T_ND : nd; // nvcc workaround
+      for (int q = 0; q < NQ; ++q)
+      {
+         double u = 0.0;
+         for (int d = 0; d < ND; ++d)
+         {
+            u += Bt(d,q) * X(d,e);
+         }
+         u *= D(q,e);
+         for (int d = 0; d < ND; ++d)
+         {
+            Y(d,e) += Bt(d,q) * u;
+         }
+      }
+   });
+}
+
+static void PAMassApplyDense(const int ND,
+                             const int NQ,
+                             const int NE,
+                             const Array<double> &Bt,
+                             const Vector &D,
+                             const Vector &X,
+                             Vector &Y)
+{
+   // Triangles and tetrahedra of order 1 to 4
+   switch (ND)
+   {
+      case 3:  return PAMassApplyDense<3>(NQ,NE,Bt,D,X,Y);
+      case 4:  return PAMassApplyDense<4>(NQ,NE,Bt,D,X,Y);
+      case 6:  return PAMassApplyDense<6>(NQ,NE,Bt,D,X,Y);
+      case 10: return PAMassApplyDense<10>(NQ,NE,Bt,D,X,Y);
+      case 15: return PAMassApplyDense<15>(NQ,NE,Bt,D,X,Y);
+      case 20: return PAMassApplyDense<20>(NQ,NE,Bt,D,X,Y);
+      case 35: return PAMassApplyDense<35>(NQ,NE,Bt,D,X,Y);
+      default: return PAMassApplyDense(NQ,NE,Bt,D,X,Y,ND);
+   }
+}
+
+// PA Mass Apply kernel, reading and writing L-vectors through the gather map
+static void PAMassApplyFused(const int dim,
+                             const int D1D,
+                             const int Q1D,
+                             const int NE,
+                             const Array<double> &B,
+                             const Array<double> &Bt,
+                             const Vector &D,
+                             const Array<int> &gather_map,
+                             const Vector &X,
+                             Vector &Y)
+{
+   const int *M = gather_map.Read();
+   if (dim == 2)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x22:
+            return SmemPAMassApply2D<2,2,16,true>(NE,B,Bt,D,X,Y,D1D,Q1D,M);
+         case 0x33:
+            return SmemPAMassApply2D<3,3,16,true>(NE,B,Bt,D,X,Y,D1D,Q1D,M);
+         case 0x44:
+            return SmemPAMassApply2D<4,4,8,true>(NE,B,Bt,D,X,Y,D1D,Q1D,M);
+         case 0x55:
+            return SmemPAMassApply2D<5,5,8,true>(NE,B,Bt,D,X,Y,D1D,Q1D,M);
+         default:
+            return PAMassApply2D<0,0,true>(NE,B,Bt,D,X,Y,D1D,Q1D,M);
+      }
+   }
+   else if (dim == 3)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x23:
+            return SmemPAMassApply3D<2,3,true>(NE,B,Bt,D,X,Y,D1D,Q1D,M);
+         case 0x34:
+            return SmemPAMassApply3D<3,4,true>(NE,B,Bt,D,X,Y,D1D,Q1D,M);
+         case 0x45:
+            return SmemPAMassApply3D<4,5,true>(NE,B,Bt,D,X,Y,D1D,Q1D,M);
+         case 0x56:
+            return SmemPAMassApply3D<5,6,true>(NE,B,Bt,D,X,Y,D1D,Q1D,M);
+         default:
+            return PAMassApply3D<0,0,true>(NE,B,Bt,D,X,Y,D1D,Q1D,M);
+      }
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+bool MassIntegrator::SupportsFusedPA() const
+{
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca()) { return false; }
+#endif
+   return !DeviceCanUseCeed() && maps && maps->mode == DofToQuad::TENSOR;
+}
+
+void MassIntegrator::AddMultFusedPA(const Array<int> &gather_map,
+                                    const Vector &x, Vector &y) const
+{
+   PAMassApplyFused(dim, dofs1D, quad1D, ne, maps->B, maps->Bt, pa_data,
+                    gather_map, x, y);
+}
+
 void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
 #ifdef MFEM_USE_CEED
@@ -1218,6 +1464,11 @@ void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
    }
    else
 #endif
+   if (maps->mode == DofToQuad::FULL)
+   {
+      PAMassApplyDense(maps->ndof, maps->nqpt, ne, maps->Bt, pa_data, x, y);
+   }
+   else
    {
       PAMassApply(dim, dofs1D, quad1D, ne, maps->B, maps->Bt, pa_data, x, y);
    }
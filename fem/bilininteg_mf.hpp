@@ -0,0 +1,173 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_BILININTEG_MF
+#define MFEM_BILININTEG_MF
+
+#include "../config/config.hpp"
+#include "../general/forall.hpp"
+#include "fespace.hpp"
+
+// Helper functions shared by the matrix-free (AssemblyLevel::NONE) kernels of
+// the bilinear form integrators. Instead of storing the geometric factors at
+// the quadrature points, these kernels recompute them from the E-vector of the
+// mesh nodes inside the sum-factorized element loop.
+
+namespace mfem
+{
+
+namespace internal
+{
+
+/** @brief Compute the lexicographic E-vector of the mesh nodes, @a nodes, and
+    the tensor DofToQuad maps of the nodal element at the points of @a ir. */
+void MFSetupNodes(const FiniteElementSpace &fes, const IntegrationRule &ir,
+                  Vector &nodes, const DofToQuad *&geom_maps);
+
+/** @brief Compute the Jacobians of the element transformation of element @a e
+    at all tensor quadrature points: J[qy][qx][i][k] = dx_i/dxi_k. */
+template<int MQ1> MFEM_HOST_DEVICE inline
+void MFJacobians2D(const int e, const int GD1D, const int Q1D,
+                   const DeviceTensor<2,const double> &B,
+                   const DeviceTensor<2,const double> &G,
+                   const DeviceTensor<4,const double> &X,
+                   double J[MQ1][MQ1][2][2])
+{
+   for (int qy = 0; qy < Q1D; ++qy)
+   {
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         for (int i = 0; i < 4; ++i) { J[qy][qx][i%2][i/2] = 0.0; }
+      }
+   }
+   for (int dy = 0; dy < GD1D; ++dy)
+   {
+      double JX[MQ1][2][2];
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         for (int i = 0; i < 4; ++i) { JX[qx][i%2][i/2] = 0.0; }
+      }
+      for (int dx = 0; dx < GD1D; ++dx)
+      {
+         for (int c = 0; c < 2; ++c)
+         {
+            const double s = X(dx, dy, c, e);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               JX[qx][c][0] += s * G(qx, dx);
+               JX[qx][c][1] += s * B(qx, dx);
+            }
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         const double By = B(qy, dy);
+         const double Gy = G(qy, dy);
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int c = 0; c < 2; ++c)
+            {
+               J[qy][qx][c][0] += JX[qx][c][0] * By;
+               J[qy][qx][c][1] += JX[qx][c][1] * Gy;
+            }
+         }
+      }
+   }
+}
+
+/** @brief Compute the Jacobians of the element transformation of element @a e
+    at all tensor quadrature points: J[qz][qy][qx][i][k] = dx_i/dxi_k. */
+template<int MQ1> MFEM_HOST_DEVICE inline
+void MFJacobians3D(const int e, const int GD1D, const int Q1D,
+                   const DeviceTensor<2,const double> &B,
+                   const DeviceTensor<2,const double> &G,
+                   const DeviceTensor<5,const double> &X,
+                   double J[MQ1][MQ1][MQ1][3][3])
+{
+   for (int qz = 0; qz < Q1D; ++qz)
+   {
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int i = 0; i < 9; ++i) { J[qz][qy][qx][i%3][i/3] = 0.0; }
+         }
+      }
+   }
+   for (int dz = 0; dz < GD1D; ++dz)
+   {
+      double JXY[MQ1][MQ1][3][3];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int i = 0; i < 9; ++i) { JXY[qy][qx][i%3][i/3] = 0.0; }
+         }
+      }
+      for (int dy = 0; dy < GD1D; ++dy)
+      {
+         double JX[MQ1][3][2];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int i = 0; i < 6; ++i) { JX[qx][i%3][i/3] = 0.0; }
+         }
+         for (int dx = 0; dx < GD1D; ++dx)
+         {
+            for (int c = 0; c < 3; ++c)
+            {
+               const double s = X(dx, dy, dz, c, e);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  JX[qx][c][0] += s * G(qx, dx);
+                  JX[qx][c][1] += s * B(qx, dx);
+               }
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const double By = B(qy, dy);
+            const double Gy = G(qy, dy);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int c = 0; c < 3; ++c)
+               {
+                  JXY[qy][qx][c][0] += JX[qx][c][0] * By;
+                  JXY[qy][qx][c][1] += JX[qx][c][1] * Gy;
+                  JXY[qy][qx][c][2] += JX[qx][c][1] * By;
+               }
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         const double Bz = B(qz, dz);
+         const double Gz = G(qz, dz);
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int c = 0; c < 3; ++c)
+               {
+                  J[qz][qy][qx][c][0] += JXY[qy][qx][c][0] * Bz;
+                  J[qz][qy][qx][c][1] += JXY[qy][qx][c][1] * Bz;
+                  J[qz][qy][qx][c][2] += JXY[qy][qx][c][2] * Gz;
+               }
+            }
+         }
+      }
+   }
+}
+
+} // namespace internal
+
+} // namespace mfem
+
+#endif
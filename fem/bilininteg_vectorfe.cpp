@@ -9,19 +9,21 @@
 // terms of the BSD-3 license. We welcome feedback and contributions, see file
 // CONTRIBUTING.md for details.
 
+#include "../general/forall.hpp"
 #include "bilininteg.hpp"
+#include "gridfunc.hpp"
 
 namespace mfem
 {
 
-void PAHcurlSetup2D(const int Q1D,
+void PAHcurlSetup2D(const int NQ,
                     const int NE,
                     const Array<double> &w,
                     const Vector &j,
                     Vector &_coeff,
                     Vector &op);
 
-void PAHcurlSetup3D(const int Q1D,
+void PAHcurlSetup3D(const int NQ,
                     const int NE,
                     const Array<double> &w,
                     const Vector &j,
@@ -66,14 +68,14 @@ void PAHcurlMassApply3D(const int D1D,
                         const Vector &_x,
                         Vector &_y);
 
-void PAHdivSetup2D(const int Q1D,
+void PAHdivSetup2D(const int NQ,
                    const int NE,
                    const Array<double> &w,
                    const Vector &j,
                    Vector &_coeff,
                    Vector &op);
 
-void PAHdivSetup3D(const int Q1D,
+void PAHdivSetup3D(const int NQ,
                    const int NE,
                    const Array<double> &w,
                    const Vector &j,
@@ -140,35 +142,213 @@ void PAHdivMassApply3D(const int D1D,
                        const Vector &_x,
                        Vector &_y);
 
+// Evaluate the reference shape functions (deriv_type = FiniteElement::NONE) or
+// their curl (deriv_type = FiniteElement::CURL) of a vector finite element on a
+// simplex at the points of ir. The result is stored as ndof x vdim x nq.
+void PAVectorFESimplexShape(const FiniteElement &el,
+                            const IntegrationRule &ir,
+                            const int deriv_type,
+                            Vector &shape)
+{
+   const int dim = el.GetDim();
+   const int ND = el.GetDof();
+   const int NQ = ir.GetNPoints();
+   const bool curl = (deriv_type == mfem::FiniteElement::CURL);
+   const int vdim = (curl && dim == 2) ? 1 : dim;
+
+   DenseMatrix vshape(ND, vdim);
+   shape.SetSize(ND * vdim * NQ, Device::GetMemoryType());
+   auto B = Reshape(shape.HostWrite(), ND, vdim, NQ);
+   for (int q = 0; q < NQ; q++)
+   {
+      const IntegrationPoint &ip = ir.IntPoint(q);
+      if (curl) { el.CalcCurlShape(ip, vshape); }
+      else { el.CalcVShape(ip, vshape); }
+      for (int c = 0; c < vdim; c++)
+      {
+         for (int d = 0; d < ND; d++)
+         {
+            B(d,c,q) = vshape(d,c);
+         }
+      }
+   }
+}
+
+// Index of the entry (i,j), i <= j, of a symmetric VDIM x VDIM matrix stored
+// as the upper triangle by rows, the layout of the PA H(curl)/H(div) data
+template<int VDIM> MFEM_HOST_DEVICE inline
+int PAVectorFESymmIndex(const int i, const int j)
+{
+   return (i <= j) ? i*VDIM - (i*(i-1))/2 + (j-i) : j*VDIM - (j*(j-1))/2 + (i-j);
+}
+
+// PA vector FE apply kernel on simplices: for each quadrature point, evaluate
+// the VDIM components from the element dofs with the reference table B,
+// multiply by the symmetric quadrature data and add B^T of the result.
+template<int VDIM>
+static void PAVectorFESimplexApply(const int ND,
+                                   const int NQ,
+                                   const int NE,
+                                   const Vector &_B,
+                                   const Vector &_op,
+                                   const Vector &_x,
+                                   Vector &_y)
+{
+   constexpr int SYM = (VDIM*(VDIM+1))/2;
+   auto B = Reshape(_B.Read(), ND, VDIM, NQ);
+   auto op = Reshape(_op.Read(), NQ, SYM, NE);
+   auto x = Reshape(_x.Read(), ND, NE);
+   auto y = Reshape(_y.ReadWrite(), ND, NE);
+
+   MFEM_FORALL(e, NE,
+   {
+      for (int q = 0; q < NQ; ++q)
+      {
+         double u[VDIM];
+         for (int c = 0; c < VDIM; ++c)
+         {
+            double s = 0.0;
+            for (int d = 0; d < ND; ++d)
+            {
+               s += B(d,c,q) * x(d,e);
+            }
+            u[c] = s;
+         }
+         for (int c = 0; c < VDIM; ++c)
+         {
+            double v = 0.0;
+            for (int k = 0; k < VDIM; ++k)
+            {
+               v += op(q,PAVectorFESymmIndex<VDIM>(c,k),e) * u[k];
+            }
+            for (int d = 0; d < ND; ++d)
+            {
+               y(d,e) += B(d,c,q) * v;
+            }
+         }
+      }
+   });
+}
+
+template<int VDIM>
+static void PAVectorFESimplexAssembleDiagonal(const int ND,
+                                              const int NQ,
+                                              const int NE,
+                                              const Vector &_B,
+                                              const Vector &_op,
+                                              Vector &_diag)
+{
+   constexpr int SYM = (VDIM*(VDIM+1))/2;
+   auto B = Reshape(_B.Read(), ND, VDIM, NQ);
+   auto op = Reshape(_op.Read(), NQ, SYM, NE);
+   auto diag = Reshape(_diag.ReadWrite(), ND, NE);
+
+   MFEM_FORALL(e, NE,
+   {
+      for (int d = 0; d < ND; ++d)
+      {
+         double val = 0.0;
+         for (int q = 0; q < NQ; ++q)
+         {
+            for (int c = 0; c < VDIM; ++c)
+            {
+               for (int k = 0; k < VDIM; ++k)
+               {
+                  val += B(d,c,q) * op(q,PAVectorFESymmIndex<VDIM>(c,k),e) *
+                         B(d,k,q);
+               }
+            }
+         }
+         diag(d,e) += val;
+      }
+   });
+}
+
+void PAVectorFESimplexApply(const int vdim,
+                            const int ND,
+                            const int NQ,
+                            const int NE,
+                            const Vector &B,
+                            const Vector &op,
+                            const Vector &x,
+                            Vector &y)
+{
+   switch (vdim)
+   {
+      case 1: return PAVectorFESimplexApply<1>(ND, NQ, NE, B, op, x, y);
+      case 2: return PAVectorFESimplexApply<2>(ND, NQ, NE, B, op, x, y);
+      case 3: return PAVectorFESimplexApply<3>(ND, NQ, NE, B, op, x, y);
+   }
+   MFEM_ABORT("Unsupported dimension!");
+}
+
+void PAVectorFESimplexAssembleDiagonal(const int vdim,
+                                       const int ND,
+                                       const int NQ,
+                                       const int NE,
+                                       const Vector &B,
+                                       const Vector &op,
+                                       Vector &diag)
+{
+   switch (vdim)
+   {
+      case 1: return PAVectorFESimplexAssembleDiagonal<1>(ND, NQ, NE, B, op,
+                                                             diag);
+      case 2: return PAVectorFESimplexAssembleDiagonal<2>(ND, NQ, NE, B, op,
+                                                             diag);
+      case 3: return PAVectorFESimplexAssembleDiagonal<3>(ND, NQ, NE, B, op,
+                                                             diag);
+   }
+   MFEM_ABORT("Unsupported dimension!");
+}
+
 void VectorFEMassIntegrator::AssemblePA(const FiniteElementSpace &fes)
 {
-   // Assumes tensor-product elements
+   // Assumes tensor-product elements or simplices
    Mesh *mesh = fes.GetMesh();
    const FiniteElement *fel = fes.GetFE(0);
 
    const VectorTensorFiniteElement *el =
       dynamic_cast<const VectorTensorFiniteElement*>(fel);
-   MFEM_VERIFY(el != NULL, "Only VectorTensorFiniteElement is supported!");
+   const Geometry::Type geom_type = fel->GetGeomType();
+   const bool simplex = (geom_type == Geometry::TRIANGLE ||
+                         geom_type == Geometry::TETRAHEDRON);
+   MFEM_VERIFY(el != NULL || (simplex &&
+                              fel->GetRangeType() == FiniteElement::VECTOR),
+               "Only VectorTensorFiniteElement and vector finite elements on "
+               "simplices are supported!");
 
    const IntegrationRule *ir
-      = IntRule ? IntRule : &MassIntegrator::GetRule(*el, *el,
+      = IntRule ? IntRule : &MassIntegrator::GetRule(*fel, *fel,
                                                      *mesh->GetElementTransformation(0));
-   const int dims = el->GetDim();
+   const int dims = fel->GetDim();
    MFEM_VERIFY(dims == 2 || dims == 3, "");
 
    const int symmDims = (dims * (dims + 1)) / 2; // 1x1: 1, 2x2: 3, 3x3: 6
-   const int nq = ir->GetNPoints();
+   nq = ir->GetNPoints();
    dim = mesh->Dimension();
    MFEM_VERIFY(dim == 2 || dim == 3, "");
 
    ne = fes.GetNE();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS);
-   mapsC = &el->GetDofToQuad(*ir, DofToQuad::TENSOR);
-   mapsO = &el->GetDofToQuadOpen(*ir, DofToQuad::TENSOR);
-   dofs1D = mapsC->ndof;
-   quad1D = mapsC->nqpt;
+   if (el)
+   {
+      mapsC = &el->GetDofToQuad(*ir, DofToQuad::TENSOR);
+      mapsO = &el->GetDofToQuadOpen(*ir, DofToQuad::TENSOR);
+      dofs1D = mapsC->ndof;
+      quad1D = mapsC->nqpt;
+      simplex_ndof = 0;
 
-   MFEM_VERIFY(dofs1D == mapsO->ndof + 1 && quad1D == mapsO->nqpt, "");
+      MFEM_VERIFY(dofs1D == mapsO->ndof + 1 && quad1D == mapsO->nqpt, "");
+   }
+   else
+   {
+      mapsC = mapsO = NULL;
+      dofs1D = quad1D = 0;
+      simplex_ndof = fel->GetDof();
+      PAVectorFESimplexShape(*fel, *ir, mfem::FiniteElement::NONE,
+                             simplex_shape);
+   }
 
    pa_data.SetSize(symmDims * nq * ne, Device::GetMemoryType());
 
@@ -176,36 +356,31 @@ void VectorFEMassIntegrator::AssemblePA(const FiniteElementSpace &fes)
    coeff = 1.0;
    if (Q)
    {
-      for (int e=0; e<ne; ++e)
-      {
-         ElementTransformation *tr = mesh->GetElementTransformation(e);
-         for (int p=0; p<nq; ++p)
-         {
-            coeff[p + (e * nq)] = Q->Eval(*tr, ir->IntPoint(p));
-         }
-      }
+      QuadratureSpace qs(mesh, *ir);
+      QuadratureFunction qf(&qs, coeff.HostWrite());
+      Q->Project(qf);
    }
 
-   fetype = el->GetDerivType();
+   fetype = fel->GetDerivType();
 
-   if (el->GetDerivType() == mfem::FiniteElement::CURL && dim == 3)
+   if (fetype == mfem::FiniteElement::CURL && dim == 3)
    {
-      PAHcurlSetup3D(quad1D, ne, ir->GetWeights(), geom->J,
+      PAHcurlSetup3D(nq, ne, ir->GetWeights(), geom->J,
                      coeff, pa_data);
    }
-   else if (el->GetDerivType() == mfem::FiniteElement::CURL && dim == 2)
+   else if (fetype == mfem::FiniteElement::CURL && dim == 2)
    {
-      PAHcurlSetup2D(quad1D, ne, ir->GetWeights(), geom->J,
+      PAHcurlSetup2D(nq, ne, ir->GetWeights(), geom->J,
                      coeff, pa_data);
    }
-   else if (el->GetDerivType() == mfem::FiniteElement::DIV && dim == 3)
+   else if (fetype == mfem::FiniteElement::DIV && dim == 3)
    {
-      PAHdivSetup3D(quad1D, ne, ir->GetWeights(), geom->J,
+      PAHdivSetup3D(nq, ne, ir->GetWeights(), geom->J,
                     coeff, pa_data);
    }
-   else if (el->GetDerivType() == mfem::FiniteElement::DIV && dim == 2)
+   else if (fetype == mfem::FiniteElement::DIV && dim == 2)
    {
-      PAHdivSetup2D(quad1D, ne, ir->GetWeights(), geom->J,
+      PAHdivSetup2D(nq, ne, ir->GetWeights(), geom->J,
                     coeff, pa_data);
    }
    else
@@ -216,6 +391,12 @@ void VectorFEMassIntegrator::AssemblePA(const FiniteElementSpace &fes)
 
 void VectorFEMassIntegrator::AssembleDiagonalPA(Vector& diag)
 {
+   if (simplex_ndof > 0)
+   {
+      PAVectorFESimplexAssembleDiagonal(dim, simplex_ndof, nq, ne,
+                                        simplex_shape, pa_data, diag);
+      return;
+   }
    if (dim == 3)
    {
       if (fetype == mfem::FiniteElement::CURL)
@@ -254,6 +435,12 @@ void VectorFEMassIntegrator::AssembleDiagonalPA(Vector& diag)
 
 void VectorFEMassIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
+   if (simplex_ndof > 0)
+   {
+      PAVectorFESimplexApply(dim, simplex_ndof, nq, ne, simplex_shape,
+                             pa_data, x, y);
+      return;
+   }
    if (dim == 3)
    {
       if (fetype == mfem::FiniteElement::CURL)
@@ -335,25 +522,20 @@ void MixedVectorGradientIntegrator::AssemblePA(const FiniteElementSpace
    coeff = 1.0;
    if (Q)
    {
-      for (int e=0; e<ne; ++e)
-      {
-         ElementTransformation *tr = mesh->GetElementTransformation(e);
-         for (int p=0; p<nq; ++p)
-         {
-            coeff[p + (e * nq)] = Q->Eval(*tr, ir->IntPoint(p));
-         }
-      }
+      QuadratureSpace qs(mesh, *ir);
+      QuadratureFunction qf(&qs, coeff.HostWrite());
+      Q->Project(qf);
    }
 
    // Use the same setup functions as VectorFEMassIntegrator.
    if (test_el->GetDerivType() == mfem::FiniteElement::CURL && dim == 3)
    {
-      PAHcurlSetup3D(quad1D, ne, ir->GetWeights(), geom->J,
+      PAHcurlSetup3D(nq, ne, ir->GetWeights(), geom->J,
                      coeff, pa_data);
    }
    else if (test_el->GetDerivType() == mfem::FiniteElement::CURL && dim == 2)
    {
-      PAHcurlSetup2D(quad1D, ne, ir->GetWeights(), geom->J,
+      PAHcurlSetup2D(nq, ne, ir->GetWeights(), geom->J,
                      coeff, pa_data);
    }
    else
@@ -21,6 +21,95 @@ namespace mfem
 
 using namespace std;
 
+// Check if the QuadratureInterpolator can evaluate functions from the space
+// @a fes (or a linear nodal space, when @a fes is NULL) at the points of @a ir
+// in all elements of @a mesh.
+static bool CanInterpolate(const Mesh &mesh, const FiniteElementSpace *fes,
+                           const IntegrationRule &ir)
+{
+   const int dim = mesh.Dimension();
+   if (mesh.GetNE() == 0 || (dim != 2 && dim != 3)) { return false; }
+   const int max_n = (dim == 2) ? 100 : 1000;
+   if (ir.GetNPoints() > max_n) { return false; }
+   if (fes == NULL) { return true; }
+   if (fes->GetMesh() != &mesh || fes->GetNURBSext()) { return false; }
+   const FiniteElement *fe = fes->GetFE(0);
+   const int vdim = fes->GetVDim();
+   return (fe->GetRangeType() == FiniteElement::SCALAR &&
+           fe->GetMapType() == FiniteElement::VALUE &&
+           fe->GetDof() <= max_n &&
+           (vdim == 1 || vdim == dim || (dim == 2 && vdim == 3)));
+}
+
+// Interpolate the GridFunction @a gf at the quadrature points of @a qs with the
+// layout (NQ x VDIM x NE). Returns false if this cannot be done in batch.
+static bool InterpolateGridFunction(const GridFunction &gf,
+                                    const QuadratureSpace &qs, Vector &q_val)
+{
+   const FiniteElementSpace &fes = *gf.FESpace();
+   const IntegrationRule *ir = qs.GetUniformIntRule();
+   if (ir == NULL || !CanInterpolate(*qs.GetMesh(), &fes, *ir))
+   {
+      return false;
+   }
+   const ElementDofOrdering ordering = ElementDofOrdering::NATIVE;
+   const Operator *R = fes.GetElementRestriction(ordering);
+   Vector e_vec(R->Height());
+   R->Mult(gf, e_vec);
+
+   const QuadratureInterpolator *qi = fes.GetQuadratureInterpolator(*ir);
+   const QVectorLayout q_layout = qi->GetOutputLayout();
+   qi->SetOutputLayout(QVectorLayout::byNODES);
+   Vector empty;
+   q_val.SetSize(ir->GetNPoints()*fes.GetVDim()*fes.GetNE());
+   qi->Mult(e_vec, QuadratureInterpolator::VALUES, q_val, empty, empty);
+   qi->SetOutputLayout(q_layout);
+   return true;
+}
+
+// Compute in @a X the physical coordinates of the quadrature points of @a qs
+// with the layout (NQ x SDIM x NE). Returns false if this cannot be done in
+// batch. The coordinates are interpolated from the current nodes or vertices
+// of the mesh, so they follow its motion, and the mesh is not modified.
+static bool GetPhysicalCoordinates(const QuadratureSpace &qs, Vector &X)
+{
+   Mesh &mesh = *qs.GetMesh();
+   const GridFunction *nodes = mesh.GetNodes();
+   if (nodes) { return InterpolateGridFunction(*nodes, qs, X); }
+
+   const IntegrationRule *ir = qs.GetUniformIntRule();
+   if (ir == NULL || !CanInterpolate(mesh, NULL, *ir)) { return false; }
+   // Cached by the QuadratureSpace for meshes without nodes
+   X = qs.GetVertexCoordinates();
+   return true;
+}
+
+void Coefficient::Project(QuadratureFunction &qf)
+{
+   MFEM_VERIFY(qf.GetVDim() == 1,
+               "invalid QuadratureFunction vector dimension");
+   Mesh &mesh = *qf.GetSpace()->GetMesh();
+   double *q = qf.HostWrite();
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      ElementTransformation &T = *mesh.GetElementTransformation(e);
+      const IntegrationRule &ir = qf.GetElementIntRule(e);
+      for (int i = 0; i < ir.GetNPoints(); i++)
+      {
+         const IntegrationPoint &ip = ir.IntPoint(i);
+         T.SetIntPoint(&ip);
+         *(q++) = Eval(T, ip);
+      }
+   }
+}
+
+void ConstantCoefficient::Project(QuadratureFunction &qf)
+{
+   MFEM_VERIFY(qf.GetVDim() == 1,
+               "invalid QuadratureFunction vector dimension");
+   qf = constant;
+}
+
 double PWConstCoefficient::Eval(ElementTransformation & T,
                                 const IntegrationPoint & ip)
 {
@@ -28,6 +117,20 @@ double PWConstCoefficient::Eval(ElementTransformation & T,
    return (constants(att-1));
 }
 
+void PWConstCoefficient::Project(QuadratureFunction &qf)
+{
+   MFEM_VERIFY(qf.GetVDim() == 1,
+               "invalid QuadratureFunction vector dimension");
+   Mesh &mesh = *qf.GetSpace()->GetMesh();
+   double *q = qf.HostWrite();
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      const double c = constants(mesh.GetAttribute(e)-1);
+      const int nq = qf.GetElementIntRule(e).GetNPoints();
+      for (int i = 0; i < nq; i++) { *(q++) = c; }
+   }
+}
+
 double FunctionCoefficient::Eval(ElementTransformation & T,
                                  const IntegrationPoint & ip)
 {
@@ -46,12 +149,63 @@ double FunctionCoefficient::Eval(ElementTransformation & T,
    }
 }
 
+void FunctionCoefficient::Project(QuadratureFunction &qf)
+{
+   MFEM_VERIFY(qf.GetVDim() == 1,
+               "invalid QuadratureFunction vector dimension");
+   Vector X;
+   if (!GetPhysicalCoordinates(*qf.GetSpace(), X))
+   {
+      Coefficient::Project(qf);
+      return;
+   }
+
+   const Mesh &mesh = *qf.GetSpace()->GetMesh();
+   const int NE = mesh.GetNE();
+   const int SDIM = mesh.SpaceDimension();
+   const int NQ = qf.GetSpace()->GetUniformIntRule()->GetNPoints();
+   const auto x = Reshape(X.HostRead(), NQ, SDIM, NE);
+   auto q = Reshape(qf.HostWrite(), NQ, NE);
+   double xq[3];
+   Vector transip(xq, SDIM);
+   for (int e = 0; e < NE; e++)
+   {
+      for (int i = 0; i < NQ; i++)
+      {
+         for (int d = 0; d < SDIM; d++) { xq[d] = x(i,d,e); }
+         q(i,e) = Function ? (*Function)(transip) :
+                  (*TDFunction)(transip, GetTime());
+      }
+   }
+}
+
 double GridFunctionCoefficient::Eval (ElementTransformation &T,
                                       const IntegrationPoint &ip)
 {
    return GridF -> GetValue (T, ip, Component);
 }
 
+void GridFunctionCoefficient::Project(QuadratureFunction &qf)
+{
+   MFEM_VERIFY(qf.GetVDim() == 1,
+               "invalid QuadratureFunction vector dimension");
+   Vector q_val;
+   if (!InterpolateGridFunction(*GridF, *qf.GetSpace(), q_val))
+   {
+      Coefficient::Project(qf);
+      return;
+   }
+   const int NE = GridF->FESpace()->GetNE();
+   const int VDIM = GridF->FESpace()->GetVDim();
+   const int NQ = qf.GetSpace()->GetUniformIntRule()->GetNPoints();
+   const auto v = Reshape(q_val.HostRead(), NQ, VDIM, NE);
+   auto q = Reshape(qf.HostWrite(), NQ, NE);
+   for (int e = 0; e < NE; e++)
+   {
+      for (int i = 0; i < NQ; i++) { q(i,e) = v(i,Component-1,e); }
+   }
+}
+
 double TransformedCoefficient::Eval(ElementTransformation &T,
                                     const IntegrationPoint &ip)
 {
@@ -101,6 +255,33 @@ void VectorCoefficient::Eval(DenseMatrix &M, ElementTransformation &T,
    }
 }
 
+void VectorCoefficient::Project(QuadratureFunction &qf)
+{
+   MFEM_VERIFY(qf.GetVDim() == vdim,
+               "invalid QuadratureFunction vector dimension");
+   Mesh &mesh = *qf.GetSpace()->GetMesh();
+   double *q = qf.HostWrite();
+   DenseMatrix M;
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      ElementTransformation &T = *mesh.GetElementTransformation(e);
+      Eval(M, T, qf.GetElementIntRule(e));
+      for (int i = 0; i < M.Height()*M.Width(); i++) { *(q++) = M.Data()[i]; }
+   }
+}
+
+void VectorConstantCoefficient::Project(QuadratureFunction &qf)
+{
+   MFEM_VERIFY(qf.GetVDim() == vdim,
+               "invalid QuadratureFunction vector dimension");
+   const int NQ = qf.GetSpace()->GetSize();
+   auto q = Reshape(qf.HostWrite(), vdim, NQ);
+   for (int i = 0; i < NQ; i++)
+   {
+      for (int d = 0; d < vdim; d++) { q(d,i) = vec(d); }
+   }
+}
+
 void VectorFunctionCoefficient::Eval(Vector &V, ElementTransformation &T,
                                      const IntegrationPoint &ip)
 {
@@ -124,6 +305,53 @@ void VectorFunctionCoefficient::Eval(Vector &V, ElementTransformation &T,
    }
 }
 
+void VectorFunctionCoefficient::Project(QuadratureFunction &qf)
+{
+   MFEM_VERIFY(qf.GetVDim() == vdim,
+               "invalid QuadratureFunction vector dimension");
+   Vector X;
+   if (!GetPhysicalCoordinates(*qf.GetSpace(), X))
+   {
+      VectorCoefficient::Project(qf);
+      return;
+   }
+
+   const Mesh &mesh = *qf.GetSpace()->GetMesh();
+   const int NE = mesh.GetNE();
+   const int SDIM = mesh.SpaceDimension();
+   const int NQ = qf.GetSpace()->GetUniformIntRule()->GetNPoints();
+   const auto x = Reshape(X.HostRead(), NQ, SDIM, NE);
+   double *q = qf.HostWrite();
+   double xq[3];
+   Vector transip(xq, SDIM), V;
+   for (int e = 0; e < NE; e++)
+   {
+      for (int i = 0; i < NQ; i++)
+      {
+         for (int d = 0; d < SDIM; d++) { xq[d] = x(i,d,e); }
+         V.NewDataAndSize(q + vdim*(i + NQ*e), vdim);
+         if (Function)
+         {
+            (*Function)(transip, V);
+         }
+         else
+         {
+            (*TDFunction)(transip, GetTime(), V);
+         }
+      }
+   }
+   if (Q)
+   {
+      QuadratureFunction qq(qf.GetSpace());
+      Q->Project(qq);
+      const double *w = qq.HostRead();
+      for (int i = 0; i < qq.Size(); i++)
+      {
+         for (int d = 0; d < vdim; d++) { q[d + vdim*i] *= w[i]; }
+      }
+   }
+}
+
 VectorArrayCoefficient::VectorArrayCoefficient (int dim)
    : VectorCoefficient(dim), Coeff(dim), ownCoeff(dim)
 {
@@ -191,6 +419,30 @@ GradientGridFunctionCoefficient::GradientGridFunctionCoefficient (
    GridFunc = gf;
 }
 
+void VectorGridFunctionCoefficient::Project(QuadratureFunction &qf)
+{
+   MFEM_VERIFY(qf.GetVDim() == vdim,
+               "invalid QuadratureFunction vector dimension");
+   Vector q_val;
+   if (!InterpolateGridFunction(*GridFunc, *qf.GetSpace(), q_val))
+   {
+      VectorCoefficient::Project(qf);
+      return;
+   }
+   // Transpose from (NQ x VDIM x NE) to the (VDIM x NQ x NE) layout of qf
+   const int NE = GridFunc->FESpace()->GetNE();
+   const int NQ = qf.GetSpace()->GetUniformIntRule()->GetNPoints();
+   const auto v = Reshape(q_val.HostRead(), NQ, vdim, NE);
+   auto q = Reshape(qf.HostWrite(), vdim, NQ, NE);
+   for (int e = 0; e < NE; e++)
+   {
+      for (int i = 0; i < NQ; i++)
+      {
+         for (int d = 0; d < vdim; d++) { q(d,i,e) = v(i,d,e); }
+      }
+   }
+}
+
 void GradientGridFunctionCoefficient::SetGridFunction(const GridFunction *gf)
 {
    GridFunc = gf; vdim = (gf) ?
@@ -285,6 +537,41 @@ void VectorRestrictedCoefficient::Eval(
    }
 }
 
+void MatrixCoefficient::Project(QuadratureFunction &qf)
+{
+   MFEM_VERIFY(qf.GetVDim() == height*width,
+               "invalid QuadratureFunction vector dimension");
+   Mesh &mesh = *qf.GetSpace()->GetMesh();
+   double *q = qf.HostWrite();
+   DenseMatrix K;
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      ElementTransformation &T = *mesh.GetElementTransformation(e);
+      const IntegrationRule &ir = qf.GetElementIntRule(e);
+      for (int i = 0; i < ir.GetNPoints(); i++)
+      {
+         const IntegrationPoint &ip = ir.IntPoint(i);
+         T.SetIntPoint(&ip);
+         K.SetSize(height, width);
+         Eval(K, T, ip);
+         for (int j = 0; j < height*width; j++) { *(q++) = K.Data()[j]; }
+      }
+   }
+}
+
+void MatrixConstantCoefficient::Project(QuadratureFunction &qf)
+{
+   const int hw = height*width;
+   MFEM_VERIFY(qf.GetVDim() == hw,
+               "invalid QuadratureFunction vector dimension");
+   const int NQ = qf.GetSpace()->GetSize();
+   auto q = Reshape(qf.HostWrite(), hw, NQ);
+   for (int i = 0; i < NQ; i++)
+   {
+      for (int j = 0; j < hw; j++) { q(j,i) = mat.Data()[j]; }
+   }
+}
+
 void MatrixFunctionCoefficient::Eval(DenseMatrix &K, ElementTransformation &T,
                                      const IntegrationPoint &ip)
 {
@@ -313,6 +600,56 @@ void MatrixFunctionCoefficient::Eval(DenseMatrix &K, ElementTransformation &T,
    }
 }
 
+void MatrixFunctionCoefficient::Project(QuadratureFunction &qf)
+{
+   const int hw = height*width;
+   MFEM_VERIFY(qf.GetVDim() == hw,
+               "invalid QuadratureFunction vector dimension");
+   Vector X;
+   if ((!Function && !TDFunction) ||
+       !GetPhysicalCoordinates(*qf.GetSpace(), X))
+   {
+      MatrixCoefficient::Project(qf);
+      return;
+   }
+
+   const Mesh &mesh = *qf.GetSpace()->GetMesh();
+   const int NE = mesh.GetNE();
+   const int SDIM = mesh.SpaceDimension();
+   const int NQ = qf.GetSpace()->GetUniformIntRule()->GetNPoints();
+   const auto x = Reshape(X.HostRead(), NQ, SDIM, NE);
+   double *q = qf.HostWrite();
+   double xq[3];
+   Vector transip(xq, SDIM);
+   DenseMatrix K;
+   for (int e = 0; e < NE; e++)
+   {
+      for (int i = 0; i < NQ; i++)
+      {
+         for (int d = 0; d < SDIM; d++) { xq[d] = x(i,d,e); }
+         K.UseExternalData(q + hw*(i + NQ*e), height, width);
+         if (Function)
+         {
+            (*Function)(transip, K);
+         }
+         else
+         {
+            (*TDFunction)(transip, GetTime(), K);
+         }
+      }
+   }
+   if (Q)
+   {
+      QuadratureFunction qq(qf.GetSpace());
+      Q->Project(qq);
+      const double *w = qq.HostRead();
+      for (int i = 0; i < qq.Size(); i++)
+      {
+         for (int j = 0; j < hw; j++) { q[j + hw*i] *= w[i]; }
+      }
+   }
+}
+
 MatrixArrayCoefficient::MatrixArrayCoefficient (int dim)
    : MatrixCoefficient (dim)
 {
@@ -21,6 +21,7 @@ namespace mfem
 {
 
 class Mesh;
+class QuadratureFunction;
 
 #ifdef MFEM_USE_MPI
 class ParMesh;
@@ -59,6 +60,15 @@ public:
       return Eval(T, ip);
    }
 
+   /** @brief Evaluate the coefficient at all quadrature points of the
+       QuadratureSpace of @a qf, storing the result in @a qf. */
+   /** The vector dimension of @a qf must be 1.
+
+       The general implementation provided by the base class (using the Eval
+       method for one IntegrationPoint at a time) can be overloaded for a more
+       efficient implementation that processes all elements at once. */
+   virtual void Project(QuadratureFunction &qf);
+
    virtual ~Coefficient() { }
 };
 
@@ -76,6 +86,9 @@ public:
    virtual double Eval(ElementTransformation &T,
                        const IntegrationPoint &ip)
    { return (constant); }
+
+   /// Set all values of @a qf to the constant
+   virtual void Project(QuadratureFunction &qf);
 };
 
 /// class for piecewise constant coefficient
@@ -110,6 +123,9 @@ public:
    /// Evaluate the coefficient function
    virtual double Eval(ElementTransformation &T,
                        const IntegrationPoint &ip);
+
+   /// Set the values of @a qf element by element, based on the attributes
+   virtual void Project(QuadratureFunction &qf);
 };
 
 
@@ -156,6 +172,10 @@ public:
    /// Evaluate coefficient
    virtual double Eval(ElementTransformation &T,
                        const IntegrationPoint &ip);
+
+   /** @brief Evaluate the C-function at the physical coordinates of all
+       quadrature points, computed with Mesh::GetGeometricFactors(). */
+   virtual void Project(QuadratureFunction &qf);
 };
 
 class GridFunction;
@@ -179,6 +199,10 @@ public:
 
    virtual double Eval(ElementTransformation &T,
                        const IntegrationPoint &ip);
+
+   /** @brief Interpolate the GridFunction at all quadrature points, using the
+       QuadratureInterpolator when possible. */
+   virtual void Project(QuadratureFunction &qf);
 };
 
 class TransformedCoefficient : public Coefficient
@@ -315,6 +339,15 @@ public:
    virtual void Eval(DenseMatrix &M, ElementTransformation &T,
                      const IntegrationRule &ir);
 
+   /** @brief Evaluate the vector coefficient at all quadrature points of the
+       QuadratureSpace of @a qf, storing the result in @a qf. */
+   /** The vector dimension of @a qf must be equal to GetVDim().
+
+       The general implementation provided by the base class (using the Eval
+       method for one IntegrationRule at a time) can be overloaded for a more
+       efficient implementation that processes all elements at once. */
+   virtual void Project(QuadratureFunction &qf);
+
    virtual ~VectorCoefficient() { }
 };
 
@@ -328,6 +361,8 @@ public:
    using VectorCoefficient::Eval;
    virtual void Eval(Vector &V, ElementTransformation &T,
                      const IntegrationPoint &ip) { V = vec; }
+   /// Set all values of @a qf to the constant vector
+   virtual void Project(QuadratureFunction &qf);
    const Vector& GetVec() { return vec; }
 };
 
@@ -362,6 +397,10 @@ public:
    virtual void Eval(Vector &V, ElementTransformation &T,
                      const IntegrationPoint &ip);
 
+   /** @brief Evaluate the C-function at the physical coordinates of all
+       quadrature points, computed with Mesh::GetGeometricFactors(). */
+   virtual void Project(QuadratureFunction &qf);
+
    virtual ~VectorFunctionCoefficient() { }
 };
 
@@ -415,6 +454,10 @@ public:
    virtual void Eval(DenseMatrix &M, ElementTransformation &T,
                      const IntegrationRule &ir);
 
+   /** @brief Interpolate the GridFunction at all quadrature points, using the
+       QuadratureInterpolator when possible. */
+   virtual void Project(QuadratureFunction &qf);
+
    virtual ~VectorGridFunctionCoefficient() { }
 };
 
@@ -570,6 +613,16 @@ public:
    virtual void Eval(DenseMatrix &K, ElementTransformation &T,
                      const IntegrationPoint &ip) = 0;
 
+   /** @brief Evaluate the matrix coefficient at all quadrature points of the
+       QuadratureSpace of @a qf, storing the result in @a qf. */
+   /** The vector dimension of @a qf must be GetHeight()*GetWidth() and each
+       matrix is stored in column-major order.
+
+       The general implementation provided by the base class (using the Eval
+       method for one IntegrationPoint at a time) can be overloaded for a more
+       efficient implementation that processes all elements at once. */
+   virtual void Project(QuadratureFunction &qf);
+
    virtual ~MatrixCoefficient() { }
 };
 
@@ -583,6 +636,8 @@ public:
    using MatrixCoefficient::Eval;
    virtual void Eval(DenseMatrix &M, ElementTransformation &T,
                      const IntegrationPoint &ip) { M = mat; }
+   /// Set all values of @a qf to the constant matrix
+   virtual void Project(QuadratureFunction &qf);
 };
 
 class MatrixFunctionCoefficient : public MatrixCoefficient
@@ -627,6 +682,10 @@ public:
    virtual void Eval(DenseMatrix &K, ElementTransformation &T,
                      const IntegrationPoint &ip);
 
+   /** @brief Evaluate the C-function at the physical coordinates of all
+       quadrature points, computed with Mesh::GetGeometricFactors(). */
+   virtual void Project(QuadratureFunction &qf);
+
    virtual ~MatrixFunctionCoefficient() { }
 };
 
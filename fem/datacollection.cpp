@@ -16,6 +16,10 @@
 #include "picojson.h"
 
 #include <cerrno>      // errno
+#include <cstring>     // std::memcpy
+#include <climits>     // INT_MAX
+#include <algorithm>   // std::min
+#include <iterator>    // std::istreambuf_iterator
 #include <sstream>
 
 #ifndef _WIN32
@@ -724,6 +728,865 @@ void VisItDataCollection::ParseVisItRootString(const std::string& json)
    }
 }
 
+// class CheckpointDataCollection implementation
+
+// Helper functions for the binary records of CheckpointDataCollection. Each
+// record contains the local part of the mesh (elements, boundary elements and
+// vertices with global vertex numbers) followed by the values of the nodes and
+// the fields, element by element.
+
+template <typename T>
+static void AppendArray(std::vector<char> &buf, const T *data, int n)
+{
+   const char *ptr = reinterpret_cast<const char*>(data);
+   buf.insert(buf.end(), ptr, ptr + n*sizeof(T));
+}
+
+template <typename T>
+static void ReadArray(const char *&pos, const char *end, T *data, int n)
+{
+   const size_t nbytes = n*sizeof(T);
+   MFEM_VERIFY(pos + nbytes <= end, "invalid checkpoint data");
+   std::memcpy(data, pos, nbytes);
+   pos += nbytes;
+}
+
+static void AppendElements(const Mesh &mesh, bool bdr,
+                           const Array<int> &vert_num, std::vector<char> &buf)
+{
+   const int ne = bdr ? mesh.GetNBE() : mesh.GetNE();
+   Array<int> geom(ne), attr(ne), vert;
+   for (int i = 0; i < ne; i++)
+   {
+      const Element *el = bdr ? mesh.GetBdrElement(i) : mesh.GetElement(i);
+      geom[i] = el->GetGeometryType();
+      attr[i] = el->GetAttribute();
+      const int *v = el->GetVertices();
+      for (int j = 0; j < el->GetNVertices(); j++)
+      {
+         vert.Append(vert_num[v[j]]);
+      }
+   }
+   AppendArray(buf, geom.GetData(), ne);
+   AppendArray(buf, attr.GetData(), ne);
+   AppendArray(buf, vert.GetData(), vert.Size());
+}
+
+static void ReadElements(const char *&pos, const char *end, int ne, bool bdr,
+                         Mesh &mesh)
+{
+   Array<int> geom(ne), attr(ne);
+   ReadArray(pos, end, geom.GetData(), ne);
+   ReadArray(pos, end, attr.GetData(), ne);
+   for (int i = 0; i < ne; i++)
+   {
+      MFEM_VERIFY(geom[i] >= 0 && geom[i] < Geometry::NumGeom,
+                  "invalid checkpoint data");
+      Element *el = mesh.NewElement(geom[i]);
+      ReadArray(pos, end, el->GetVertices(), el->GetNVertices());
+      el->SetAttribute(attr[i]);
+      if (bdr) { mesh.AddBdrElement(el); }
+      else { mesh.AddElement(el); }
+   }
+}
+
+static void AppendElementValues(const GridFunction &gf, std::vector<char> &buf)
+{
+   const FiniteElementSpace *fes = gf.FESpace();
+   Array<int> vdofs;
+   Vector values;
+   gf.HostRead();
+   for (int i = 0; i < fes->GetNE(); i++)
+   {
+      fes->GetElementVDofs(i, vdofs);
+      gf.GetSubVector(vdofs, values);
+      AppendArray(buf, values.GetData(), values.Size());
+   }
+}
+
+static void ReadElementValues(const char *&pos, const char *end,
+                              int elem_offset, int ne, GridFunction &gf)
+{
+   const FiniteElementSpace *fes = gf.FESpace();
+   Array<int> vdofs;
+   Vector values;
+   for (int i = 0; i < ne; i++)
+   {
+      fes->GetElementVDofs(elem_offset + i, vdofs);
+      values.SetSize(vdofs.Size());
+      ReadArray(pos, end, values.GetData(), values.Size());
+      gf.SetSubVector(vdofs, values);
+   }
+}
+
+// Description of a grid function in the index file of the collection
+struct CheckpointFieldInfo
+{
+   std::string name, fec_name;
+   int vdim, ordering;
+};
+
+// Create a grid function described by @a info on @a mesh. On a ParMesh, the
+// result is a ParGridFunction.
+static GridFunction *NewCheckpointField(Mesh *mesh,
+                                        const CheckpointFieldInfo &info)
+{
+   FiniteElementCollection *fec =
+      FiniteElementCollection::New(info.fec_name.c_str());
+   GridFunction *gf;
+#ifdef MFEM_USE_MPI
+   ParMesh *pmesh = dynamic_cast<ParMesh*>(mesh);
+   if (pmesh)
+   {
+      ParFiniteElementSpace *pfes =
+         new ParFiniteElementSpace(pmesh, fec, info.vdim, info.ordering);
+      gf = new ParGridFunction(pfes);
+   }
+   else
+#endif
+   {
+      FiniteElementSpace *fes = new FiniteElementSpace(mesh, fec, info.vdim,
+                                                       info.ordering);
+      gf = new GridFunction(fes);
+   }
+   gf->MakeOwner(fec);
+   return gf;
+}
+
+// Reconstruct the global mesh and its nodes from the records [rec_begin[r],
+// rec_end[r]), keeping the element order of the records. On return,
+// rec_begin[r] points to the field values of the record r, whose elements
+// are in the range [elem_offset[r], elem_offset[r+1]).
+static Mesh *ReadCheckpointMesh(int dim, int sdim, int num_vertices,
+                                const CheckpointFieldInfo &nodes_info,
+                                Array<const char*> &rec_begin,
+                                const Array<const char*> &rec_end,
+                                Array<int> &elem_offset)
+{
+   const int nrecs = rec_begin.Size();
+   int num_elem = 0, num_bdr_elem = 0;
+   Array<int> counts(3*nrecs);
+   for (int r = 0; r < nrecs; r++)
+   {
+      const char *pos = rec_begin[r];
+      ReadArray(pos, rec_end[r], &counts[3*r], 3);
+      num_elem += counts[3*r];
+      num_bdr_elem += counts[3*r+1];
+   }
+
+   Mesh *gmesh = new Mesh(dim, num_vertices, num_elem, num_bdr_elem, sdim);
+   Vector coord(num_vertices*sdim);
+   Array<int> vert_num;
+   elem_offset.SetSize(nrecs + 1);
+   elem_offset[0] = 0;
+   for (int r = 0; r < nrecs; r++)
+   {
+      const char *pos = rec_begin[r] + 3*sizeof(int);
+      ReadElements(pos, rec_end[r], counts[3*r], false, *gmesh);
+      ReadElements(pos, rec_end[r], counts[3*r+1], true, *gmesh);
+      vert_num.SetSize(counts[3*r+2]);
+      ReadArray(pos, rec_end[r], vert_num.GetData(), vert_num.Size());
+      for (int i = 0; i < vert_num.Size(); i++)
+      {
+         MFEM_VERIFY(vert_num[i] >= 0 && vert_num[i] < num_vertices,
+                     "invalid checkpoint data");
+         ReadArray(pos, rec_end[r], &coord(vert_num[i]*sdim), sdim);
+      }
+      elem_offset[r+1] = elem_offset[r] + counts[3*r];
+      rec_begin[r] = pos; // the nodes and the fields follow
+   }
+   for (int i = 0; i < num_vertices; i++)
+   {
+      gmesh->AddVertex(&coord(i*sdim));
+   }
+   // Keep the vertex order of the elements, since the fields are stored in
+   // the element-local dof order.
+   gmesh->FinalizeTopology();
+   gmesh->Finalize(false, false);
+
+   if (nodes_info.fec_name != "none")
+   {
+      GridFunction *nodes = NewCheckpointField(gmesh, nodes_info);
+      for (int r = 0; r < nrecs; r++)
+      {
+         ReadElementValues(rec_begin[r], rec_end[r], elem_offset[r],
+                           counts[3*r], *nodes);
+      }
+      gmesh->NewNodes(*nodes, true);
+   }
+   return gmesh;
+}
+
+#ifdef MFEM_USE_MPI
+static void SkipBytes(const char *&pos, const char *end, long long nbytes)
+{
+   MFEM_VERIFY(nbytes <= end - pos, "invalid checkpoint data");
+   pos += nbytes;
+}
+
+// Number of values of a grid function with collection @a fec and vector
+// dimension @a vdim in an element of geometry @a geom.
+static int ElementValuesSize(const FiniteElementCollection &fec, int vdim,
+                             int geom)
+{
+   const FiniteElement *fe =
+      fec.FiniteElementForGeometry(Geometry::Type(geom));
+   MFEM_VERIFY(fe, "invalid checkpoint data");
+   return vdim*fe->GetDof();
+}
+
+// Advance @a pos from the beginning of a record to its field values, i.e. skip
+// the mesh and its nodes, which use @a nodes_fec, if not NULL. Returns the
+// geometries of the elements of the record in @a geom.
+static void SkipRecordMesh(const char *&pos, const char *end, int sdim,
+                           const FiniteElementCollection *nodes_fec,
+                           int nodes_vdim, Array<int> &geom)
+{
+   int counts[3];
+   ReadArray(pos, end, counts, 3);
+   Array<int> bdr_geom;
+   for (int bdr = 0; bdr < 2; bdr++)
+   {
+      Array<int> &g = bdr ? bdr_geom : geom;
+      g.SetSize(counts[bdr]);
+      ReadArray(pos, end, g.GetData(), g.Size());
+      long long nv = 0;
+      for (int i = 0; i < g.Size(); i++)
+      {
+         MFEM_VERIFY(g[i] >= 0 && g[i] < Geometry::NumGeom,
+                     "invalid checkpoint data");
+         nv += Geometry::NumVerts[g[i]];
+      }
+      SkipBytes(pos, end, (g.Size() + nv)*sizeof(int)); // attributes, vertices
+   }
+   SkipBytes(pos, end, counts[2]*(sizeof(int) + sdim*sizeof(double)));
+   if (nodes_fec)
+   {
+      for (int i = 0; i < geom.Size(); i++)
+      {
+         SkipBytes(pos, end, sizeof(double)*
+                   ElementValuesSize(*nodes_fec, nodes_vdim, geom[i]));
+      }
+   }
+}
+
+static void BcastBytes(std::vector<char> &buf, MPI_Comm comm)
+{
+   long long size = buf.size();
+   MPI_Bcast(&size, 1, MPI_LONG_LONG, 0, comm);
+   buf.resize(size);
+   const long long chunk = 1 << 30;
+   for (long long pos = 0; pos < size; pos += chunk)
+   {
+      MPI_Bcast(&buf[pos], (int) std::min(chunk, size - pos), MPI_BYTE, 0,
+                comm);
+   }
+}
+
+// Send and receive a buffer of @a size bytes in chunks, as in BcastBytes().
+static void SendBytes(const char *buf, long long size, int dest, int tag,
+                      MPI_Comm comm)
+{
+   const long long chunk = 1 << 30;
+   for (long long pos = 0; pos < size; pos += chunk)
+   {
+      MPI_Send(const_cast<char*>(buf + pos), (int) std::min(chunk, size - pos),
+               MPI_BYTE, dest, tag, comm);
+   }
+}
+
+static void RecvBytes(char *buf, long long size, int source, int tag,
+                      MPI_Comm comm)
+{
+   const long long chunk = 1 << 30;
+   for (long long pos = 0; pos < size; pos += chunk)
+   {
+      MPI_Recv(buf + pos, (int) std::min(chunk, size - pos), MPI_BYTE, source,
+               tag, comm, MPI_STATUS_IGNORE);
+   }
+}
+#endif
+
+CheckpointDataCollection::CheckpointDataCollection(
+   const std::string& collection_name, Mesh *mesh_)
+   : DataCollection(collection_name, mesh_), ranks_per_file(64)
+{
+   cycle = 0; // always include cycle in directory names
+}
+
+#ifdef MFEM_USE_MPI
+CheckpointDataCollection::CheckpointDataCollection(
+   MPI_Comm comm, const std::string& collection_name, Mesh *mesh_)
+   : DataCollection(collection_name, mesh_), ranks_per_file(64)
+{
+   m_comm = comm;
+   MPI_Comm_rank(comm, &myid);
+   MPI_Comm_size(comm, &num_procs);
+   cycle = 0; // always include cycle in directory names
+}
+#endif
+
+void CheckpointDataCollection::SetRanksPerFile(int nranks)
+{
+   MFEM_VERIFY(nranks > 0, "invalid number of ranks per file: " << nranks);
+   ranks_per_file = nranks;
+}
+
+std::string CheckpointDataCollection::GetCheckpointDirName() const
+{
+   std::string dir_name = prefix_path + name;
+   if (cycle != -1)
+   {
+      dir_name += "_" + to_padded_string(cycle, pad_digits_cycle);
+   }
+   return dir_name;
+}
+
+int CheckpointDataCollection::GetGlobalVertexNumbers(Array<int> &vert_num)
+const
+{
+   MFEM_VERIFY(mesh->ncmesh == NULL, "non-conforming meshes are not supported");
+   vert_num.SetSize(mesh->GetNV());
+#ifdef MFEM_USE_MPI
+   ParMesh *pmesh = dynamic_cast<ParMesh*>(mesh);
+   if (pmesh)
+   {
+      // The true dofs of a linear H1 space are the global vertices
+      H1_FECollection fec(1, mesh->Dimension());
+      ParFiniteElementSpace pfes(pmesh, &fec);
+      MFEM_VERIFY(pfes.GlobalTrueVSize() <= INT_MAX, "too many vertices");
+      Array<int> dofs;
+      for (int i = 0; i < vert_num.Size(); i++)
+      {
+         pfes.GetVertexDofs(i, dofs);
+         vert_num[i] = (int) pfes.GetGlobalTDofNumber(dofs[0]);
+      }
+      return (int) pfes.GlobalTrueVSize();
+   }
+#endif
+   for (int i = 0; i < vert_num.Size(); i++) { vert_num[i] = i; }
+   return vert_num.Size();
+}
+
+void CheckpointDataCollection::WriteRecord(const Array<int> &vert_num,
+                                           std::vector<char> &record) const
+{
+   const int sdim = mesh->SpaceDimension();
+   int counts[3] = { mesh->GetNE(), mesh->GetNBE(), mesh->GetNV() };
+   record.clear();
+   AppendArray(record, counts, 3);
+
+   AppendElements(*mesh, false, vert_num, record);
+   AppendElements(*mesh, true, vert_num, record);
+
+   AppendArray(record, vert_num.GetData(), counts[2]);
+   for (int i = 0; i < counts[2]; i++)
+   {
+      AppendArray(record, mesh->GetVertex(i), sdim);
+   }
+
+   if (mesh->GetNodes()) { AppendElementValues(*mesh->GetNodes(), record); }
+   for (FieldMapConstIterator it = field_map.begin(); it != field_map.end();
+        ++it)
+   {
+      AppendElementValues(*it->second, record);
+   }
+}
+
+bool CheckpointDataCollection::WriteIndex(const std::string &file_name,
+                                          int num_vertices,
+                                          const std::vector<long long> &sizes)
+const
+{
+   std::ofstream out(file_name.c_str());
+   out.precision(17);
+   out << "MFEM checkpoint v1.0\n"
+       << "dimension " << mesh->Dimension() << '\n'
+       << "space_dimension " << mesh->SpaceDimension() << '\n'
+       << "vertices " << num_vertices << '\n'
+       << "cycle " << cycle << '\n'
+       << "time " << time << '\n'
+       << "time_step " << time_step << '\n';
+
+   const GridFunction *nodes = mesh->GetNodes();
+   out << "nodes ";
+   if (nodes)
+   {
+      const FiniteElementSpace *fes = nodes->FESpace();
+      out << fes->FEColl()->Name() << ' ' << fes->GetVDim() << ' '
+          << fes->GetOrdering() << '\n';
+   }
+   else
+   {
+      out << "none\n";
+   }
+
+   out << "fields " << field_map.NumFields() << '\n';
+   for (FieldMapConstIterator it = field_map.begin(); it != field_map.end();
+        ++it)
+   {
+      const FiniteElementSpace *fes = it->second->FESpace();
+      out << it->first << ' ' << fes->FEColl()->Name() << ' '
+          << fes->GetVDim() << ' ' << fes->GetOrdering() << '\n';
+   }
+
+   // location of the record of each rank: file number, offset and size
+   const int nranks = sizes.size();
+   out << "records " << nranks << '\n';
+   long long offset = 0;
+   for (int r = 0; r < nranks; r++)
+   {
+      if (r % ranks_per_file == 0) { offset = 0; }
+      out << r / ranks_per_file << ' ' << offset << ' ' << sizes[r] << '\n';
+      offset += sizes[r];
+   }
+   return bool(out);
+}
+
+void CheckpointDataCollection::Save()
+{
+   MFEM_VERIFY(mesh && !mesh->NURBSext, "invalid or NURBS mesh");
+
+   const std::string dir_name = GetCheckpointDirName();
+   if (create_directory(dir_name, mesh, myid))
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error creating directory: " << dir_name);
+      return;
+   }
+
+   Array<int> vert_num;
+   const int num_vertices = GetGlobalVertexNumbers(vert_num);
+   std::vector<char> record;
+   WriteRecord(vert_num, record);
+   long long size = record.size();
+
+   const std::string index_name = dir_name + "/index";
+   const std::string data_name = dir_name + "/data.";
+   int err = 0;
+
+#ifdef MFEM_USE_MPI
+   if (!serial)
+   {
+      // Gather the records of each group of ranks to the first rank of the
+      // group, which writes them into a single file.
+      const int group_id = myid / ranks_per_file;
+      MPI_Comm group;
+      MPI_Comm_split(m_comm, group_id, myid, &group);
+      int group_rank, group_size;
+      MPI_Comm_rank(group, &group_rank);
+      MPI_Comm_size(group, &group_size);
+
+      std::vector<long long> group_sizes(group_rank == 0 ? group_size : 0);
+      MPI_Gather(&size, 1, MPI_LONG_LONG, group_sizes.data(), 1,
+                 MPI_LONG_LONG, 0, group);
+
+      std::vector<int> counts, displs;
+      std::vector<char> data;
+      if (group_rank == 0)
+      {
+         counts.resize(group_size);
+         displs.resize(group_size);
+         long long total = 0;
+         for (int r = 0; r < group_size; r++)
+         {
+            counts[r] = (int) group_sizes[r];
+            displs[r] = (int) total;
+            total += group_sizes[r];
+         }
+         MFEM_VERIFY(total <= INT_MAX, "the data of a group of ranks is too "
+                     "large, use fewer ranks per file");
+         data.resize(total);
+      }
+      MPI_Gatherv(record.data(), (int) size, MPI_BYTE, data.data(),
+                  counts.data(), displs.data(), MPI_BYTE, 0, group);
+      MPI_Comm_free(&group);
+
+      if (group_rank == 0)
+      {
+         const std::string file_name =
+            data_name + to_padded_string(group_id, pad_digits_rank);
+         std::ofstream out(file_name.c_str(), std::ios::binary);
+         out.write(data.data(), data.size());
+         err = !out;
+      }
+
+      std::vector<long long> sizes(myid == 0 ? num_procs : 0);
+      MPI_Gather(&size, 1, MPI_LONG_LONG, sizes.data(), 1, MPI_LONG_LONG, 0,
+                 m_comm);
+      if (myid == 0)
+      {
+         err = err || !WriteIndex(index_name, num_vertices, sizes);
+      }
+      MPI_Allreduce(MPI_IN_PLACE, &err, 1, MPI_INT, MPI_MAX, m_comm);
+   }
+   else
+#endif
+   {
+      if (myid == 0)
+      {
+         const std::string file_name =
+            data_name + to_padded_string(0, pad_digits_rank);
+         std::ofstream out(file_name.c_str(), std::ios::binary);
+         out.write(record.data(), record.size());
+         err = !out || !WriteIndex(index_name, num_vertices,
+                                   std::vector<long long>(1, size));
+      }
+   }
+
+   if (err)
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error writing checkpoint: " << dir_name);
+   }
+}
+
+void CheckpointDataCollection::Load(int cycle_)
+{
+   DeleteAll();
+   error = NO_ERROR;
+   cycle = cycle_;
+
+   int comm_rank = 0;
+#ifdef MFEM_USE_MPI
+   int comm_size = 1;
+   if (m_comm != MPI_COMM_NULL)
+   {
+      MPI_Comm_rank(m_comm, &comm_rank);
+      MPI_Comm_size(m_comm, &comm_size);
+   }
+#endif
+
+   // The first rank reads the index
+   const std::string dir_name = GetCheckpointDirName();
+   std::vector<char> index;
+   if (comm_rank == 0)
+   {
+      std::ifstream index_file((dir_name + "/index").c_str());
+      if (!index_file)
+      {
+         error = READ_ERROR;
+         MFEM_WARNING("Unable to open checkpoint index: " << dir_name);
+      }
+      else
+      {
+         index.assign(std::istreambuf_iterator<char>(index_file),
+                      std::istreambuf_iterator<char>());
+      }
+   }
+#ifdef MFEM_USE_MPI
+   if (m_comm != MPI_COMM_NULL)
+   {
+      MPI_Bcast(&error, 1, MPI_INT, 0, m_comm);
+      BcastBytes(index, m_comm);
+   }
+#endif
+   if (error) { return; }
+
+   // Parse the index
+   std::istringstream in(std::string(index.begin(), index.end()));
+   std::string ident;
+   int dim, sdim, num_vertices, nranks;
+   skip_comment_lines(in, '#');
+   std::getline(in, ident);
+   filter_dos(ident);
+   MFEM_VERIFY(ident == "MFEM checkpoint v1.0", "invalid checkpoint index");
+   in >> ident >> dim >> ident >> sdim >> ident >> num_vertices
+      >> ident >> cycle >> ident >> time >> ident >> time_step;
+   CheckpointFieldInfo nodes_info;
+   in >> ident >> nodes_info.fec_name;
+   if (nodes_info.fec_name != "none")
+   {
+      in >> nodes_info.vdim >> nodes_info.ordering;
+   }
+   int nfields;
+   in >> ident >> nfields;
+   std::vector<CheckpointFieldInfo> fields(nfields);
+   for (int i = 0; i < nfields; i++)
+   {
+      in >> fields[i].name >> fields[i].fec_name >> fields[i].vdim
+         >> fields[i].ordering;
+   }
+   in >> ident >> nranks;
+   MFEM_VERIFY(in && nranks > 0, "invalid checkpoint index");
+   Array<int> rec_file(nranks);
+   std::vector<long long> rec_offset(nranks), rec_size(nranks);
+   for (int r = 0; r < nranks; r++)
+   {
+      in >> rec_file[r] >> rec_offset[r] >> rec_size[r];
+      MFEM_VERIFY(r == 0 || rec_file[r] >= rec_file[r-1],
+                  "invalid checkpoint index");
+   }
+   MFEM_VERIFY(in, "invalid checkpoint index");
+
+   // Each rank reads a contiguous range of the data files (all of them
+   // without a communicator), i.e. the records in the range
+   // [rec_first, rec_last).
+   const int num_files = rec_file[nranks-1] + 1;
+   int file_first = 0, file_last = num_files;
+#ifdef MFEM_USE_MPI
+   if (m_comm != MPI_COMM_NULL)
+   {
+      file_first = (int) ((long long) num_files*comm_rank/comm_size);
+      file_last = (int) ((long long) num_files*(comm_rank + 1)/comm_size);
+   }
+#endif
+   int rec_first = 0, rec_last;
+   while (rec_first < nranks && rec_file[rec_first] < file_first) { rec_first++; }
+   for (rec_last = rec_first;
+        rec_last < nranks && rec_file[rec_last] < file_last; rec_last++) { }
+
+   std::vector<char> data;
+   std::vector<long long> rec_start(nranks);
+   long long file_start = 0;
+   for (int r = rec_first; r < rec_last; r++)
+   {
+      if (r == rec_first || rec_file[r] != rec_file[r-1])
+      {
+         const std::string data_name =
+            dir_name + "/data." + to_padded_string(rec_file[r],
+                                                   pad_digits_rank);
+         std::ifstream data_file(data_name.c_str(), std::ios::binary);
+         if (!data_file)
+         {
+            error = READ_ERROR;
+            MFEM_WARNING("Unable to open checkpoint data: " << data_name);
+            break;
+         }
+         file_start = data.size();
+         data.insert(data.end(), std::istreambuf_iterator<char>(data_file),
+                     std::istreambuf_iterator<char>());
+      }
+      rec_start[r] = file_start + rec_offset[r];
+   }
+#ifdef MFEM_USE_MPI
+   if (m_comm != MPI_COMM_NULL)
+   {
+      MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_INT, MPI_MAX, m_comm);
+   }
+#endif
+   if (error) { return; }
+
+   const int num_recs = rec_last - rec_first;
+   Array<const char*> rec_begin(num_recs), rec_end(num_recs);
+   for (int k = 0; k < num_recs; k++)
+   {
+      const int r = rec_first + k;
+      MFEM_VERIFY(rec_start[r] + rec_size[r] <= (long long) data.size(),
+                  "invalid checkpoint data");
+      rec_begin[k] = data.data() + rec_start[r];
+      rec_end[k] = rec_begin[k] + rec_size[r];
+   }
+
+#ifdef MFEM_USE_MPI
+   if (m_comm != MPI_COMM_NULL)
+   {
+      const int tag = 828;
+
+      // Skip the mesh data of the records read by this rank, keeping the
+      // geometries of their elements
+      FiniteElementCollection *nodes_fec = NULL;
+      if (nodes_info.fec_name != "none")
+      {
+         nodes_fec = FiniteElementCollection::New(nodes_info.fec_name.c_str());
+      }
+      Array<int> geom, elem_geom, rec_ne(num_recs);
+      Array<const char*> field_begin(num_recs);
+      std::vector<char> mesh_data;
+      for (int k = 0; k < num_recs; k++)
+      {
+         const char *pos = rec_begin[k];
+         SkipRecordMesh(pos, rec_end[k], sdim, nodes_fec, nodes_info.vdim,
+                        geom);
+         field_begin[k] = pos;
+         rec_ne[k] = geom.Size();
+         elem_geom.Append(geom);
+         mesh_data.insert(mesh_data.end(), rec_begin[k], pos);
+      }
+
+      // The first rank gathers the mesh data, reconstructs the global mesh and
+      // partitions it. Only the parts of the mesh are sent to the other ranks,
+      // see ParMesh::Distribute().
+      long long mesh_size = mesh_data.size();
+      int num_elem = elem_geom.Size();
+      std::vector<long long> mesh_sizes(comm_rank == 0 ? comm_size : 0);
+      std::vector<int> elem_counts(comm_rank == 0 ? comm_size : 0);
+      std::vector<int> elem_displs(comm_rank == 0 ? comm_size : 0);
+      MPI_Gather(&mesh_size, 1, MPI_LONG_LONG, mesh_sizes.data(), 1,
+                 MPI_LONG_LONG, 0, m_comm);
+      MPI_Gather(&num_elem, 1, MPI_INT, elem_counts.data(), 1, MPI_INT, 0,
+                 m_comm);
+
+      ParMesh *pmesh;
+      int *partitioning = NULL;
+      if (comm_rank == 0)
+      {
+         for (int q = 1; q < comm_size; q++)
+         {
+            if (mesh_sizes[q] == 0) { continue; }
+            const size_t pos = mesh_data.size();
+            mesh_data.resize(pos + mesh_sizes[q]);
+            RecvBytes(&mesh_data[pos], mesh_sizes[q], q, tag, m_comm);
+         }
+         Array<const char*> mesh_begin(nranks), mesh_end(nranks);
+         const char *pos = mesh_data.data();
+         for (int r = 0; r < nranks; r++)
+         {
+            mesh_begin[r] = pos;
+            SkipRecordMesh(pos, mesh_data.data() + mesh_data.size(), sdim,
+                           nodes_fec, nodes_info.vdim, geom);
+            mesh_end[r] = pos;
+         }
+         Array<int> elem_offset;
+         Mesh *gmesh = ReadCheckpointMesh(dim, sdim, num_vertices, nodes_info,
+                                          mesh_begin, mesh_end, elem_offset);
+         std::vector<char>().swap(mesh_data);
+
+         partitioning = gmesh->GeneratePartitioning(comm_size);
+         int total = 0;
+         for (int q = 0; q < comm_size; q++)
+         {
+            elem_displs[q] = total;
+            total += elem_counts[q];
+         }
+         MFEM_VERIFY(total == gmesh->GetNE(), "invalid checkpoint data");
+         // Keep the vertex order of the elements, see ReadCheckpointMesh().
+         pmesh = ParMesh::Distribute(m_comm, gmesh, 0, partitioning, 1,
+                                     false);
+         delete gmesh;
+      }
+      else
+      {
+         if (mesh_size > 0)
+         {
+            SendBytes(mesh_data.data(), mesh_size, 0, tag, m_comm);
+         }
+         std::vector<char>().swap(mesh_data);
+         pmesh = ParMesh::Distribute(m_comm, NULL, 0, NULL, 1, false);
+      }
+      delete nodes_fec;
+
+      // The new rank of each element read by this rank
+      Array<int> elem_part(num_elem);
+      MPI_Scatterv(partitioning, elem_counts.data(), elem_displs.data(),
+                   MPI_INT, elem_part.GetData(), num_elem, MPI_INT, 0, m_comm);
+      delete [] partitioning;
+
+      // Send the field values of the elements read by this rank to their new
+      // ranks, field by field. The records are ordered by element, so each
+      // rank receives the values in the order of its local elements.
+      std::vector<std::vector<char> > send_bufs(comm_size);
+      std::vector<int> send_ne(comm_size, 0);
+      for (int e = 0; e < num_elem; e++) { send_ne[elem_part[e]]++; }
+      for (int i = 0; i < nfields; i++)
+      {
+         FiniteElementCollection *fec =
+            FiniteElementCollection::New(fields[i].fec_name.c_str());
+         for (int k = 0, e = 0; k < num_recs; k++)
+         {
+            for (int j = 0; j < rec_ne[k]; j++, e++)
+            {
+               const char *pos = field_begin[k];
+               SkipBytes(pos, rec_end[k], sizeof(double)*
+                         ElementValuesSize(*fec, fields[i].vdim, elem_geom[e]));
+               std::vector<char> &buf = send_bufs[elem_part[e]];
+               buf.insert(buf.end(), field_begin[k], pos);
+               field_begin[k] = pos;
+            }
+         }
+         delete fec;
+      }
+      std::vector<char>().swap(data);
+
+      std::vector<int> send_counts(comm_size), send_displs(comm_size);
+      std::vector<int> recv_ne(comm_size), recv_counts(comm_size);
+      std::vector<int> recv_displs(comm_size);
+      long long send_total = 0;
+      for (int q = 0; q < comm_size; q++)
+      {
+         send_counts[q] = (int) send_bufs[q].size();
+         send_displs[q] = (int) send_total;
+         send_total += send_bufs[q].size();
+      }
+      MFEM_VERIFY(send_total <= INT_MAX, "the field data of a rank is too "
+                  "large, use more ranks to load the checkpoint");
+      std::vector<char> send_data;
+      send_data.reserve(send_total);
+      for (int q = 0; q < comm_size; q++)
+      {
+         send_data.insert(send_data.end(), send_bufs[q].begin(),
+                          send_bufs[q].end());
+         std::vector<char>().swap(send_bufs[q]);
+      }
+      MPI_Alltoall(send_ne.data(), 1, MPI_INT, recv_ne.data(), 1, MPI_INT,
+                   m_comm);
+      MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1,
+                   MPI_INT, m_comm);
+      long long recv_total = 0;
+      for (int q = 0; q < comm_size; q++)
+      {
+         recv_displs[q] = (int) recv_total;
+         recv_total += recv_counts[q];
+      }
+      MFEM_VERIFY(recv_total <= INT_MAX, "the field data of a rank is too "
+                  "large, use more ranks to load the checkpoint");
+      std::vector<char> recv_data(recv_total);
+      MPI_Alltoallv(send_data.data(), send_counts.data(), send_displs.data(),
+                    MPI_BYTE, recv_data.data(), recv_counts.data(),
+                    recv_displs.data(), MPI_BYTE, m_comm);
+      std::vector<char>().swap(send_data);
+
+      std::vector<GridFunction*> pfields(nfields);
+      for (int i = 0; i < nfields; i++)
+      {
+         pfields[i] = NewCheckpointField(pmesh, fields[i]);
+      }
+      int elem_offset = 0;
+      for (int q = 0; q < comm_size; q++)
+      {
+         const char *pos = recv_data.data() + recv_displs[q];
+         const char *end = pos + recv_counts[q];
+         for (int i = 0; i < nfields; i++)
+         {
+            ReadElementValues(pos, end, elem_offset, recv_ne[q], *pfields[i]);
+         }
+         elem_offset += recv_ne[q];
+      }
+      MFEM_VERIFY(elem_offset == pmesh->GetNE(), "invalid checkpoint data");
+
+      for (int i = 0; i < nfields; i++)
+      {
+         field_map.Register(fields[i].name, pfields[i], true);
+      }
+      mesh = pmesh;
+      serial = false;
+      myid = comm_rank;
+      num_procs = comm_size;
+   }
+   else
+#endif
+   {
+      Array<int> elem_offset;
+      Mesh *gmesh = ReadCheckpointMesh(dim, sdim, num_vertices, nodes_info,
+                                       rec_begin, rec_end, elem_offset);
+      for (int i = 0; i < nfields; i++)
+      {
+         GridFunction *gf = NewCheckpointField(gmesh, fields[i]);
+         for (int k = 0; k < num_recs; k++)
+         {
+            ReadElementValues(rec_begin[k], rec_end[k], elem_offset[k],
+                              elem_offset[k+1] - elem_offset[k], *gf);
+         }
+         field_map.Register(fields[i].name, gf, true);
+      }
+      mesh = gmesh;
+      serial = true;
+      myid = 0;
+      num_procs = 1;
+   }
+   own_data = true;
+}
+
 ParaViewDataCollection::ParaViewDataCollection(const std::string&
                                                collection_name,
                                                Mesh *mesh_)
@@ -19,6 +19,7 @@
 #endif
 #include <string>
 #include <map>
+#include <vector>
 #include <fstream>
 
 namespace mfem
@@ -469,6 +470,89 @@ public:
 };
 
 
+/** @brief Data collection for restart files, which aggregates the data of
+    groups of MPI ranks into a few large binary files. */
+/** Save() writes the mesh, the mesh nodes and all registered grid functions of
+    the collection. The data of consecutive groups of MPI ranks (see
+    SetRanksPerFile()) is gathered to the first rank of each group, which
+    writes it with a single write into the file "data.<group>" in the
+    collection directory. Rank 0 also writes the text file "index" with the
+    description of the fields and the location of the data of each rank.
+
+    The mesh is stored with global vertex numbers, and the grid functions are
+    stored element by element, so that Load() does not depend on the number of
+    ranks used to write them. In parallel, each rank of the communicator given
+    to the constructor reads a contiguous range of the data files. The mesh
+    data is sent to rank 0, which reconstructs the global mesh, partitions it
+    and distributes its parts with ParMesh::Distribute(). The field values are
+    sent directly from the ranks that read them to the new owners of their
+    elements, so that the fields are never replicated. The collection then
+    owns a new ParMesh with ParGridFunction%s. Without a communicator, Load()
+    reads all files and creates a serial Mesh with GridFunction%s.
+
+    Non-conforming meshes, NURBS meshes and quadrature functions are not
+    supported. */
+class CheckpointDataCollection : public DataCollection
+{
+protected:
+   /// Number of ranks whose data is aggregated into one file.
+   int ranks_per_file;
+
+   /// Return the name of the directory of the current cycle.
+   std::string GetCheckpointDirName() const;
+
+   /// Compute global vertex numbers for the local vertices of the mesh.
+   /** Returns the global number of vertices. */
+   int GetGlobalVertexNumbers(Array<int> &vert_num) const;
+
+   /// Serialize the local part of the mesh and the fields into @a record.
+   void WriteRecord(const Array<int> &vert_num,
+                    std::vector<char> &record) const;
+
+   /** @brief Write the index file given the sizes of the records of all ranks.
+       Returns true on success. */
+   bool WriteIndex(const std::string &file_name, int num_vertices,
+                   const std::vector<long long> &sizes) const;
+
+public:
+   /// Constructor. The collection name is used when saving the data.
+   /** If @a mesh_ is NULL, then the mesh can be set later by calling either
+       SetMesh() or Load(). Without a communicator, Load() creates a serial
+       Mesh. */
+   CheckpointDataCollection(const std::string& collection_name,
+                            Mesh *mesh_ = NULL);
+
+#ifdef MFEM_USE_MPI
+   /// Construct a parallel CheckpointDataCollection to be loaded from files.
+   /** Load() partitions the mesh for the ranks of @a comm. The number of ranks
+       of @a comm does not need to match the number of ranks that saved the
+       collection. */
+   CheckpointDataCollection(MPI_Comm comm, const std::string& collection_name,
+                            Mesh *mesh_ = NULL);
+#endif
+
+   /// Set the number of ranks whose data is written into the same file.
+   void SetRanksPerFile(int nranks);
+
+   /// Get the number of ranks whose data is written into the same file.
+   int GetRanksPerFile() const { return ranks_per_file; }
+
+   /// Save the mesh and all fields of the collection.
+   virtual void Save();
+
+   /// Same as Save(): the mesh and the fields are always saved together.
+   virtual void SaveMesh() { Save(); }
+
+   /// Same as Save(): the mesh and the fields are always saved together.
+   virtual void SaveField(const std::string &) { Save(); }
+
+   /// Load the mesh and the fields saved for the given cycle.
+   virtual void Load(int cycle_ = 0);
+
+   /// We will delete the mesh and fields if we own them
+   virtual ~CheckpointDataCollection() {}
+};
+
 /// Helper class for ParaView visualization data
 class ParaViewDataCollection : public DataCollection
 {
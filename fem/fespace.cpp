@@ -242,6 +242,22 @@ void FiniteElementSpace::RebuildElementToDofTable()
 
 void FiniteElementSpace::ReorderElementToDofTable()
 {
+   bool reorder_all = !NURBSext && Conforming() &&
+                      mesh->GetNodalFESpace() != this;
+#ifdef MFEM_USE_MPI
+   reorder_all = reorder_all &&
+                 dynamic_cast<ParFiniteElementSpace*>(this) == NULL;
+#endif
+   if (reorder_all)
+   {
+      Array<int> ordering(mesh->GetNE());
+      for (int i = 0; i < ordering.Size(); i++) { ordering[i] = i; }
+      ReorderDofs(ordering);
+      return;
+   }
+
+   // The spaces not supported by ReorderDofs() only renumber the DOFs in the
+   // element-to-DOF table
    Array<int> dof_marker(ndofs);
 
    dof_marker = -1;
@@ -260,6 +276,74 @@ void FiniteElementSpace::ReorderElementToDofTable()
    }
 }
 
+void FiniteElementSpace::ReorderDofs(const Array<int> &ordering)
+{
+   MFEM_VERIFY(!NURBSext, "NURBS spaces are not supported");
+   MFEM_VERIFY(Conforming(), "nonconforming spaces are not supported");
+   MFEM_VERIFY(mesh->GetNodalFESpace() != this,
+               "the DOFs of the mesh nodal space cannot be reordered");
+   MFEM_VERIFY(ordering.Size() == mesh->GetNE(), "invalid element ordering");
+#ifdef MFEM_USE_MPI
+   MFEM_VERIFY(dynamic_cast<ParFiniteElementSpace*>(this) == NULL,
+               "parallel spaces are not supported");
+#endif
+
+   Array<int> elements(ordering.Size());
+   for (int i = 0; i < ordering.Size(); i++) { elements[ordering[i]] = i; }
+
+   // Number the DOFs by first touch in the given element order
+   BuildElementToDofTable();
+   Array<int> new_dof(ndofs);
+   new_dof = -1;
+   int dof_counter = 0;
+   for (int k = 0; k < elements.Size(); k++)
+   {
+      const int *row = elem_dof->GetRow(elements[k]);
+      const int n = elem_dof->RowSize(elements[k]);
+      for (int j = 0; j < n; j++)
+      {
+         const int dof = DecodeDof(row[j]);
+         if (new_dof[dof] < 0) { new_dof[dof] = dof_counter++; }
+      }
+   }
+   // DOFs not belonging to any element (if any) are numbered last
+   for (int i = 0; i < ndofs; i++)
+   {
+      if (new_dof[i] < 0) { new_dof[i] = dof_counter++; }
+   }
+
+   // Compose with the current renumbering, if any
+   if (dof_perm.Size())
+   {
+      for (int i = 0; i < ndofs; i++) { dof_perm[i] = new_dof[dof_perm[i]]; }
+   }
+   else
+   {
+      Swap(dof_perm, new_dof);
+   }
+
+   // Invalidate everything that depends on the DOF numbering
+   delete elem_dof;
+   elem_dof = NULL;
+   dof_elem_array.DeleteAll();
+   dof_ldof_array.DeleteAll();
+   L2E_nat.Clear();
+   L2E_lex.Clear();
+   for (auto &x : L2F) { delete x.second; }
+   L2F.clear();
+   BuildElementToDofTable();
+}
+
+void FiniteElementSpace::ApplyDofPermutation(Array<int> &dofs) const
+{
+   if (dof_perm.Size() == 0) { return; }
+   for (int i = 0; i < dofs.Size(); i++)
+   {
+      const int dof = dofs[i];
+      dofs[i] = (dof >= 0) ? dof_perm[dof] : -1 - dof_perm[-1 - dof];
+   }
+}
+
 void FiniteElementSpace::BuildDofToArrays()
 {
    if (dof_elem_array.Size()) { return; }
@@ -1526,6 +1610,7 @@ void FiniteElementSpace::Construct()
 
    elem_dof = NULL;
    bdrElem_dof = NULL;
+   dof_perm.DeleteAll();
 
    ndofs = 0;
    nedofs = nfdofs = nbdofs = 0;
@@ -1683,6 +1768,7 @@ void FiniteElementSpace::GetElementDofs(int i, Array<int> &dofs) const
             dofs[ne+j] = k + j;
          }
       }
+      ApplyDofPermutation(dofs);
    }
 }
 
@@ -1783,6 +1869,7 @@ void FiniteElementSpace::GetBdrElementDofs(int i, Array<int> &dofs) const
             }
          }
       }
+      ApplyDofPermutation(dofs);
    }
 }
 
@@ -1843,6 +1930,7 @@ void FiniteElementSpace::GetFaceDofs(int i, Array<int> &dofs) const
          dofs[ne+k] = j;
       }
    }
+   ApplyDofPermutation(dofs);
 }
 
 void FiniteElementSpace::GetEdgeDofs(int i, Array<int> &dofs) const
@@ -1872,6 +1960,7 @@ void FiniteElementSpace::GetEdgeDofs(int i, Array<int> &dofs) const
    {
       dofs[nv+j] = k;
    }
+   ApplyDofPermutation(dofs);
 }
 
 void FiniteElementSpace::GetVertexDofs(int i, Array<int> &dofs) const
@@ -1884,6 +1973,7 @@ void FiniteElementSpace::GetVertexDofs(int i, Array<int> &dofs) const
    {
       dofs[j] = i*nv+j;
    }
+   ApplyDofPermutation(dofs);
 }
 
 void FiniteElementSpace::GetElementInteriorDofs (int i, Array<int> &dofs) const
@@ -1897,6 +1987,7 @@ void FiniteElementSpace::GetElementInteriorDofs (int i, Array<int> &dofs) const
    {
       dofs[j] = k + j;
    }
+   ApplyDofPermutation(dofs);
 }
 
 void FiniteElementSpace::GetEdgeInteriorDofs (int i, Array<int> &dofs) const
@@ -1909,6 +2000,7 @@ void FiniteElementSpace::GetEdgeInteriorDofs (int i, Array<int> &dofs) const
    {
       dofs[j] = k;
    }
+   ApplyDofPermutation(dofs);
 }
 
 void FiniteElementSpace::GetFaceInteriorDofs (int i, Array<int> &dofs) const
@@ -1924,6 +2016,7 @@ void FiniteElementSpace::GetFaceInteriorDofs (int i, Array<int> &dofs) const
          dofs[j] = k;
       }
    }
+   ApplyDofPermutation(dofs);
 }
 
 const FiniteElement *FiniteElementSpace::GetBE (int i) const
@@ -2352,28 +2445,55 @@ FiniteElementCollection *FiniteElementSpace::Load(Mesh *m, std::istream &input)
 void QuadratureSpace::Construct()
 {
    // protected method
-   int offset = 0;
    const int num_elem = mesh->GetNE();
-   element_offsets = new int[num_elem + 1];
    for (int g = 0; g < Geometry::NumGeom; g++)
    {
       int_rule[g] = NULL;
    }
    for (int i = 0; i < num_elem; i++)
    {
-      element_offsets[i] = offset;
       int geom = mesh->GetElementBaseGeometry(i);
       if (int_rule[geom] == NULL)
       {
          int_rule[geom] = &IntRules.Get(geom, order);
       }
-      offset += int_rule[geom]->GetNPoints();
+   }
+   ConstructOffsets();
+}
+
+void QuadratureSpace::ConstructOffsets()
+{
+   // protected method
+   int offset = 0;
+   const int num_elem = mesh->GetNE();
+   element_offsets = new int[num_elem + 1];
+   for (int i = 0; i < num_elem; i++)
+   {
+      element_offsets[i] = offset;
+      offset += int_rule[mesh->GetElementBaseGeometry(i)]->GetNPoints();
    }
    element_offsets[num_elem] = size = offset;
 }
 
+QuadratureSpace::QuadratureSpace(Mesh *mesh_, const IntegrationRule &ir)
+   : mesh(mesh_), order(ir.GetOrder()), own_int_rule(NULL),
+     vert_coords_sequence(-1)
+{
+   MFEM_VERIFY(mesh->GetNumGeometries(mesh->Dimension()) <= 1,
+               "a single IntegrationRule requires a single element geometry");
+   for (int g = 0; g < Geometry::NumGeom; g++)
+   {
+      int_rule[g] = NULL;
+   }
+   if (mesh->GetNE() > 0)
+   {
+      int_rule[mesh->GetElementBaseGeometry(0)] = &ir;
+   }
+   ConstructOffsets();
+}
+
 QuadratureSpace::QuadratureSpace(Mesh *mesh_, std::istream &in)
-   : mesh(mesh_)
+   : mesh(mesh_), own_int_rule(NULL), vert_coords_sequence(-1)
 {
    const char *msg = "invalid input stream";
    string ident;
@@ -2386,6 +2506,35 @@ QuadratureSpace::QuadratureSpace(Mesh *mesh_, std::istream &in)
       in >> ident; MFEM_VERIFY(ident == "Order:", msg);
       in >> order;
    }
+   else if (ident == "custom_quadrature")
+   {
+      int npts;
+      in >> ident; MFEM_VERIFY(ident == "Order:", msg);
+      in >> order;
+      in >> ident; MFEM_VERIFY(ident == "Points:", msg);
+      in >> npts;
+      own_int_rule = new IntegrationRule(npts);
+      own_int_rule->SetOrder(order);
+      for (int i = 0; i < npts; i++)
+      {
+         IntegrationPoint &ip = own_int_rule->IntPoint(i);
+         in >> ip.x >> ip.y >> ip.z >> ip.weight;
+      }
+      MFEM_VERIFY(in, msg);
+      MFEM_VERIFY(mesh->GetNumGeometries(mesh->Dimension()) <= 1,
+                  "a single IntegrationRule requires a single element "
+                  "geometry");
+      for (int g = 0; g < Geometry::NumGeom; g++)
+      {
+         int_rule[g] = NULL;
+      }
+      if (mesh->GetNE() > 0)
+      {
+         int_rule[mesh->GetElementBaseGeometry(0)] = own_int_rule;
+      }
+      ConstructOffsets();
+      return;
+   }
    else
    {
       MFEM_ABORT("unknown QuadratureSpace type: " << ident);
@@ -2395,11 +2544,84 @@ QuadratureSpace::QuadratureSpace(Mesh *mesh_, std::istream &in)
    Construct();
 }
 
+const IntegrationRule *QuadratureSpace::GetUniformIntRule() const
+{
+   const IntegrationRule *ir = NULL;
+   for (int g = 0; g < Geometry::NumGeom; g++)
+   {
+      if (int_rule[g] == NULL) { continue; }
+      if (ir != NULL) { return NULL; }
+      ir = int_rule[g];
+   }
+   return ir;
+}
+
+const Vector &QuadratureSpace::GetVertexCoordinates() const
+{
+   MFEM_VERIFY(mesh->GetNodes() == NULL, "the mesh must not have nodes");
+   const IntegrationRule *ir = GetUniformIntRule();
+   MFEM_VERIFY(ir != NULL, "the QuadratureSpace must use a single rule");
+   const int sdim = mesh->SpaceDimension();
+   const int nv = mesh->GetNV();
+
+   bool valid = (vert_coords_sequence == mesh->GetSequence() &&
+                 vert_coords_vertices.Size() == nv*sdim);
+   for (int i = 0; valid && i < nv; i++)
+   {
+      const double *v = mesh->GetVertex(i);
+      for (int d = 0; d < sdim; d++)
+      {
+         valid = valid && (vert_coords_vertices(i*sdim+d) == v[d]);
+      }
+   }
+   if (valid) { return vert_coords; }
+
+   // Interpolate temporary linear nodes, whose dofs are the vertices
+   vert_coords_vertices.SetSize(nv*sdim);
+   H1_FECollection fec(1, mesh->Dimension());
+   FiniteElementSpace fes(mesh, &fec, sdim);
+   GridFunction vert_nodes(&fes);
+   for (int i = 0; i < nv; i++)
+   {
+      const double *v = mesh->GetVertex(i);
+      for (int d = 0; d < sdim; d++)
+      {
+         vert_coords_vertices(i*sdim+d) = v[d];
+         vert_nodes(fes.DofToVDof(i, d)) = v[d];
+      }
+   }
+   const Operator *R = fes.GetElementRestriction(ElementDofOrdering::NATIVE);
+   Vector e_vec(R->Height());
+   R->Mult(vert_nodes, e_vec);
+   const QuadratureInterpolator *qi = fes.GetQuadratureInterpolator(*ir);
+   qi->SetOutputLayout(QVectorLayout::byNODES);
+   Vector empty;
+   vert_coords.SetSize(ir->GetNPoints()*sdim*mesh->GetNE());
+   qi->Mult(e_vec, QuadratureInterpolator::VALUES, vert_coords, empty, empty);
+   vert_coords_sequence = mesh->GetSequence();
+   return vert_coords;
+}
+
 void QuadratureSpace::Save(std::ostream &out) const
 {
+   const IntegrationRule *ir = GetUniformIntRule();
+   if (ir == NULL || ir == &IntRules.Get(mesh->GetElementBaseGeometry(0),
+                                         order))
+   {
+      out << "QuadratureSpace\n"
+          << "Type: default_quadrature\n"
+          << "Order: " << order << '\n';
+      return;
+   }
    out << "QuadratureSpace\n"
-       << "Type: default_quadrature\n"
-       << "Order: " << order << '\n';
+       << "Type: custom_quadrature\n"
+       << "Order: " << order << '\n'
+       << "Points: " << ir->GetNPoints() << '\n';
+   for (int i = 0; i < ir->GetNPoints(); i++)
+   {
+      const IntegrationPoint &ip = ir->IntPoint(i);
+      out << ip.x << ' ' << ip.y << ' ' << ip.z << ' ' << ip.weight << '\n';
+   }
 }
 
 
@@ -115,6 +115,10 @@ protected:
 
    Array<int> dof_elem_array, dof_ldof_array;
 
+   /** Optional renumbering of the scalar DOFs, old index -> new index, set by
+       ReorderDofs(). Empty when the natural DOF numbering is used. */
+   Array<int> dof_perm;
+
    NURBSExtension *NURBSext;
    int own_ext;
 
@@ -168,6 +172,9 @@ protected:
    static inline int DecodeDof(int dof, double& sign)
    { return (dof >= 0) ? (sign = 1, dof) : (sign = -1, (-1 - dof)); }
 
+   /// Apply #dof_perm (if set) to an array of signed DOFs.
+   void ApplyDofPermutation(Array<int> &dofs) const;
+
    /// Helper to get vertex, edge or face DOFs (entity=0,1,2 resp.).
    void GetEntityDofs(int entity, int index, Array<int> &dofs,
                       Geometry::Type master_geom = Geometry::INVALID) const;
@@ -523,9 +530,32 @@ public:
        ordered in the Mesh; 2) for each element, assign new indices to all of
        its current DOFs that are still unassigned; the new indices we assign are
        simply the sequence `0,1,2,...`; if there are any signed DOFs their sign
-       is preserved. */
+       is preserved.
+
+       For the spaces supported by ReorderDofs(), this is equivalent to
+       ReorderDofs() with the identity ordering, so all DOF access methods use
+       the new numbering. For other spaces (parallel, nonconforming, NURBS or
+       the nodal space of the Mesh), only the element-to-DOF table is
+       renumbered. */
    void ReorderElementToDofTable();
 
+   /** @brief Renumber the scalar DOFs by visiting the elements in the order
+       given by @a ordering.
+
+       For each element i, @a ordering[i] is its position in the traversal, in
+       the same format as used by Mesh::ReorderElements(). The DOFs of each
+       visited element that are still unassigned get the next new indices, so
+       e.g. the ordering from Mesh::GetHilbertElementOrdering() numbers the
+       DOFs along a space-filling curve through the element centers, which
+       improves the locality of the element restriction and of the assembled
+       matrix on unstructured meshes. The Mesh itself is not modified.
+
+       The renumbering is applied consistently to all DOF access methods. It
+       must be done before creating GridFunctions, forms, etc. on the space and
+       it is discarded by Update(). Only serial, conforming, non-NURBS spaces
+       that are not the nodal space of the Mesh are supported. */
+   void ReorderDofs(const Array<int> &ordering);
+
    void BuildDofToArrays();
 
    const Table &GetElementToDofTable() const { return *elem_dof; }
@@ -693,30 +723,70 @@ protected:
    const IntegrationRule *int_rule[Geometry::NumGeom];
    int *element_offsets; // scalar offsets; size = number of elements + 1
 
+   // The rule read by QuadratureSpace(Mesh*, std::istream&) for the custom
+   // quadrature type; owned, NULL otherwise.
+   IntegrationRule *own_int_rule;
+
+   // Cached result of GetVertexCoordinates(), valid for the mesh sequence
+   // vert_coords_sequence and the vertex coordinates vert_coords_vertices.
+   mutable Vector vert_coords, vert_coords_vertices;
+   mutable long vert_coords_sequence;
+
    // protected functions
 
    // Assuming mesh and order are set, construct the members: int_rule,
    // element_offsets, and size.
    void Construct();
 
+   // Assuming mesh and int_rule are set, construct the members:
+   // element_offsets and size.
+   void ConstructOffsets();
+
 public:
    /// Create a QuadratureSpace based on the global rules from #IntRules.
    QuadratureSpace(Mesh *mesh_, int order_)
-      : mesh(mesh_), order(order_) { Construct(); }
+      : mesh(mesh_), order(order_), own_int_rule(NULL),
+        vert_coords_sequence(-1) { Construct(); }
+
+   /** @brief Create a QuadratureSpace that uses the rule @a ir in all
+       elements of @a mesh_. */
+   /** The mesh must have a single element geometry, matching the geometry of
+       @a ir. The rule is not copied and must outlive the QuadratureSpace. */
+   QuadratureSpace(Mesh *mesh_, const IntegrationRule &ir);
 
    /// Read a QuadratureSpace from the stream @a in.
    QuadratureSpace(Mesh *mesh_, std::istream &in);
 
-   virtual ~QuadratureSpace() { delete [] element_offsets; }
+   virtual ~QuadratureSpace()
+   {
+      delete [] element_offsets;
+      delete own_int_rule;
+   }
 
    /// Return the total number of quadrature points.
    int GetSize() const { return size; }
 
+   /// Return the Mesh associated with the QuadratureSpace.
+   Mesh *GetMesh() const { return mesh; }
+
+   /** @brief Return the IntegrationRule used in all elements, or NULL if the
+       mesh has elements of more than one geometry. */
+   const IntegrationRule *GetUniformIntRule() const;
+
    /// Get the IntegrationRule associated with mesh element @a idx.
    const IntegrationRule &GetElementIntRule(int idx) const
    { return *int_rule[mesh->GetElementBaseGeometry(idx)]; }
 
-   /// Write the QuadratureSpace to the stream @a out.
+   /** @brief Return the physical coordinates of the quadrature points, with the
+       layout (NQ x SDIM x NE), interpolated linearly from the mesh vertices. */
+   /** The space must use the same rule in all elements, see
+       GetUniformIntRule(), and the mesh must not have nodes. The result is
+       cached and recomputed only when the mesh sequence or the vertex
+       coordinates change. */
+   const Vector &GetVertexCoordinates() const;
+
+   /** @brief Write the QuadratureSpace to the stream @a out. A space created
+       from a single IntegrationRule is written together with the rule. */
    void Save(std::ostream &out) const;
 };
 
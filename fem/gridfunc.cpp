@@ -12,8 +12,13 @@
 // Implementation of GridFunction
 
 #include "gridfunc.hpp"
+#include "quadinterpolator.hpp"
 #include "../mesh/nurbs.hpp"
+#include "../mesh/point_locator.hpp"
+#include "../general/sort_pairs.hpp"
 #include "../general/text.hpp"
+#include "../general/binaryio.hpp"
+#include "../general/forall.hpp"
 
 #include <limits>
 #include <cstring>
@@ -54,6 +59,19 @@ GridFunction::GridFunction(Mesh *m, std::istream &input)
          MFEM_ABORT("unknown section: " << buff);
       }
    }
+   else if (next_char == 'b') // First letter of "binary_data"
+   {
+      string buff;
+      getline(input, buff);
+      filter_dos(buff);
+      MFEM_VERIFY(buff == "binary_data", "unknown section: " << buff);
+      const long long size = bin_io::read<long long>(input);
+      MFEM_VERIFY(input && size == fes->GetVSize(),
+                  "invalid binary grid function data");
+      SetSize(size);
+      input.read((char *) HostWrite(), size*sizeof(double));
+      MFEM_VERIFY(input, "invalid binary grid function data");
+   }
    else
    {
       Vector::Load(input, fes->GetVSize());
@@ -1002,6 +1020,66 @@ void GridFunction::GetVectorValues(ElementTransformation &T,
    }
 }
 
+void GridFunction::GetPointValues(const Array<int> &elem_ids,
+                                  const Array<IntegrationPoint> &ips,
+                                  DenseMatrix &vals) const
+{
+   MFEM_VERIFY(elem_ids.Size() == ips.Size(), "invalid points");
+   const int npts = elem_ids.Size();
+   vals.SetSize(VectorDim(), npts);
+   vals = 0.0;
+
+   Array<Pair<int, int> > elem_pt;
+   for (int k = 0; k < npts; k++)
+   {
+      if (elem_ids[k] >= 0) { elem_pt.Append(Pair<int, int>(elem_ids[k], k)); }
+   }
+   SortPairs<int, int>(elem_pt, elem_pt.Size());
+
+   IntegrationRule ir;
+   DenseMatrix elem_vals;
+   for (int i = 0; i < elem_pt.Size(); )
+   {
+      const int e = elem_pt[i].one;
+      int n = 0;
+      while (i + n < elem_pt.Size() && elem_pt[i+n].one == e) { n++; }
+      ir.SetSize(n);
+      for (int j = 0; j < n; j++) { ir.IntPoint(j) = ips[elem_pt[i+j].two]; }
+
+      GetVectorValues(*fes->GetElementTransformation(e), ir, elem_vals);
+      for (int j = 0; j < n; j++)
+      {
+         for (int d = 0; d < vals.Height(); d++)
+         {
+            vals(d, elem_pt[i+j].two) = elem_vals(d, j);
+         }
+      }
+      i += n;
+   }
+}
+
+int GridFunction::GetPointValues(const DenseMatrix &points, DenseMatrix &vals,
+                                 const PointLocator *locator) const
+{
+   Mesh *mesh = fes->GetMesh();
+   MFEM_VERIFY(!locator || &locator->GetMesh() == mesh,
+               "the PointLocator uses a different Mesh");
+   Array<int> elem_ids;
+   Array<IntegrationPoint> ips;
+   int pts_found;
+   if (locator)
+   {
+      pts_found = locator->FindPoints(points, elem_ids, ips);
+   }
+   else
+   {
+      PointLocator tmp_locator(*mesh);
+      pts_found = tmp_locator.FindPoints(points, elem_ids, ips);
+   }
+   GetPointValues(elem_ids, ips, vals);
+   return pts_found;
+}
+
 int GridFunction::GetFaceVectorValues(
    int i, int side, const IntegrationRule &ir,
    DenseMatrix &vals, DenseMatrix &tr) const
@@ -2328,6 +2406,155 @@ void GridFunction::ProjectBdrCoefficientTangent(
 #endif
 }
 
+// Check if the Lp errors of a GridFunction in @a fes, compared to a
+// coefficient of dimension @a vdim, can be computed with LpErrorsBatched().
+static bool LpErrorsSupportBatched(const FiniteElementSpace &fes, int vdim)
+{
+   const Mesh &mesh = *fes.GetMesh();
+   const int dim = mesh.Dimension();
+   if (fes.GetNE() == 0 || fes.GetNURBSext() || mesh.NURBSext) { return false; }
+   if ((dim != 2 && dim != 3) || mesh.SpaceDimension() != dim) { return false; }
+   if (mesh.GetNumGeometries(dim) != 1) { return false; }
+   // Without mesh nodes, the element loop is used so that the mesh is not
+   // modified by Mesh::EnsureNodes()
+   if (!mesh.GetNodes()) { return false; }
+   const FiniteElement &fe = *fes.GetFE(0);
+   if (fe.GetRangeType() != FiniteElement::SCALAR ||
+       fe.GetMapType() != FiniteElement::VALUE) { return false; }
+   if (fes.GetVDim() != vdim) { return false; }
+   // The vector dimensions supported by QuadratureInterpolator
+   return vdim == 1 || vdim == dim || (vdim == 3 && dim == 2);
+}
+
+// Compute in @a elem_err the Lp errors of the GridFunction @a u in all
+// elements, without a loop over the elements on the host: the values of @a u
+// are computed with QuadratureInterpolator, the coefficients are projected on
+// all quadrature points with Coefficient::Project() and the errors are reduced
+// over the quadrature points of each element with a single kernel. The p-th
+// root of the errors is taken only if @a root is true. Either @a exsol or
+// @a vexsol must be given.
+static void LpErrorsBatched(const GridFunction &u, const double p,
+                            Coefficient *exsol, VectorCoefficient *vexsol,
+                            Coefficient *weight, VectorCoefficient *v_weight,
+                            const IntegrationRule *irs[], const bool root,
+                            Vector &elem_err)
+{
+   const FiniteElementSpace &fes = *u.FESpace();
+   Mesh *mesh = fes.GetMesh();
+   const int NE = fes.GetNE();
+   const int VDIM = fes.GetVDim();
+   const FiniteElement &fe = *fes.GetFE(0);
+   const Geometry::Type geom = fe.GetGeomType();
+   const IntegrationRule &ir =
+      irs ? *irs[geom] : IntRules.Get(geom, 2*fe.GetOrder() + 3);
+   const int NQ = ir.GetNPoints();
+   MFEM_VERIFY(!v_weight || v_weight->GetVDim() == VDIM,
+               "invalid vector weight dimension");
+
+   // The values of the GridFunction at the quadrature points, NQ x VDIM x NE
+   const Operator *elem_restr =
+      fes.GetElementRestriction(ElementDofOrdering::NATIVE);
+   Vector e_vec(elem_restr->Height()), u_vals(NQ*VDIM*NE);
+   elem_restr->Mult(u, e_vec);
+   const QuadratureInterpolator *qi = fes.GetQuadratureInterpolator(ir);
+   const QVectorLayout q_layout = qi->GetOutputLayout();
+   qi->SetOutputLayout(QVectorLayout::byNODES);
+   qi->Values(e_vec, u_vals);
+   qi->SetOutputLayout(q_layout);
+
+   // The Jacobian determinants are computed from the current mesh nodes and
+   // are not cached in the Mesh, which may be moved between calls
+   GeometricFactors geom_factors(mesh, ir, GeometricFactors::DETERMINANTS);
+
+   // The coefficients at the quadrature points, VDIM x NQ x NE. The
+   // coordinates of the points are also interpolated from the current nodes,
+   // see Coefficient::Project().
+   QuadratureSpace qspace(mesh, ir);
+   Vector ex_vals(VDIM*NQ*NE), w_vals, vw_vals;
+   {
+      QuadratureFunction qf(&qspace, ex_vals.HostWrite(), VDIM);
+      if (exsol) { exsol->Project(qf); }
+      else { vexsol->Project(qf); }
+   }
+   if (weight)
+   {
+      w_vals.SetSize(NQ*NE);
+      QuadratureFunction qf(&qspace, w_vals.HostWrite(), 1);
+      weight->Project(qf);
+   }
+   if (v_weight)
+   {
+      vw_vals.SetSize(VDIM*NQ*NE);
+      QuadratureFunction qf(&qspace, vw_vals.HostWrite(), VDIM);
+      v_weight->Project(qf);
+   }
+
+   const bool p_inf = (p == infinity());
+   const bool use_w = (weight != NULL), use_vw = (v_weight != NULL);
+   auto W = ir.GetWeights().Read();
+   auto J = Reshape(geom_factors.detJ.Read(), NQ, NE);
+   auto U = Reshape(u_vals.Read(), NQ, VDIM, NE);
+   auto X = Reshape(ex_vals.Read(), VDIM, NQ, NE);
+   auto C = Reshape(w_vals.Read(), NQ, NE);
+   auto V = Reshape(vw_vals.Read(), VDIM, NQ, NE);
+   elem_err.SetSize(NE);
+   auto E = elem_err.Write();
+   MFEM_FORALL(e, NE,
+   {
+      double err_e = 0.0;
+      for (int q = 0; q < NQ; q++)
+      {
+         // the length of the error vector, or its dot product with the vector
+         // weight
+         double err = 0.0;
+         for (int c = 0; c < VDIM; c++)
+         {
+            const double diff = U(q,c,e) - X(c,q,e);
+            err += use_vw ? diff*V(c,q,e) : diff*diff;
+         }
+         err = use_vw ? fabs(err) : sqrt(err);
+         if (!p_inf)
+         {
+            err = pow(err, p);
+            if (use_w) { err *= C(q,e); }
+            err_e += W[q] * J(q,e) * err;
+         }
+         else
+         {
+            if (use_w) { err *= C(q,e); }
+            err_e = fmax(err_e, err);
+         }
+      }
+      if (root && !p_inf)
+      {
+         // negative quadrature weights may cause the error to be negative
+         err_e = (err_e < 0.0) ? -pow(-err_e, 1.0/p) : pow(err_e, 1.0/p);
+      }
+      E[e] = err_e;
+   });
+}
+
+// Reduce the element errors computed by LpErrorsBatched(), without the p-th
+// root, to the global Lp error, over the elements marked in @a elems, if given.
+static double ReduceLpErrors(const double p, const Vector &elem_err,
+                             const Array<int> *elems = NULL)
+{
+   const double *h_err = elem_err.HostRead();
+   double error = 0.0;
+   for (int i = 0; i < elem_err.Size(); i++)
+   {
+      if (elems != NULL && (*elems)[i] == 0) { continue; }
+      if (p < infinity()) { error += h_err[i]; }
+      else { error = std::max(error, h_err[i]); }
+   }
+   if (p < infinity())
+   {
+      // negative quadrature weights may cause the error to be negative
+      error = (error < 0.0) ? -pow(-error, 1./p) : pow(error, 1./p);
+   }
+   return error;
+}
+
 double GridFunction::ComputeL2Error(
    Coefficient *exsol[], const IntegrationRule *irs[]) const
 {
@@ -2389,6 +2616,14 @@ double GridFunction::ComputeL2Error(
    VectorCoefficient &exsol, const IntegrationRule *irs[],
    Array<int> *elems) const
 {
+   if (LpErrorsSupportBatched(*fes, exsol.GetVDim()))
+   {
+      Vector elem_err;
+      LpErrorsBatched(*this, 2.0, NULL, &exsol, NULL, NULL, irs, false,
+                      elem_err);
+      return ReduceLpErrors(2.0, elem_err, elems);
+   }
+
    double error = 0.0;
    const FiniteElement *fe;
    ElementTransformation *T;
@@ -2745,6 +2980,14 @@ double GridFunction::ComputeLpError(const double p, Coefficient &exsol,
                                     Coefficient *weight,
                                     const IntegrationRule *irs[]) const
 {
+   if (LpErrorsSupportBatched(*fes, 1))
+   {
+      Vector elem_err;
+      LpErrorsBatched(*this, p, &exsol, NULL, weight, NULL, irs, false,
+                      elem_err);
+      return ReduceLpErrors(p, elem_err);
+   }
+
    double error = 0.0;
    const FiniteElement *fe;
    ElementTransformation *T;
@@ -2814,6 +3057,12 @@ void GridFunction::ComputeElementLpErrors(const double p, Coefficient &exsol,
    MFEM_ASSERT(error.Size() == fes->GetNE(),
                "Incorrect size for result vector");
 
+   if (LpErrorsSupportBatched(*fes, 1))
+   {
+      LpErrorsBatched(*this, p, &exsol, NULL, weight, NULL, irs, true, error);
+      return;
+   }
+
    error = 0.0;
    const FiniteElement *fe;
    ElementTransformation *T;
@@ -2877,6 +3126,14 @@ double GridFunction::ComputeLpError(const double p, VectorCoefficient &exsol,
                                     VectorCoefficient *v_weight,
                                     const IntegrationRule *irs[]) const
 {
+   if (LpErrorsSupportBatched(*fes, exsol.GetVDim()))
+   {
+      Vector elem_err;
+      LpErrorsBatched(*this, p, NULL, &exsol, weight, v_weight, irs, false,
+                      elem_err);
+      return ReduceLpErrors(p, elem_err);
+   }
+
    double error = 0.0;
    const FiniteElement *fe;
    ElementTransformation *T;
@@ -2973,6 +3230,13 @@ void GridFunction::ComputeElementLpErrors(const double p,
    MFEM_ASSERT(error.Size() == fes->GetNE(),
                "Incorrect size for result vector");
 
+   if (LpErrorsSupportBatched(*fes, exsol.GetVDim()))
+   {
+      LpErrorsBatched(*this, p, NULL, &exsol, weight, v_weight, irs, true,
+                      error);
+      return;
+   }
+
    error = 0.0;
    const FiniteElement *fe;
    ElementTransformation *T;
@@ -3094,6 +3358,17 @@ void GridFunction::Save(std::ostream &out) const
    out.flush();
 }
 
+void GridFunction::SaveBinary(std::ostream &out) const
+{
+   MFEM_VERIFY(!fes->GetNURBSext(),
+               "the binary format does not support NURBS FE spaces");
+   fes->Save(out);
+   out << "\nbinary_data\n";
+   bin_io::write<long long>(out, Size());
+   out.write((const char *) HostRead(), Size()*sizeof(double));
+   out.flush();
+}
+
 #ifdef MFEM_USE_ADIOS2
 void GridFunction::Save(adios2stream &out,
                         const std::string& variable_name,
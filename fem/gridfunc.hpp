@@ -26,6 +26,8 @@
 namespace mfem
 {
 
+class PointLocator;
+
 /// Class for grid function - Vector with associated FE space.
 class GridFunction : public Vector
 {
@@ -94,8 +96,8 @@ public:
 
    /// Construct a GridFunction on the given Mesh, using the data from @a input.
    /** The content of @a input should be in the format created by the method
-       Save(). The reconstructed FiniteElementSpace and FiniteElementCollection
-       are owned by the GridFunction. */
+       Save() or SaveBinary(). The reconstructed FiniteElementSpace and
+       FiniteElementCollection are owned by the GridFunction. */
    GridFunction(Mesh *m, std::istream &input);
 
    GridFunction(Mesh *m, GridFunction *gf_array[], int num_pieces);
@@ -244,6 +246,32 @@ public:
                         DenseMatrix &vals, DenseMatrix *tr = NULL) const;
    ///@}
 
+   /** @name Point Get Values Methods
+
+       These methods evaluate the field at many arbitrary points, given either
+       by their elements and reference coordinates, as returned by
+       Mesh::FindPoints() or PointLocator::FindPoints(), or by their physical
+       coordinates. The points are grouped by element and each group is
+       evaluated with GetVectorValues(ElementTransformation &, ...).
+   */
+   ///@{
+   /** Compute the values at the points with reference coordinates @a ips in
+       the elements @a elem_ids, in the columns of @a vals, of size
+       VectorDim() x npts. Points with a negative element index get zero
+       values. */
+   void GetPointValues(const Array<int> &elem_ids,
+                       const Array<IntegrationPoint> &ips,
+                       DenseMatrix &vals) const;
+
+   /** Compute the values at the physical points given by the columns of
+       @a points, in the columns of @a vals, of size VectorDim() x npts. The
+       points are located with @a locator, if not NULL, or with a temporary
+       PointLocator otherwise. Points that are not found get zero values.
+       Returns the number of points found. */
+   int GetPointValues(const DenseMatrix &points, DenseMatrix &vals,
+                      const PointLocator *locator = NULL) const;
+   ///@}
+
    /** @name Face Index Get Values Methods
 
        These methods are designed to work with Discontinuous Galerkin basis
@@ -462,6 +490,15 @@ public:
                                  const IntegrationRule *irs[] = NULL) const
    { return ComputeLpError(1.0, exsol, NULL, NULL, irs); }
 
+   /** @brief Compute the Lp error of the GridFunction, with respect to the
+       exact solution @a exsol, weighted by the optional @a weight. */
+   /** When the mesh has nodes or a Device is enabled, in 2D and 3D meshes with
+       a single element type and for scalar finite elements with map type
+       VALUE, the Lp errors (including the ones computed by ComputeL1Error(),
+       ComputeL2Error(), ComputeMaxError() and ComputeElementLpErrors()) are
+       computed with batched kernels: the GridFunction is interpolated with
+       QuadratureInterpolator and the coefficients are evaluated with
+       Coefficient::Project(). Otherwise, a loop over the elements is used. */
    virtual double ComputeLpError(const double p, Coefficient &exsol,
                                  Coefficient *weight = NULL,
                                  const IntegrationRule *irs[] = NULL) const;
@@ -591,6 +628,13 @@ public:
    /// Save the GridFunction to an output stream.
    virtual void Save(std::ostream &out) const;
 
+   /** @brief Save the GridFunction to an output stream, writing the values in
+       binary form (in the native byte order). */
+   /** The FE space is written as in Save(), followed by the raw array of
+       values. The output can be read with the GridFunction constructor taking
+       an input stream, see also mapped_ifstream. */
+   void SaveBinary(std::ostream &out) const;
+
 #ifdef MFEM_USE_ADIOS2
    /// Save the GridFunction to a binary output stream using adios2 bp format.
    virtual void Save(adios2stream &out, const std::string& variable_name,
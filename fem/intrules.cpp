@@ -912,7 +912,7 @@ const IntegrationRule &IntegrationRules::Get(int GeomType, int Order)
 
    if (!HaveIntRule(*ir_array, Order))
    {
-#ifdef MFEM_USE_LEGACY_OPENMP
+#if defined(MFEM_USE_LEGACY_OPENMP) || defined(MFEM_USE_THREADED_ASSEMBLY)
       #pragma omp critical
 #endif
       {
@@ -24,6 +24,7 @@ LinearForm::LinearForm(FiniteElementSpace *f, LinearForm *lf)
 
    fes = f;
    extern_lfs = 1;
+   ext = NULL;
 
    // Copy the pointers to the integrators
    dlfi = lf->dlfi;
@@ -31,6 +32,7 @@ LinearForm::LinearForm(FiniteElementSpace *f, LinearForm *lf)
    dlfi_delta = lf->dlfi_delta;
 
    blfi = lf->blfi;
+   blfi_marker = lf->blfi_marker;
 
    flfi = lf->flfi;
    flfi_marker = lf->flfi_marker;
@@ -76,8 +78,67 @@ void LinearForm::AddBdrFaceIntegrator(LinearFormIntegrator *lfi,
    flfi_marker.Append(&bdr_attr_marker);
 }
 
+#ifdef MFEM_USE_THREADED_ASSEMBLY
+// Assemble the domain integrators in parallel: the elements of one color do
+// not share any vdofs, see Mesh::GetVertexElementColoring(), so they can be
+// added to the host array @a y without locks. All the integrators must support
+// threaded assembly, see LinearFormIntegrator::SupportsThreadedAssembly().
+static void ColoredAssembleDomain(FiniteElementSpace &fes,
+                                  Array<LinearFormIntegrator*> &dlfi,
+                                  double *y)
+{
+   Array<int> colors;
+   const int num_colors = fes.GetMesh()->GetVertexElementColoring(colors);
+   Table color_el;
+   Transpose(colors, color_el, num_colors);
+
+   #pragma omp parallel
+   {
+      Array<int> vdofs;
+      Vector elemvect;
+      IsoparametricTransformation eltrans;
+      for (int c = 0; c < num_colors; c++)
+      {
+         const int *el = color_el.GetRow(c);
+         const int num_el = color_el.RowSize(c);
+         #pragma omp for schedule(static)
+         for (int k = 0; k < num_el; k++)
+         {
+            const int i = el[k];
+            fes.GetElementVDofs(i, vdofs);
+            fes.GetElementTransformation(i, &eltrans);
+            for (int j = 0; j < dlfi.Size(); j++)
+            {
+               dlfi[j]->AssembleRHSElementVect(*fes.GetFE(i), eltrans,
+                                               elemvect);
+               for (int d = 0; d < vdofs.Size(); d++)
+               {
+                  const int gd = vdofs[d];
+                  if (gd >= 0) { y[gd] += elemvect(d); }
+                  else { y[-1-gd] -= elemvect(d); }
+               }
+            }
+         }
+      }
+   }
+}
+#endif
+
+void LinearForm::UseFastAssembly(bool use_fa)
+{
+   delete ext;
+   ext = use_fa ? new LinearFormExtension(this) : NULL;
+}
+
 void LinearForm::Assemble()
 {
+   if (ext && ext->SupportsDevice())
+   {
+      ext->Assemble();
+      AssembleDelta();
+      return;
+   }
+
    Array<int> vdofs;
    ElementTransformation *eltrans;
    Vector elemvect;
@@ -90,7 +151,19 @@ void LinearForm::Assemble()
    // The first use of AddElementVector() below will move it back to host
    // because both 'vdofs' and 'elemvect' are on host.
 
-   if (dlfi.Size())
+   bool threaded = false;
+#ifdef MFEM_USE_THREADED_ASSEMBLY
+   threaded = dlfi.Size() > 0;
+   for (int k = 0; k < dlfi.Size(); k++)
+   {
+      threaded = threaded && dlfi[k]->SupportsThreadedAssembly();
+   }
+   if (threaded)
+   {
+      ColoredAssembleDomain(*fes, dlfi, HostReadWrite());
+   }
+#endif
+   if (dlfi.Size() && !threaded)
    {
       for (i = 0; i < fes -> GetNE(); i++)
       {
@@ -201,6 +274,7 @@ void LinearForm::Update(FiniteElementSpace *f, Vector &v, int v_offset)
    fes = f;
    NewDataAndSize((double *)v + v_offset, fes->GetVSize());
    ResetDeltaLocations();
+   if (ext) { ext->Update(); }
 }
 
 void LinearForm::AssembleDelta()
@@ -258,6 +332,7 @@ LinearForm & LinearForm::operator=(const Vector &v)
 
 LinearForm::~LinearForm()
 {
+   delete ext;
    if (!extern_lfs)
    {
       int k;
@@ -0,0 +1,179 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "linearform_ext.hpp"
+#include "linearform.hpp"
+#include "../general/forall.hpp"
+#include "../general/profiler.hpp"
+
+namespace mfem
+{
+
+LinearFormExtension::LinearFormExtension(LinearForm *form)
+   : lf(form), elem_restrict(NULL), bdr_dof(0)
+{
+   Update();
+}
+
+bool LinearFormExtension::SupportsDevice() const
+{
+   const FiniteElementSpace &fes = *lf->FESpace();
+   const Mesh &mesh = *fes.GetMesh();
+   if (fes.GetNURBSext() || lf->GetFLFI()->Size() > 0) { return false; }
+
+   Array<LinearFormIntegrator*> &dlfi = *lf->GetDLFI();
+   for (int k = 0; k < dlfi.Size(); k++)
+   {
+      if (!dlfi[k]->SupportsDevice()) { return false; }
+   }
+   if (dlfi.Size() > 0 && mesh.GetNE() > 0 &&
+       mesh.GetNumGeometries(mesh.Dimension()) != 1) { return false; }
+
+   Array<LinearFormIntegrator*> &blfi = *lf->GetBLFI();
+   for (int k = 0; k < blfi.Size(); k++)
+   {
+      if (!blfi[k]->SupportsDevice()) { return false; }
+   }
+   if (blfi.Size() > 0 && mesh.GetNBE() > 0 &&
+       (fes.GetVDim() != 1 || mesh.GetNumGeometries(mesh.Dimension()-1) != 1))
+   {
+      return false;
+   }
+   return true;
+}
+
+void LinearFormExtension::Update()
+{
+   const FiniteElementSpace &fes = *lf->FESpace();
+   const int NE = fes.GetNE();
+   elem_restrict = NE > 0 ?
+                   fes.GetElementRestriction(ElementDofOrdering::NATIVE) : NULL;
+   if (elem_restrict)
+   {
+      b_e.SetSize(elem_restrict->Height(), Device::GetMemoryType());
+   }
+   markers.SetSize(NE);
+   markers = 1;
+   bdr_offsets.SetSize(0);
+}
+
+void LinearFormExtension::SetupBoundary()
+{
+   // Same construction as in ElementRestriction, for the boundary elements
+   const FiniteElementSpace &fes = *lf->FESpace();
+   const Mesh &mesh = *fes.GetMesh();
+   const int NBE = fes.GetNBE();
+   const int ndofs = fes.GetNDofs();
+   bdr_dof = NBE > 0 ? fes.GetBE(0)->GetDof() : 0;
+
+   Array<int> dofs;
+   bdr_attributes.SetSize(NBE);
+   bdr_offsets.SetSize(ndofs+1);
+   bdr_offsets = 0;
+   bdr_indices.SetSize(NBE*bdr_dof);
+   for (int be = 0; be < NBE; be++)
+   {
+      bdr_attributes[be] = mesh.GetBdrAttribute(be);
+      fes.GetBdrElementDofs(be, dofs);
+      MFEM_ASSERT(dofs.Size() == bdr_dof, "invalid boundary element dofs");
+      for (int d = 0; d < bdr_dof; d++)
+      {
+         const int gid = (dofs[d] >= 0) ? dofs[d] : -1-dofs[d];
+         ++bdr_offsets[gid + 1];
+      }
+   }
+   for (int i = 1; i <= ndofs; i++)
+   {
+      bdr_offsets[i] += bdr_offsets[i - 1];
+   }
+   for (int be = 0; be < NBE; be++)
+   {
+      fes.GetBdrElementDofs(be, dofs);
+      for (int d = 0; d < bdr_dof; d++)
+      {
+         const int gid = (dofs[d] >= 0) ? dofs[d] : -1-dofs[d];
+         const int lid = bdr_dof*be + d;
+         bdr_indices[bdr_offsets[gid]++] = (dofs[d] >= 0) ? lid : -1-lid;
+      }
+   }
+   for (int i = ndofs; i > 0; i--)
+   {
+      bdr_offsets[i] = bdr_offsets[i - 1];
+   }
+   bdr_offsets[0] = 0;
+
+   bdr_e.SetSize(NBE*bdr_dof, Device::GetMemoryType());
+   bdr_markers.SetSize(NBE);
+}
+
+void LinearFormExtension::Assemble()
+{
+   MFEM_PERF_SCOPE("LinearFormExtension::Assemble");
+   const FiniteElementSpace &fes = *lf->FESpace();
+   MFEM_VERIFY(lf->Size() == fes.GetVSize(), "the LinearForm is not updated");
+
+   Vector &b = *lf;
+   b.UseDevice(true);
+   b = 0.0;
+
+   Array<LinearFormIntegrator*> &dlfi = *lf->GetDLFI();
+   if (dlfi.Size() > 0 && elem_restrict)
+   {
+      b_e.UseDevice(true);
+      b_e = 0.0;
+      for (int k = 0; k < dlfi.Size(); k++)
+      {
+         dlfi[k]->AssembleDevice(fes, markers, b_e);
+      }
+      elem_restrict->MultTranspose(b_e, b);
+   }
+
+   Array<LinearFormIntegrator*> &blfi = *lf->GetBLFI();
+   Array<Array<int>*> &blfi_marker = *lf->GetBLFI_Marker();
+   const int NBE = fes.GetNBE();
+   if (blfi.Size() == 0 || NBE == 0) { return; }
+
+   if (bdr_offsets.Size() == 0) { SetupBoundary(); }
+   bdr_e.UseDevice(true);
+   bdr_e = 0.0;
+   for (int k = 0; k < blfi.Size(); k++)
+   {
+      int *m = bdr_markers.HostWrite();
+      for (int be = 0; be < NBE; be++)
+      {
+         m[be] = blfi_marker[k] ? (*blfi_marker[k])[bdr_attributes[be]-1] : 1;
+      }
+      blfi[k]->AssembleDevice(fes, bdr_markers, bdr_e);
+   }
+
+   // Add the transpose of the boundary element restriction applied to bdr_e
+   const int ndofs = fes.GetNDofs();
+   const int nd = bdr_dof;
+   auto d_offsets = bdr_offsets.Read();
+   auto d_indices = bdr_indices.Read();
+   auto d_x = Reshape(bdr_e.Read(), nd, NBE);
+   auto d_y = b.ReadWrite();
+   MFEM_FORALL(i, ndofs,
+   {
+      const int offset = d_offsets[i];
+      const int nextOffset = d_offsets[i + 1];
+      double dofValue = 0.0;
+      for (int j = offset; j < nextOffset; ++j)
+      {
+         const int idx_j = (d_indices[j] >= 0) ? d_indices[j] : -1 - d_indices[j];
+         dofValue += (d_indices[j] >= 0) ? d_x(idx_j % nd, idx_j / nd) :
+                     -d_x(idx_j % nd, idx_j / nd);
+      }
+      d_y[i] += dofValue;
+   });
+}
+
+} // namespace mfem
@@ -0,0 +1,73 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_LINEARFORM_EXT
+#define MFEM_LINEARFORM_EXT
+
+#include "../config/config.hpp"
+#include "fespace.hpp"
+
+namespace mfem
+{
+
+class LinearForm;
+
+/** @brief Class extending the LinearForm class to support assembly on devices,
+    see LinearForm::UseFastAssembly().
+
+    The element vectors of all domain and boundary integrators are computed
+    with LinearFormIntegrator::AssembleDevice() into E-vectors, which are then
+    added to the L-vector with the transpose of the element restriction. */
+class LinearFormExtension
+{
+protected:
+   LinearForm *lf; ///< Not owned
+
+   /// Element restriction of the domain integrators, not owned
+   const Operator *elem_restrict;
+
+   /// E-vectors of the elements and of the boundary elements
+   Vector b_e, bdr_e;
+
+   /// Markers of the elements (all ones) and of the boundary elements
+   Array<int> markers, bdr_markers;
+
+   /// Attributes of the boundary elements
+   Array<int> bdr_attributes;
+
+   /** Number of dofs per boundary element, and the map from the dofs to the
+       entries of the boundary E-vector, in the format of ElementRestriction. */
+   int bdr_dof;
+   Array<int> bdr_offsets, bdr_indices;
+
+   /// Build the maps of the boundary elements
+   void SetupBoundary();
+
+public:
+   LinearFormExtension(LinearForm *form);
+
+   /** @brief Returns true if the integrators and the FiniteElementSpace of
+       the LinearForm are supported. */
+   /** All domain and boundary integrators must support AssembleDevice(),
+       there can be no boundary face integrators, and the elements (and the
+       boundary elements) must be of the same type. */
+   bool SupportsDevice() const;
+
+   /// Assemble the LinearForm on the device
+   void Assemble();
+
+   /// Update the data after the FiniteElementSpace has changed
+   void Update();
+};
+
+} // namespace mfem
+
+#endif
@@ -22,6 +22,12 @@ void LinearFormIntegrator::AssembleRHSElementVect(
    mfem_error("LinearFormIntegrator::AssembleRHSElementVect(...)");
 }
 
+void LinearFormIntegrator::AssembleDevice(const FiniteElementSpace &fes,
+                                          const Array<int> &markers, Vector &b)
+{
+   MFEM_ABORT("AssembleDevice is not supported by this integrator.");
+}
+
 
 void DomainLFIntegrator::AssembleRHSElementVect(const FiniteElement &el,
                                                 ElementTransformation &Tr,
@@ -29,6 +35,9 @@ void DomainLFIntegrator::AssembleRHSElementVect(const FiniteElement &el,
 {
    int dof = el.GetDof();
 
+#ifdef MFEM_THREAD_SAFE
+   Vector shape;
+#endif
    shape.SetSize(dof);       // vector of size dof
    elvect.SetSize(dof);
    elvect = 0.0;
@@ -204,6 +213,9 @@ void VectorDomainLFIntegrator::AssembleRHSElementVect(
 
    double val,cf;
 
+#ifdef MFEM_THREAD_SAFE
+   Vector shape, Qvec;
+#endif
    shape.SetSize(dof);       // vector of size dof
 
    elvect.SetSize(dof * vdim);
@@ -245,6 +257,9 @@ void VectorDomainLFIntegrator::AssembleDeltaElementVect(
    int vdim = Q.GetVDim();
    int dof  = fe.GetDof();
 
+#ifdef MFEM_THREAD_SAFE
+   Vector shape, Qvec;
+#endif
    shape.SetSize(dof);
    fe.CalcPhysShape(Trans, shape);
 
@@ -339,6 +354,10 @@ void VectorFEDomainLFIntegrator::AssembleRHSElementVect(
    int dof = el.GetDof();
    int spaceDim = Tr.GetSpaceDim();
 
+#ifdef MFEM_THREAD_SAFE
+   DenseMatrix vshape;
+   Vector vec;
+#endif
    vshape.SetSize(dof,spaceDim);
    vec.SetSize(spaceDim);
 
@@ -374,6 +393,10 @@ void VectorFEDomainLFIntegrator::AssembleDeltaElementVect(
    int dof = fe.GetDof();
    int spaceDim = Trans.GetSpaceDim();
 
+#ifdef MFEM_THREAD_SAFE
+   DenseMatrix vshape;
+   Vector vec;
+#endif
    vshape.SetSize(dof, spaceDim);
    fe.CalcPhysVShape(Trans, vshape);
 
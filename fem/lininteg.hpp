@@ -18,6 +18,8 @@
 namespace mfem
 {
 
+class FiniteElementSpace;
+
 /// Abstract base class LinearFormIntegrator
 class LinearFormIntegrator
 {
@@ -36,6 +38,28 @@ public:
                                        FaceElementTransformations &Tr,
                                        Vector &elvect);
 
+   /// Returns true if the integrator implements AssembleDevice().
+   virtual bool SupportsDevice() const { return false; }
+
+   /** @brief Returns true if AssembleRHSElementVect() can be called for
+       different elements from several threads at the same time.
+
+       This requires the integrator to keep its work arrays local when MFEM is
+       built with MFEM_THREAD_SAFE. It is used by LinearForm::Assemble() with
+       MFEM_USE_THREADED_ASSEMBLY, which falls back to a serial loop when any
+       domain integrator returns false. */
+   virtual bool SupportsThreadedAssembly() const { return false; }
+
+   /** @brief Add the element vectors of all elements (or boundary elements,
+       for boundary integrators) of @a fes to the E-vector @a b.
+
+       The entries of @a b are ordered as (dofs, vdim, elements), using the
+       native ordering of the element dofs, see ElementRestriction. Elements
+       with @a markers equal to zero are skipped. The computations are performed
+       on the device for all elements at once. */
+   virtual void AssembleDevice(const FiniteElementSpace &fes,
+                               const Array<int> &markers, Vector &b);
+
    void SetIntRule(const IntegrationRule *ir) { IntRule = ir; }
    const IntegrationRule* GetIntRule() { return IntRule; }
 
@@ -92,7 +116,9 @@ public:
 /// Class for domain integration L(v) := (f, v)
 class DomainLFIntegrator : public DeltaLFIntegrator
 {
+#ifndef MFEM_THREAD_SAFE
    Vector shape;
+#endif
    Coefficient &Q;
    int oa, ob;
 public:
@@ -116,6 +142,13 @@ public:
                                          ElementTransformation &Trans,
                                          Vector &elvect);
 
+   virtual bool SupportsDevice() const { return true; }
+
+   virtual void AssembleDevice(const FiniteElementSpace &fes,
+                               const Array<int> &markers, Vector &b);
+
+   virtual bool SupportsThreadedAssembly() const { return true; }
+
    using LinearFormIntegrator::AssembleRHSElementVect;
 };
 
@@ -139,6 +172,14 @@ public:
    virtual void AssembleRHSElementVect(const FiniteElement &el,
                                        FaceElementTransformations &Tr,
                                        Vector &elvect);
+
+   virtual bool SupportsDevice() const { return true; }
+
+   /** The quadrature data of the boundary elements is computed on the host
+       with their ElementTransformation%s, and the element vectors are computed
+       on the device. */
+   virtual void AssembleDevice(const FiniteElementSpace &fes,
+                               const Array<int> &markers, Vector &b);
 };
 
 /// Class for boundary integration \f$ L(v) = (g \cdot n, v) \f$
@@ -182,7 +223,9 @@ public:
 class VectorDomainLFIntegrator : public DeltaLFIntegrator
 {
 private:
+#ifndef MFEM_THREAD_SAFE
    Vector shape, Qvec;
+#endif
    VectorCoefficient &Q;
 
 public:
@@ -200,6 +243,13 @@ public:
                                          ElementTransformation &Trans,
                                          Vector &elvect);
 
+   virtual bool SupportsDevice() const { return true; }
+
+   virtual void AssembleDevice(const FiniteElementSpace &fes,
+                               const Array<int> &markers, Vector &b);
+
+   virtual bool SupportsThreadedAssembly() const { return true; }
+
    using LinearFormIntegrator::AssembleRHSElementVect;
 };
 
@@ -234,8 +284,10 @@ class VectorFEDomainLFIntegrator : public DeltaLFIntegrator
 {
 private:
    VectorCoefficient &QF;
+#ifndef MFEM_THREAD_SAFE
    DenseMatrix vshape;
    Vector vec;
+#endif
 
 public:
    VectorFEDomainLFIntegrator(VectorCoefficient &F)
@@ -249,6 +301,13 @@ public:
                                          ElementTransformation &Trans,
                                          Vector &elvect);
 
+   virtual bool SupportsDevice() const { return true; }
+
+   virtual void AssembleDevice(const FiniteElementSpace &fes,
+                               const Array<int> &markers, Vector &b);
+
+   virtual bool SupportsThreadedAssembly() const { return true; }
+
    using LinearFormIntegrator::AssembleRHSElementVect;
 };
 
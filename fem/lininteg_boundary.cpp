@@ -0,0 +1,69 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../general/forall.hpp"
+#include "fem.hpp"
+
+namespace mfem
+{
+
+// Defined in lininteg_domain.cpp
+void LFApplyBt(const int NE,
+               const int NQ,
+               const int ND,
+               const int VDIM,
+               const Array<int> &markers,
+               const Array<double> &B,
+               const Vector &qd,
+               Vector &y);
+
+void BoundaryLFIntegrator::AssembleDevice(const FiniteElementSpace &fes,
+                                          const Array<int> &markers, Vector &b)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int NBE = fes.GetNBE();
+   if (NBE == 0) { return; }
+   MFEM_VERIFY(fes.GetVDim() == 1, "invalid FiniteElementSpace vdim");
+   const FiniteElement &el = *fes.GetBE(0);
+   const IntegrationRule &ir = IntRule ? *IntRule :
+                               IntRules.Get(el.GetGeomType(),
+                                            oa * el.GetOrder() + ob);
+   const int NQ = ir.GetNPoints();
+   const int ND = el.GetDof();
+   const DofToQuad &maps = el.GetDofToQuad(ir, DofToQuad::FULL);
+
+   // The boundary is lower-dimensional, so the quadrature data is computed on
+   // the host, where all coefficients can be evaluated.
+   Vector qd(NQ * NBE);
+   auto D = Reshape(qd.HostWrite(), NQ, NBE);
+   const int *M = markers.HostRead();
+   ConstantCoefficient *cQ = dynamic_cast<ConstantCoefficient*>(&Q);
+   for (int be = 0; be < NBE; be++)
+   {
+      if (M[be] == 0)
+      {
+         for (int q = 0; q < NQ; q++) { D(q,be) = 0.0; }
+         continue;
+      }
+      ElementTransformation &Tr = *mesh->GetBdrElementTransformation(be);
+      for (int q = 0; q < NQ; q++)
+      {
+         const IntegrationPoint &ip = ir.IntPoint(q);
+         Tr.SetIntPoint(&ip);
+         const double val = cQ ? cQ->constant : Q.Eval(Tr, ip);
+         D(q,be) = ip.weight * Tr.Weight() * val;
+      }
+   }
+
+   LFApplyBt(NBE, NQ, ND, 1, markers, maps.B, qd, b);
+}
+
+} // namespace mfem
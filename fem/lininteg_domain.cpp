@@ -0,0 +1,285 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../general/forall.hpp"
+#include "fem.hpp"
+
+namespace mfem
+{
+
+// Defined in bilininteg_mass_pa.cpp
+void PAEvalCoefficient(Coefficient *Q, Mesh *mesh, const IntegrationRule &ir,
+                       Vector &coeff);
+
+// Defined in bilininteg_vectorfe.cpp
+void PAVectorFESimplexShape(const FiniteElement &el,
+                            const IntegrationRule &ir,
+                            const int deriv_type,
+                            Vector &shape);
+
+// Add to the E-vector @a y, of size ND x VDIM x NE, the transpose of the basis
+// table @a B (NQ x ND) applied to the quadrature data @a qd (NQ x VDIM x NE),
+// in the elements with nonzero @a markers.
+void LFApplyBt(const int NE,
+               const int NQ,
+               const int ND,
+               const int VDIM,
+               const Array<int> &markers,
+               const Array<double> &B,
+               const Vector &qd,
+               Vector &y)
+{
+   auto M = markers.Read();
+   auto Bq = Reshape(B.Read(), NQ, ND);
+   auto D = Reshape(qd.Read(), NQ, VDIM, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, VDIM, NE);
+   MFEM_FORALL(e, NE,
+   {
+      if (M[e] == 0) { return; }
+      for (int c = 0; c < VDIM; ++c)
+      {
+         for (int d = 0; d < ND; ++d)
+         {
+            double s = 0.0;
+            for (int q = 0; q < NQ; ++q)
+            {
+               s += Bq(q,d) * D(q,c,e);
+            }
+            Y(d,c,e) += s;
+         }
+      }
+   });
+}
+
+// Quadrature data of the H1 domain integrators: the weights times the
+// determinants times the coefficient values @a coeff, which are either a
+// single constant, or of size VDIM x NQ x NE, see QuadratureFunction.
+static void LFDomainSetup(const int NE,
+                          const int NQ,
+                          const int VDIM,
+                          const Array<double> &w,
+                          const Vector &detJ,
+                          const Vector &coeff,
+                          Vector &qd)
+{
+   const bool const_c = coeff.Size() == 1;
+   auto W = w.Read();
+   auto J = Reshape(detJ.Read(), NQ, NE);
+   auto C = const_c ? Reshape(coeff.Read(), 1, 1, 1) :
+            Reshape(coeff.Read(), VDIM, NQ, NE);
+   auto D = Reshape(qd.Write(), NQ, VDIM, NE);
+   MFEM_FORALL(e, NE,
+   {
+      for (int q = 0; q < NQ; ++q)
+      {
+         const double wq = W[q] * J(q,e);
+         for (int c = 0; c < VDIM; ++c)
+         {
+            D(q,c,e) = wq * (const_c ? C(0,0,0) : C(c,q,e));
+         }
+      }
+   });
+}
+
+// Device assembly of the H1 domain integrators with a scalar (VDIM = 1) or
+// vector coefficient.
+static void LFDomainAssemble(const FiniteElementSpace &fes,
+                             const IntegrationRule *IntRule,
+                             const int order,
+                             Coefficient *Q,
+                             VectorCoefficient *VQ,
+                             const Array<int> &markers,
+                             Vector &b)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int NE = fes.GetNE();
+   if (NE == 0) { return; }
+   const FiniteElement &el = *fes.GetFE(0);
+   const IntegrationRule &ir =
+      IntRule ? *IntRule : IntRules.Get(el.GetGeomType(), order);
+   const int NQ = ir.GetNPoints();
+   const int ND = el.GetDof();
+   const int VDIM = VQ ? VQ->GetVDim() : 1;
+   MFEM_VERIFY(fes.GetVDim() == VDIM, "invalid FiniteElementSpace vdim");
+
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(ir, GeometricFactors::DETERMINANTS);
+   const DofToQuad &maps = el.GetDofToQuad(ir, DofToQuad::FULL);
+
+   Vector coeff;
+   if (VQ)
+   {
+      coeff.SetSize(VDIM * NQ * NE);
+      QuadratureSpace qs(mesh, ir);
+      QuadratureFunction qf(&qs, coeff.HostWrite(), VDIM);
+      VQ->Project(qf);
+   }
+   else
+   {
+      PAEvalCoefficient(Q, mesh, ir, coeff);
+   }
+
+   Vector qd(NQ * VDIM * NE);
+   LFDomainSetup(NE, NQ, VDIM, ir.GetWeights(), geom->detJ, coeff, qd);
+   LFApplyBt(NE, NQ, ND, VDIM, markers, maps.B, qd, b);
+}
+
+void DomainLFIntegrator::AssembleDevice(const FiniteElementSpace &fes,
+                                        const Array<int> &markers, Vector &b)
+{
+   const int NE = fes.GetNE();
+   const int order = NE ? oa * fes.GetFE(0)->GetOrder() + ob : 0;
+   LFDomainAssemble(fes, IntRule, order, &Q, NULL, markers, b);
+}
+
+void VectorDomainLFIntegrator::AssembleDevice(const FiniteElementSpace &fes,
+                                              const Array<int> &markers,
+                                              Vector &b)
+{
+   const int NE = fes.GetNE();
+   const int order = NE ? 2 * fes.GetFE(0)->GetOrder() : 0;
+   LFDomainAssemble(fes, IntRule, order, NULL, &Q, markers, b);
+}
+
+// Quadrature data of the VectorFEDomainLFIntegrator: the coefficient mapped
+// to the reference element, adj(J) f for H(curl) and J^T f for H(div), times
+// the weights, stored as NQ x DIM x NE.
+template<int DIM>
+static void LFVectorFESetup(const int NE,
+                            const int NQ,
+                            const bool hcurl,
+                            const Array<double> &w,
+                            const Vector &jac,
+                            const Vector &coeff,
+                            Vector &qd)
+{
+   auto W = w.Read();
+   auto J = Reshape(jac.Read(), NQ, DIM, DIM, NE);
+   auto F = Reshape(coeff.Read(), DIM, NQ, NE);
+   auto D = Reshape(qd.Write(), NQ, DIM, NE);
+   MFEM_FORALL(e, NE,
+   {
+      for (int q = 0; q < NQ; ++q)
+      {
+         // A = adj(J) or J^T
+         double A[DIM*DIM];
+         if (!hcurl)
+         {
+            for (int i = 0; i < DIM; ++i)
+            {
+               for (int j = 0; j < DIM; ++j) { A[i+DIM*j] = J(q,j,i,e); }
+            }
+         }
+         else if (DIM == 2)
+         {
+            A[0] =  J(q,1,1,e); A[2] = -J(q,0,1,e);
+            A[1] = -J(q,1,0,e); A[3] =  J(q,0,0,e);
+         }
+         else
+         {
+            const double J11 = J(q,0,0,e), J12 = J(q,0,1,e), J13 = J(q,0,2,e);
+            const double J21 = J(q,1,0,e), J22 = J(q,1,1,e), J23 = J(q,1,2,e);
+            const double J31 = J(q,2,0,e), J32 = J(q,2,1,e), J33 = J(q,2,2,e);
+            A[0+DIM*0] = J22*J33 - J23*J32;
+            A[0+DIM*1] = J13*J32 - J12*J33;
+            A[0+DIM*2] = J12*J23 - J13*J22;
+            A[1+DIM*0] = J23*J31 - J21*J33;
+            A[1+DIM*1] = J11*J33 - J13*J31;
+            A[1+DIM*2] = J13*J21 - J11*J23;
+            A[2+DIM*0] = J21*J32 - J22*J31;
+            A[2+DIM*1] = J12*J31 - J11*J32;
+            A[2+DIM*2] = J11*J22 - J12*J21;
+         }
+         for (int i = 0; i < DIM; ++i)
+         {
+            double s = 0.0;
+            for (int j = 0; j < DIM; ++j) { s += A[i+DIM*j] * F(j,q,e); }
+            D(q,i,e) = W[q] * s;
+         }
+      }
+   });
+}
+
+// Add to the E-vector @a y (ND x NE) the reference vector shape functions
+// @a shape (ND x DIM x NQ) contracted with the quadrature data @a qd.
+static void LFVectorFEApply(const int NE,
+                            const int NQ,
+                            const int ND,
+                            const int DIM,
+                            const Array<int> &markers,
+                            const Vector &shape,
+                            const Vector &qd,
+                            Vector &y)
+{
+   auto M = markers.Read();
+   auto B = Reshape(shape.Read(), ND, DIM, NQ);
+   auto D = Reshape(qd.Read(), NQ, DIM, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   MFEM_FORALL(e, NE,
+   {
+      if (M[e] == 0) { return; }
+      for (int d = 0; d < ND; ++d)
+      {
+         double s = 0.0;
+         for (int q = 0; q < NQ; ++q)
+         {
+            for (int c = 0; c < DIM; ++c) { s += B(d,c,q) * D(q,c,e); }
+         }
+         Y(d,e) += s;
+      }
+   });
+}
+
+void VectorFEDomainLFIntegrator::AssembleDevice(const FiniteElementSpace &fes,
+                                                const Array<int> &markers,
+                                                Vector &b)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int NE = fes.GetNE();
+   if (NE == 0) { return; }
+   const FiniteElement &el = *fes.GetFE(0);
+   const int dim = el.GetDim();
+   MFEM_VERIFY(dim == 2 || dim == 3, "unsupported dimension");
+   MFEM_VERIFY(mesh->SpaceDimension() == dim, "unsupported space dimension");
+   MFEM_VERIFY(QF.GetVDim() == dim, "invalid VectorCoefficient vdim");
+   const int map_type = el.GetMapType();
+   MFEM_VERIFY(map_type == FiniteElement::H_CURL ||
+               map_type == FiniteElement::H_DIV, "invalid FiniteElement");
+
+   const IntegrationRule &ir =
+      IntRule ? *IntRule : IntRules.Get(el.GetGeomType(), 2*el.GetOrder());
+   const int NQ = ir.GetNPoints();
+   const int ND = el.GetDof();
+
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(ir, GeometricFactors::JACOBIANS);
+   Vector shape;
+   PAVectorFESimplexShape(el, ir, FiniteElement::NONE, shape);
+
+   Vector coeff(dim * NQ * NE);
+   QuadratureSpace qs(mesh, ir);
+   QuadratureFunction qf(&qs, coeff.HostWrite(), dim);
+   QF.Project(qf);
+
+   Vector qd(NQ * dim * NE);
+   const bool hcurl = map_type == FiniteElement::H_CURL;
+   if (dim == 2)
+   {
+      LFVectorFESetup<2>(NE, NQ, hcurl, ir.GetWeights(), geom->J, coeff, qd);
+   }
+   else
+   {
+      LFVectorFESetup<3>(NE, NQ, hcurl, ir.GetWeights(), geom->J, coeff, qd);
+   }
+   LFVectorFEApply(NE, NQ, ND, dim, markers, shape, qd, b);
+}
+
+} // namespace mfem
@@ -10,6 +10,11 @@
 // CONTRIBUTING.md for details.
 
 #include "multigrid.hpp"
+#include "transfer.hpp"
+#include "../linalg/solvers.hpp"
+#ifdef MFEM_USE_MPI
+#include "pbilinearform.hpp"
+#endif
 
 namespace mfem
 {
@@ -203,4 +208,195 @@ void Multigrid::RecoverFineFEMSolution(const Vector& X, const Vector& b,
    bfs.Last()->RecoverFEMSolution(X, b, x);
 }
 
+PMultigridPreconditioner::PMultigridPreconditioner(
+   FiniteElementSpace& fespace, const Array<int>& ess_bdr,
+   const BilinearFormBuilder& builder, int chebOrder)
+   : Multigrid(*MakeHierarchy(fespace)), coarsePrec(NULL)
+{
+   FiniteElementSpaceHierarchy& hierarchy =
+      const_cast<FiniteElementSpaceHierarchy&>(fespaces);
+
+   for (int level = 0; level < hierarchy.GetNumLevels(); ++level)
+   {
+      FiniteElementSpace& fes = hierarchy.GetFESpaceAtLevel(level);
+      BilinearForm* form = MakeForm(fes, ess_bdr, builder, level > 0);
+      const Array<int>& ess_tdofs = *essentialTrueDofs.Last();
+#ifdef MFEM_USE_MPI
+      ParFiniteElementSpace* pfes = dynamic_cast<ParFiniteElementSpace*>(&fes);
+#endif
+
+      OperatorPtr opr;
+      opr.SetType(Operator::ANY_TYPE);
+#ifdef MFEM_USE_MPI
+      if (level == 0 && pfes) { opr.SetType(Operator::Hypre_ParCSR); }
+#endif
+      form->FormSystemMatrix(ess_tdofs, opr);
+      const bool ownOperator = opr.OwnsOperator();
+      opr.SetOperatorOwner(false);
+
+      Solver* smoother;
+      if (level == 0)
+      {
+#ifdef MFEM_USE_MPI
+         if (pfes)
+         {
+            HypreBoomerAMG* amg = new HypreBoomerAMG(*opr.As<HypreParMatrix>());
+            amg->SetPrintLevel(0);
+            smoother = amg;
+         }
+         else
+#endif
+         {
+            SparseMatrix& mat = *opr.As<SparseMatrix>();
+#ifdef MFEM_USE_SUITESPARSE
+            smoother = new UMFPackSolver(mat);
+#else
+            coarsePrec = new GSSmoother(mat);
+            CGSolver* pcg = new CGSolver();
+            pcg->SetPrintLevel(-1);
+            pcg->SetMaxIter(1000);
+            pcg->SetRelTol(1e-8);
+            pcg->SetAbsTol(0.0);
+            pcg->SetOperator(mat);
+            pcg->SetPreconditioner(*coarsePrec);
+            smoother = pcg;
+#endif
+         }
+      }
+      else
+      {
+         Vector diag(fes.GetTrueVSize());
+         form->AssembleDiagonal(diag);
+#ifdef MFEM_USE_MPI
+         smoother = new OperatorChebyshevSmoother(
+            opr.Ptr(), diag, ess_tdofs, chebOrder,
+            pfes ? pfes->GetComm() : MPI_COMM_NULL);
+#else
+         smoother = new OperatorChebyshevSmoother(opr.Ptr(), diag, ess_tdofs,
+                                                  chebOrder);
+#endif
+      }
+      AddLevel(opr.Ptr(), smoother, ownOperator, true);
+   }
+}
+
+PMultigridPreconditioner::~PMultigridPreconditioner()
+{
+   delete coarsePrec;
+
+   // The forms refer to the spaces of the hierarchy, so they are deleted first
+   for (int i = 0; i < bfs.Size(); ++i)
+   {
+      delete bfs[i];
+   }
+   bfs.DeleteAll();
+
+   Array<const FiniteElementCollection*> fecs;
+   for (int level = 0; level < fespaces.GetFinestLevelIndex(); ++level)
+   {
+      fecs.Append(fespaces.GetFESpaceAtLevel(level).FEColl());
+   }
+   delete &fespaces;
+   for (int i = 0; i < fecs.Size(); ++i)
+   {
+      delete fecs[i];
+   }
+}
+
+FiniteElementSpaceHierarchy* PMultigridPreconditioner::MakeHierarchy(
+   FiniteElementSpace& fespace)
+{
+   const H1_FECollection* fec =
+      dynamic_cast<const H1_FECollection*>(fespace.FEColl());
+   MFEM_VERIFY(fec, "p-multigrid requires an H1 space");
+
+   Mesh* mesh = fespace.GetMesh();
+   const int dim = mesh->Dimension();
+   const int vdim = fespace.GetVDim();
+   const int ordering = fespace.GetOrdering();
+   const int btype = fec->GetBasisType();
+   const int order =
+      fec->FiniteElementForGeometry(Geometry::SEGMENT)->GetOrder();
+
+   Array<int> orders;
+   for (int p = order / 2; p > 1; p /= 2) { orders.Prepend(p); }
+   if (order > 1) { orders.Prepend(1); }
+
+   FiniteElementSpaceHierarchy* hierarchy;
+#ifdef MFEM_USE_MPI
+   ParFiniteElementSpace* pfes = dynamic_cast<ParFiniteElementSpace*>(&fespace);
+   if (pfes)
+   {
+      if (orders.Size() == 0)
+      {
+         return new ParFiniteElementSpaceHierarchy(pfes->GetParMesh(), pfes,
+                                                   false, false);
+      }
+      ParFiniteElementSpace* coarse = new ParFiniteElementSpace(
+         pfes->GetParMesh(), new H1_FECollection(orders[0], dim, btype), vdim,
+         ordering);
+      hierarchy = new ParFiniteElementSpaceHierarchy(pfes->GetParMesh(),
+                                                     coarse, false, true);
+   }
+   else
+#endif
+   {
+      if (orders.Size() == 0)
+      {
+         return new FiniteElementSpaceHierarchy(mesh, &fespace, false, false);
+      }
+      FiniteElementSpace* coarse = new FiniteElementSpace(
+         mesh, new H1_FECollection(orders[0], dim, btype), vdim, ordering);
+      hierarchy = new FiniteElementSpaceHierarchy(mesh, coarse, false, true);
+   }
+
+   for (int i = 1; i < orders.Size(); ++i)
+   {
+      hierarchy->AddOrderRefinedLevel(
+         new H1_FECollection(orders[i], dim, btype), vdim, ordering);
+   }
+
+   // The finest level is the given space
+   Operator* P;
+#ifdef MFEM_USE_MPI
+   if (pfes)
+   {
+      P = new TrueTransferOperator(
+         static_cast<ParFiniteElementSpace&>(hierarchy->GetFinestFESpace()),
+         *pfes);
+   }
+   else
+#endif
+   {
+      P = new TransferOperator(hierarchy->GetFinestFESpace(), fespace);
+   }
+   hierarchy->AddLevel(mesh, &fespace, P, false, false, true);
+   return hierarchy;
+}
+
+BilinearForm* PMultigridPreconditioner::MakeForm(
+   FiniteElementSpace& fespace, const Array<int>& ess_bdr,
+   const BilinearFormBuilder& builder, bool partial)
+{
+   BilinearForm* form;
+#ifdef MFEM_USE_MPI
+   ParFiniteElementSpace* pfes = dynamic_cast<ParFiniteElementSpace*>(&fespace);
+   if (pfes) { form = new ParBilinearForm(pfes); }
+   else
+#endif
+   {
+      form = new BilinearForm(&fespace);
+   }
+   if (partial) { form->SetAssemblyLevel(AssemblyLevel::PARTIAL); }
+   form->SetDiagonalPolicy(Matrix::DIAG_ONE);
+   builder.AddIntegrators(*form);
+   form->Assemble();
+   if (!partial) { form->Finalize(); }
+   bfs.Append(form);
+
+   essentialTrueDofs.Append(new Array<int>());
+   fespace.GetEssentialTrueDofs(ess_bdr, *essentialTrueDofs.Last());
+   return form;
+}
+
 } // namespace mfem
@@ -114,6 +114,59 @@ private:
    void Cycle(int level) const;
 };
 
+/// Abstract class adding the domain integrators of a problem to a bilinear
+/// form, used by PMultigridPreconditioner to build the operator of each level.
+class BilinearFormBuilder
+{
+public:
+   /// Add the integrators to the @a form defined on one of the levels.
+   virtual void AddIntegrators(BilinearForm& form) const = 0;
+
+   virtual ~BilinearFormBuilder() { }
+};
+
+/** @brief Matrix-free p-multigrid preconditioner for problems posed in an H1
+    space of order p.
+
+    The levels use the orders p, p/2, ..., 1 on the mesh of the given space,
+    the finest level being the given space itself. The levels are connected by
+    the transfer operators of FiniteElementSpaceHierarchy, which use sum
+    factorization for tensor-product elements. All levels except the coarsest
+    one are partially assembled and smoothed with a Chebyshev smoother based on
+    the partially assembled diagonal. The coarsest level is fully assembled and
+    solved with one BoomerAMG V-cycle in parallel, and with UMFPACK, if
+    available, or Gauss-Seidel preconditioned CG in serial.
+
+    The integrators of all levels are added by the given BilinearFormBuilder,
+    which is only used in the constructor. */
+class PMultigridPreconditioner : public Multigrid
+{
+private:
+   Solver* coarsePrec;
+
+   static FiniteElementSpaceHierarchy* MakeHierarchy(FiniteElementSpace&
+                                                     fespace);
+
+   BilinearForm* MakeForm(FiniteElementSpace& fespace,
+                          const Array<int>& ess_bdr,
+                          const BilinearFormBuilder& builder, bool partial);
+
+public:
+   /// Constructs the p-multigrid for @a fespace with essential boundary
+   /// attributes @a ess_bdr, using Chebyshev smoothers of order @a chebOrder.
+   PMultigridPreconditioner(FiniteElementSpace& fespace,
+                            const Array<int>& ess_bdr,
+                            const BilinearFormBuilder& builder,
+                            int chebOrder = 2);
+
+   /// Destructor deleting the levels and the coarse spaces
+   virtual ~PMultigridPreconditioner();
+
+   /// Returns the FiniteElementSpaceHierarchy of the levels
+   const FiniteElementSpaceHierarchy& GetFESpaceHierarchy() const
+   { return fespaces; }
+};
+
 } // namespace mfem
 
 #endif
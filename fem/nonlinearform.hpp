@@ -46,6 +46,9 @@ protected:
 
    mutable SparseMatrix *Grad, *cGrad; // owned
 
+   /// Gradient Operator when using an extension, see GetGradient().
+   mutable OperatorHandle hGrad; // owned
+
    /// A list of all essential true dofs
    Array<int> ess_tdof_list;
 
@@ -154,7 +157,10 @@ public:
 
        In general, @a x may have non-homogeneous essential boundary values.
 
-       The state @a x must be a true-dof vector. */
+       The state @a x must be a true-dof vector.
+
+       With AssemblyLevel::PARTIAL, the returned Operator is the partially
+       assembled true-dof gradient and no matrix is assembled. */
    virtual Operator &GetGradient(const Vector &x) const;
 
    /// Update the NonlinearForm to propagate updates of the associated FE space.
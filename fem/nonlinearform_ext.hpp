@@ -26,19 +26,41 @@ protected:
 public:
    NonlinearFormExtension(NonlinearForm *form);
    virtual void AssemblePA() = 0;
+   /// Return the gradient Operator at the state @a x (an L-vector).
+   /** The returned Operator acts on L-vectors; its prolongation and
+       restriction are those of the FE space, so that the true-dof gradient can
+       be obtained with Operator::FormSystemOperator(). */
+   virtual Operator &GetGradient(const Vector &x) const = 0;
 };
 
 /// Data and methods for partially-assembled nonlinear forms
 class PANonlinearFormExtension : public NonlinearFormExtension
 {
 protected:
+   /// Partially assembled gradient Operator, see GetGradient().
+   class Gradient : public Operator
+   {
+   protected:
+      const PANonlinearFormExtension &ext;
+   public:
+      Gradient(const PANonlinearFormExtension &e);
+      virtual void Mult(const Vector &x, Vector &y) const;
+      virtual const Operator *GetProlongation() const;
+      virtual const Operator *GetRestriction() const;
+   };
+
    const FiniteElementSpace &fes; // Not owned
    mutable Vector localX, localY;
    const Operator *elem_restrict_lex; // Not owned
+   mutable Gradient Grad;
 public:
    PANonlinearFormExtension(NonlinearForm*);
    void AssemblePA();
    void Mult(const Vector &x, Vector &y) const;
+   /** @brief Assemble the gradient of the integrators at @a x, see
+       NonlinearFormIntegrator::AssembleGradPA(), and return the partially
+       assembled gradient Operator. */
+   Operator &GetGradient(const Vector &x) const;
 };
 }
 #endif // NONLINEARFORM_EXT_HPP
@@ -34,6 +34,19 @@ void NonlinearFormIntegrator::AddMultPA(const Vector &, Vector &) const
                "   is not implemented for this class.");
 }
 
+void NonlinearFormIntegrator::AssembleGradPA(const Vector &,
+                                             const FiniteElementSpace &)
+{
+   mfem_error ("NonlinearFormIntegrator::AssembleGradPA(...)\n"
+               "   is not implemented for this class.");
+}
+
+void NonlinearFormIntegrator::AddMultGradPA(const Vector &, Vector &) const
+{
+   mfem_error ("NonlinearFormIntegrator::AddMultGradPA(...)\n"
+               "   is not implemented for this class.");
+}
+
 void NonlinearFormIntegrator::AssembleElementVector(
    const FiniteElement &el, ElementTransformation &Tr,
    const Vector &elfun, Vector &elvect)
@@ -345,6 +358,37 @@ void NeoHookeanModel::AssembleH(const DenseMatrix &J, const DenseMatrix &DS,
             }
 }
 
+void NeoHookeanModel::EvalCoeffsPA(Mesh &mesh, const IntegrationRule &ir,
+                                   Vector &params) const
+{
+   const int NE = mesh.GetNE();
+   const int NQ = ir.GetNPoints();
+   params.SetSize(NQ * 3 * NE, Device::GetMemoryType());
+   auto C = Reshape(params.HostWrite(), NQ, 3, NE);
+   for (int e = 0; e < NE; e++)
+   {
+      ElementTransformation *T = have_coeffs ?
+                                 mesh.GetElementTransformation(e) : NULL;
+      for (int q = 0; q < NQ; q++)
+      {
+         if (have_coeffs)
+         {
+            const IntegrationPoint &ip = ir.IntPoint(q);
+            T->SetIntPoint(&ip);
+            C(q,0,e) = c_mu->Eval(*T, ip);
+            C(q,1,e) = c_K->Eval(*T, ip);
+            C(q,2,e) = c_g ? c_g->Eval(*T, ip) : 1.0;
+         }
+         else
+         {
+            C(q,0,e) = mu;
+            C(q,1,e) = K;
+            C(q,2,e) = g;
+         }
+      }
+   }
+}
+
 
 double HyperelasticNLFIntegrator::GetElementEnergy(const FiniteElement &el,
                                                    ElementTransformation &Ttr,
@@ -89,6 +89,25 @@ public:
        called. */
    virtual void AddMultPA(const Vector &x, Vector &y) const;
 
+   /// Prepare the partially assembled gradient at the state @a x.
+   /** The input @a x is an E-vector, i.e. it represents the element-wise
+       discontinuous version of the state in the FE space @a fes. The data
+       computed here is stored internally so that it can be used later in the
+       method AddMultGradPA().
+
+       This method can be called only after the method AssemblePA() has been
+       called. */
+   virtual void AssembleGradPA(const Vector &x, const FiniteElementSpace &fes);
+
+   /// Method for partially assembled gradient action.
+   /** Perform the action of the gradient of the integrator, at the state given
+       to the last call of AssembleGradPA(), on the input @a x and add the
+       result to the output @a y. Both @a x and @a y are E-vectors.
+
+       This method can be called only after the method AssembleGradPA() has
+       been called. */
+   virtual void AddMultGradPA(const Vector &x, Vector &y) const;
+
    virtual ~NonlinearFormIntegrator() { }
 };
 
@@ -227,6 +246,15 @@ public:
 
    virtual void AssembleH(const DenseMatrix &J, const DenseMatrix &DS,
                           const double weight, DenseMatrix &A) const;
+
+   /** @brief Evaluate the parameters (mu, K, g) at all points of @a ir in all
+       elements of @a mesh.
+
+       The result is stored in @a params using a column-major layout with
+       dimensions (NQ x 3 x NE). This method is used by the partial assembly of
+       HyperelasticNLFIntegrator. */
+   void EvalCoeffsPA(Mesh &mesh, const IntegrationRule &ir,
+                     Vector &params) const;
 };
 
 
@@ -254,9 +282,26 @@ private:
    //        output - the result of AssembleElementVector() (dof x dim).
    DenseMatrix DSh, DS, Jrt, Jpr, Jpt, P, PMatI, PMatO;
 
+   // PA extension
+   enum { PA_NEO_HOOKEAN, PA_INVERSE_HARMONIC };
+   int pa_model;
+   const DofToQuad *maps;         ///< Not owned
+   const GeometricFactors *geom;  ///< Not owned
+   int dim, ne, nq;
+   //  pa_jinv: Jrt at all quadrature points (NQ x dim x dim x NE).
+   //  pa_wdet: quadrature weight times det(Jtr) (NQ x NE).
+   // pa_coeff: model parameters at all quadrature points, see
+   //           NeoHookeanModel::EvalCoeffsPA().
+   //  pa_grad: Jpt at the state given to AssembleGradPA() (NQ x dim x dim x
+   //           NE).
+   Vector pa_jinv, pa_wdet, pa_coeff, pa_grad;
+
+   void ApplyPA(const int mode, const Vector &x, Vector &y) const;
+
 public:
    /** @param[in] m  HyperelasticModel that will be integrated. */
-   HyperelasticNLFIntegrator(HyperelasticModel *m) : model(m) { }
+   HyperelasticNLFIntegrator(HyperelasticModel *m)
+      : model(m), maps(NULL), geom(NULL) { }
 
    /** @brief Computes the integral of W(Jacobian(Trt)) over a target zone
        @param[in] el     Type of FiniteElement.
@@ -273,6 +318,18 @@ public:
    virtual void AssembleElementGrad(const FiniteElement &el,
                                     ElementTransformation &Ttr,
                                     const Vector &elfun, DenseMatrix &elmat);
+
+   using NonlinearFormIntegrator::AssemblePA;
+
+   /** @brief Partial assembly on tensor-product elements (quadrilaterals and
+       hexahedra) for the NeoHookeanModel and InverseHarmonicModel. */
+   virtual void AssemblePA(const FiniteElementSpace &fes);
+
+   virtual void AddMultPA(const Vector &x, Vector &y) const;
+
+   virtual void AssembleGradPA(const Vector &x, const FiniteElementSpace &fes);
+
+   virtual void AddMultGradPA(const Vector &x, Vector &y) const;
 };
 
 /** Hyperelastic incompressible Neo-Hookean integrator with the PK1 stress
@@ -0,0 +1,763 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../general/forall.hpp"
+#include "../linalg/kernels.hpp"
+#include "nonlininteg.hpp"
+
+using namespace std;
+
+namespace mfem
+{
+
+// Modes of the hyperelastic PA kernels:
+// - HYPER_PA_MULT:      y += action of the integrator at the state x,
+// - HYPER_PA_GRAD_INIT: store Jpt at the state x,
+// - HYPER_PA_GRAD_MULT: y += action of the gradient, at the stored Jpt, on x.
+static constexpr int HYPER_PA_MULT = 0;
+static constexpr int HYPER_PA_GRAD_INIT = 1;
+static constexpr int HYPER_PA_GRAD_MULT = 2;
+
+// Evaluate the 1st Piola-Kirchhoff stress tensor P = P(F), where F is the
+// target->physical Jacobian matrix. The dim x dim matrices are column-major.
+// The parameters c = (mu, K, g) are used only by the Neo-Hookean model.
+template<int DIM> MFEM_HOST_DEVICE inline
+void HyperelasticEvalP(const bool neo_hookean, const double *c,
+                       const double *F, double *P)
+{
+   double Finv[DIM*DIM];
+   kernels::CalcInverse<DIM>(F, Finv);
+   const double dJ = kernels::Det<DIM>(F);
+   if (neo_hookean)
+   {
+      const double mu = c[0], K = c[1], g = c[2];
+      double FF = 0.0;
+      for (int i = 0; i < DIM*DIM; i++) { FF += F[i]*F[i]; }
+      const double a = mu*pow(dJ, -2.0/DIM);
+      const double b = K*(dJ/g - 1.0)/g - a*FF/(DIM*dJ);
+      for (int j = 0; j < DIM; j++)
+      {
+         for (int i = 0; i < DIM; i++)
+         {
+            // Z = adj(F)^t = det(F) F^{-t}
+            P[i+j*DIM] = a*F[i+j*DIM] + b*dJ*Finv[j+i*DIM];
+         }
+      }
+   }
+   else
+   {
+      // P = (1/2) tr(F^{-1} F^{-t}) det(F) F^{-t} - det(F) F^{-t} F^{-1} F^{-t}
+      double tau = 0.0;
+      for (int i = 0; i < DIM*DIM; i++) { tau += Finv[i]*Finv[i]; }
+      double FinvT[DIM*DIM], M1[DIM*DIM], M[DIM*DIM];
+      for (int j = 0; j < DIM; j++)
+      {
+         for (int i = 0; i < DIM; i++) { FinvT[i+j*DIM] = Finv[j+i*DIM]; }
+      }
+      kernels::Mult(DIM, DIM, DIM, Finv, FinvT, M1);
+      kernels::Mult(DIM, DIM, DIM, FinvT, M1, M);
+      for (int i = 0; i < DIM*DIM; i++)
+      {
+         P[i] = dJ*(0.5*tau*FinvT[i] - M[i]);
+      }
+   }
+}
+
+// Evaluate the directional derivative dP = dP/dF : dF of the 1st
+// Piola-Kirchhoff stress tensor at F in the direction dF.
+template<int DIM> MFEM_HOST_DEVICE inline
+void HyperelasticEvaldP(const bool neo_hookean, const double *c,
+                        const double *F, const double *dF, double *dP)
+{
+   double Finv[DIM*DIM], FinvT[DIM*DIM], T[DIM*DIM], dFinv[DIM*DIM];
+   kernels::CalcInverse<DIM>(F, Finv);
+   const double dJ = kernels::Det<DIM>(F);
+   for (int j = 0; j < DIM; j++)
+   {
+      for (int i = 0; i < DIM; i++) { FinvT[i+j*DIM] = Finv[j+i*DIM]; }
+   }
+   // d(F^{-1}) = -F^{-1} dF F^{-1}, d(det(F)) = det(F) F^{-t} : dF
+   kernels::Mult(DIM, DIM, DIM, dF, Finv, T);
+   kernels::Mult(DIM, DIM, DIM, Finv, T, dFinv);
+   double ddJ = 0.0;
+   for (int i = 0; i < DIM*DIM; i++)
+   {
+      dFinv[i] = -dFinv[i];
+      ddJ += FinvT[i]*dF[i];
+   }
+   ddJ *= dJ;
+   double dFinvT[DIM*DIM];
+   for (int j = 0; j < DIM; j++)
+   {
+      for (int i = 0; i < DIM; i++) { dFinvT[i+j*DIM] = dFinv[j+i*DIM]; }
+   }
+   if (neo_hookean)
+   {
+      const double mu = c[0], K = c[1], g = c[2];
+      double FF = 0.0, dFF = 0.0;
+      for (int i = 0; i < DIM*DIM; i++)
+      {
+         FF += F[i]*F[i];
+         dFF += 2.0*F[i]*dF[i];
+      }
+      const double a = mu*pow(dJ, -2.0/DIM);
+      const double b = K*(dJ/g - 1.0)/g - a*FF/(DIM*dJ);
+      const double da = -2.0/DIM*a*ddJ/dJ;
+      const double db = K*ddJ/(g*g) - (da*FF + a*dFF)/(DIM*dJ) +
+                        a*FF*ddJ/(DIM*dJ*dJ);
+      for (int i = 0; i < DIM*DIM; i++)
+      {
+         const double Z = dJ*FinvT[i];
+         const double dZ = ddJ*FinvT[i] + dJ*dFinvT[i];
+         dP[i] = da*F[i] + a*dF[i] + db*Z + b*dZ;
+      }
+   }
+   else
+   {
+      double tau = 0.0, dtau = 0.0;
+      for (int i = 0; i < DIM*DIM; i++)
+      {
+         tau += Finv[i]*Finv[i];
+         dtau += 2.0*Finv[i]*dFinv[i];
+      }
+      // M = F^{-t} F^{-1} F^{-t} and its derivative dM
+      double M1[DIM*DIM], M[DIM*DIM], dM[DIM*DIM];
+      kernels::Mult(DIM, DIM, DIM, Finv, FinvT, M1);
+      kernels::Mult(DIM, DIM, DIM, FinvT, M1, M);
+      kernels::Mult(DIM, DIM, DIM, dFinvT, M1, dM);
+      kernels::Mult(DIM, DIM, DIM, dFinv, FinvT, M1);
+      kernels::Mult(DIM, DIM, DIM, FinvT, M1, T);
+      for (int i = 0; i < DIM*DIM; i++) { dM[i] += T[i]; }
+      kernels::Mult(DIM, DIM, DIM, Finv, dFinvT, M1);
+      kernels::Mult(DIM, DIM, DIM, FinvT, M1, T);
+      for (int i = 0; i < DIM*DIM; i++)
+      {
+         dM[i] += T[i];
+         const double Z = dJ*FinvT[i];
+         const double dZ = ddJ*FinvT[i] + dJ*dFinvT[i];
+         dP[i] = 0.5*dtau*Z + 0.5*tau*dZ - ddJ*M[i] - dJ*dM[i];
+      }
+   }
+}
+
+// Point-wise part of the hyperelastic kernels: given the reference gradient H
+// of the input at a quadrature point, either store Jpt = H Jrt or replace H
+// with w det(Jtr) P Jrt^t, where P is the stress or its derivative.
+template<int DIM> MFEM_HOST_DEVICE inline
+bool HyperelasticQFunction(const int mode, const bool neo_hookean,
+                           const double *c, const double *Jrt,
+                           const double w, double *Fq, double *H)
+{
+   double Jpt[DIM*DIM], P[DIM*DIM];
+   kernels::Mult(DIM, DIM, DIM, H, Jrt, Jpt);
+   if (mode == HYPER_PA_GRAD_INIT)
+   {
+      for (int i = 0; i < DIM*DIM; i++) { Fq[i] = Jpt[i]; }
+      return false;
+   }
+   if (mode == HYPER_PA_MULT)
+   {
+      HyperelasticEvalP<DIM>(neo_hookean, c, Jpt, P);
+   }
+   else
+   {
+      HyperelasticEvaldP<DIM>(neo_hookean, c, Fq, Jpt, P);
+   }
+   kernels::MultABt(DIM, DIM, DIM, P, Jrt, H);
+   for (int i = 0; i < DIM*DIM; i++) { H[i] *= w; }
+   return true;
+}
+
+// PA Hyperelastic 2D kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAHyperelasticApply2D(const int mode,
+                                  const bool neo_hookean,
+                                  const int NE,
+                                  const Array<double> &b,
+                                  const Array<double> &g,
+                                  const Vector &jinv_,
+                                  const Vector &wdet_,
+                                  const Vector &c_,
+                                  const Vector &x_,
+                                  Vector &f_,
+                                  Vector &y_,
+                                  const int d1d = 0,
+                                  const int q1d = 0)
+{
+   constexpr int DIM = 2;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   const bool init = (mode == HYPER_PA_GRAD_INIT);
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto Jinv = Reshape(jinv_.Read(), Q1D, Q1D, DIM, DIM, NE);
+   auto W = Reshape(wdet_.Read(), Q1D, Q1D, NE);
+   auto C = Reshape(neo_hookean ? c_.Read() : NULL, Q1D, Q1D, 3, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, DIM, NE);
+   auto F = Reshape(init ? f_.Write() :
+                    (mode == HYPER_PA_GRAD_MULT ? f_.ReadWrite() : NULL),
+                    Q1D, Q1D, DIM, DIM, NE);
+   auto y = Reshape(init ? NULL : y_.ReadWrite(), D1D, D1D, DIM, NE);
+   MFEM_FORALL(e, NE,
+   {
+      constexpr int DIM = 2;
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      // grad[qy][qx][c][k]: derivative of component c in reference direction k
+      double grad[max_Q1D][max_Q1D][DIM][DIM];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int i = 0; i < DIM*DIM; ++i)
+            {
+               grad[qy][qx][i%DIM][i/DIM] = 0.0;
+            }
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         double gradX[max_Q1D][DIM][DIM];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int c = 0; c < DIM; ++c)
+            {
+               gradX[qx][c][0] = 0.0;
+               gradX[qx][c][1] = 0.0;
+            }
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            for (int c = 0; c < DIM; ++c)
+            {
+               const double s = x(dx, dy, c, e);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  gradX[qx][c][0] += s * G(qx, dx);
+                  gradX[qx][c][1] += s * B(qx, dx);
+               }
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const double By = B(qy, dy);
+            const double Gy = G(qy, dy);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  grad[qy][qx][c][0] += gradX[qx][c][0] * By;
+                  grad[qy][qx][c][1] += gradX[qx][c][1] * Gy;
+               }
+            }
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            double Jrt[DIM*DIM], H[DIM*DIM], Fq[DIM*DIM], c[3];
+            for (int j = 0; j < DIM; ++j)
+            {
+               for (int i = 0; i < DIM; ++i)
+               {
+                  Jrt[i+j*DIM] = Jinv(qx, qy, i, j, e);
+                  H[i+j*DIM] = grad[qy][qx][i][j];
+                  if (mode == HYPER_PA_GRAD_MULT)
+                  {
+                     Fq[i+j*DIM] = F(qx, qy, i, j, e);
+                  }
+               }
+            }
+            if (neo_hookean)
+            {
+               for (int k = 0; k < 3; ++k) { c[k] = C(qx, qy, k, e); }
+            }
+            if (!HyperelasticQFunction<DIM>(mode, neo_hookean, c, Jrt,
+                                            W(qx, qy, e), Fq, H))
+            {
+               for (int j = 0; j < DIM; ++j)
+               {
+                  for (int i = 0; i < DIM; ++i)
+                  {
+                     F(qx, qy, i, j, e) = Fq[i+j*DIM];
+                  }
+               }
+               continue;
+            }
+            for (int j = 0; j < DIM; ++j)
+            {
+               for (int i = 0; i < DIM; ++i)
+               {
+                  grad[qy][qx][i][j] = H[i+j*DIM];
+               }
+            }
+         }
+      }
+      if (init) { return; }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         double gradX[max_D1D][DIM][DIM];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            for (int c = 0; c < DIM; ++c)
+            {
+               gradX[dx][c][0] = 0.0;
+               gradX[dx][c][1] = 0.0;
+            }
+         }
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const double Bx = B(qx, dx);
+               const double Gx = G(qx, dx);
+               for (int c = 0; c < DIM; ++c)
+               {
+                  gradX[dx][c][0] += Gx * grad[qy][qx][c][0];
+                  gradX[dx][c][1] += Bx * grad[qy][qx][c][1];
+               }
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            const double By = B(qy, dy);
+            const double Gy = G(qy, dy);
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  y(dx, dy, c, e) += By * gradX[dx][c][0] +
+                                     Gy * gradX[dx][c][1];
+               }
+            }
+         }
+      }
+   });
+}
+
+// PA Hyperelastic 3D kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAHyperelasticApply3D(const int mode,
+                                  const bool neo_hookean,
+                                  const int NE,
+                                  const Array<double> &b,
+                                  const Array<double> &g,
+                                  const Vector &jinv_,
+                                  const Vector &wdet_,
+                                  const Vector &c_,
+                                  const Vector &x_,
+                                  Vector &f_,
+                                  Vector &y_,
+                                  const int d1d = 0,
+                                  const int q1d = 0)
+{
+   constexpr int DIM = 3;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   const bool init = (mode == HYPER_PA_GRAD_INIT);
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto Jinv = Reshape(jinv_.Read(), Q1D, Q1D, Q1D, DIM, DIM, NE);
+   auto W = Reshape(wdet_.Read(), Q1D, Q1D, Q1D, NE);
+   auto C = Reshape(neo_hookean ? c_.Read() : NULL, Q1D, Q1D, Q1D, 3, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, D1D, DIM, NE);
+   auto F = Reshape(init ? f_.Write() :
+                    (mode == HYPER_PA_GRAD_MULT ? f_.ReadWrite() : NULL),
+                    Q1D, Q1D, Q1D, DIM, DIM, NE);
+   auto y = Reshape(init ? NULL : y_.ReadWrite(), D1D, D1D, D1D, DIM, NE);
+   MFEM_FORALL(e, NE,
+   {
+      constexpr int DIM = 3;
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      // grad[qz][qy][qx][c][k]: derivative of component c in reference
+      // direction k
+      double grad[max_Q1D][max_Q1D][max_Q1D][DIM][DIM];
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int i = 0; i < DIM*DIM; ++i)
+               {
+                  grad[qz][qy][qx][i%DIM][i/DIM] = 0.0;
+               }
+            }
+         }
+      }
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         double gradXY[max_Q1D][max_Q1D][DIM][DIM];
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int i = 0; i < DIM*DIM; ++i)
+               {
+                  gradXY[qy][qx][i%DIM][i/DIM] = 0.0;
+               }
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            double gradX[max_Q1D][DIM][2];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  gradX[qx][c][0] = 0.0;
+                  gradX[qx][c][1] = 0.0;
+               }
+            }
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  const double s = x(dx, dy, dz, c, e);
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     gradX[qx][c][0] += s * G(qx, dx);
+                     gradX[qx][c][1] += s * B(qx, dx);
+                  }
+               }
+            }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               const double By = B(qy, dy);
+               const double Gy = G(qy, dy);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  for (int c = 0; c < DIM; ++c)
+                  {
+                     gradXY[qy][qx][c][0] += gradX[qx][c][0] * By;
+                     gradXY[qy][qx][c][1] += gradX[qx][c][1] * Gy;
+                     gradXY[qy][qx][c][2] += gradX[qx][c][1] * By;
+                  }
+               }
+            }
+         }
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            const double Bz = B(qz, dz);
+            const double Gz = G(qz, dz);
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  for (int c = 0; c < DIM; ++c)
+                  {
+                     grad[qz][qy][qx][c][0] += gradXY[qy][qx][c][0] * Bz;
+                     grad[qz][qy][qx][c][1] += gradXY[qy][qx][c][1] * Bz;
+                     grad[qz][qy][qx][c][2] += gradXY[qy][qx][c][2] * Gz;
+                  }
+               }
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               double Jrt[DIM*DIM], H[DIM*DIM], Fq[DIM*DIM], c[3];
+               for (int j = 0; j < DIM; ++j)
+               {
+                  for (int i = 0; i < DIM; ++i)
+                  {
+                     Jrt[i+j*DIM] = Jinv(qx, qy, qz, i, j, e);
+                     H[i+j*DIM] = grad[qz][qy][qx][i][j];
+                     if (mode == HYPER_PA_GRAD_MULT)
+                     {
+                        Fq[i+j*DIM] = F(qx, qy, qz, i, j, e);
+                     }
+                  }
+               }
+               if (neo_hookean)
+               {
+                  for (int k = 0; k < 3; ++k) { c[k] = C(qx, qy, qz, k, e); }
+               }
+               if (!HyperelasticQFunction<DIM>(mode, neo_hookean, c, Jrt,
+                                               W(qx, qy, qz, e), Fq, H))
+               {
+                  for (int j = 0; j < DIM; ++j)
+                  {
+                     for (int i = 0; i < DIM; ++i)
+                     {
+                        F(qx, qy, qz, i, j, e) = Fq[i+j*DIM];
+                     }
+                  }
+                  continue;
+               }
+               for (int j = 0; j < DIM; ++j)
+               {
+                  for (int i = 0; i < DIM; ++i)
+                  {
+                     grad[qz][qy][qx][i][j] = H[i+j*DIM];
+                  }
+               }
+            }
+         }
+      }
+      if (init) { return; }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         double gradXY[max_D1D][max_D1D][DIM][DIM];
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               for (int i = 0; i < DIM*DIM; ++i)
+               {
+                  gradXY[dy][dx][i%DIM][i/DIM] = 0.0;
+               }
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            double gradX[max_D1D][DIM][DIM];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               for (int i = 0; i < DIM*DIM; ++i)
+               {
+                  gradX[dx][i%DIM][i/DIM] = 0.0;
+               }
+            }
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const double Bx = B(qx, dx);
+                  const double Gx = G(qx, dx);
+                  for (int c = 0; c < DIM; ++c)
+                  {
+                     gradX[dx][c][0] += Gx * grad[qz][qy][qx][c][0];
+                     gradX[dx][c][1] += Bx * grad[qz][qy][qx][c][1];
+                     gradX[dx][c][2] += Bx * grad[qz][qy][qx][c][2];
+                  }
+               }
+            }
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               const double By = B(qy, dy);
+               const double Gy = G(qy, dy);
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  for (int c = 0; c < DIM; ++c)
+                  {
+                     gradXY[dy][dx][c][0] += gradX[dx][c][0] * By;
+                     gradXY[dy][dx][c][1] += gradX[dx][c][1] * Gy;
+                     gradXY[dy][dx][c][2] += gradX[dx][c][2] * By;
+                  }
+               }
+            }
+         }
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            const double Bz = B(qz, dz);
+            const double Gz = G(qz, dz);
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  for (int c = 0; c < DIM; ++c)
+                  {
+                     y(dx, dy, dz, c, e) +=
+                        (gradXY[dy][dx][c][0] + gradXY[dy][dx][c][1]) * Bz +
+                        gradXY[dy][dx][c][2] * Gz;
+                  }
+               }
+            }
+         }
+      }
+   });
+}
+
+void HyperelasticNLFIntegrator::AssemblePA(const FiniteElementSpace &fes)
+{
+   MFEM_VERIFY(fes.GetOrdering() == Ordering::byNODES,
+               "PA Only supports Ordering::byNODES!");
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   MFEM_VERIFY(dynamic_cast<const TensorBasisElement*>(&el) != NULL,
+               "PA is only supported on tensor-product elements!");
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "dim = " << dim << " is not supported!");
+   MFEM_VERIFY(fes.GetVDim() == dim, "invalid vector dimension!");
+   if (dynamic_cast<NeoHookeanModel*>(model))
+   {
+      pa_model = PA_NEO_HOOKEAN;
+   }
+   else if (dynamic_cast<InverseHarmonicModel*>(model))
+   {
+      pa_model = PA_INVERSE_HARMONIC;
+   }
+   else
+   {
+      MFEM_ABORT("PA is not supported for this HyperelasticModel!");
+   }
+   const IntegrationRule *ir = IntRule;
+   if (!ir)
+   {
+      ir = &(IntRules.Get(el.GetGeomType(), 2*el.GetOrder() + 3));
+   }
+   ne = fes.GetNE();
+   nq = ir->GetNPoints();
+   geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS |
+                                    GeometricFactors::DETERMINANTS);
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   if (pa_model == PA_NEO_HOOKEAN)
+   {
+      static_cast<NeoHookeanModel*>(model)->EvalCoeffsPA(*mesh, *ir, pa_coeff);
+   }
+   pa_jinv.SetSize(ne * nq * dim * dim, Device::GetMemoryType());
+   pa_wdet.SetSize(ne * nq, Device::GetMemoryType());
+   const int NE = ne;
+   const int NQ = nq;
+   auto W = ir->GetWeights().Read();
+   auto detJ = Reshape(geom->detJ.Read(), NQ, NE);
+   auto wdet = Reshape(pa_wdet.Write(), NQ, NE);
+   if (dim == 2)
+   {
+      constexpr int DIM = 2;
+      auto J = Reshape(geom->J.Read(), NQ, DIM, DIM, NE);
+      auto Jinv = Reshape(pa_jinv.Write(), NQ, DIM, DIM, NE);
+      MFEM_FORALL(e, NE,
+      {
+         for (int q = 0; q < NQ; ++q)
+         {
+            double Jtr[DIM*DIM], Jrt[DIM*DIM];
+            for (int j = 0; j < DIM; j++)
+            {
+               for (int i = 0; i < DIM; i++) { Jtr[i+j*DIM] = J(q, i, j, e); }
+            }
+            kernels::CalcInverse<DIM>(Jtr, Jrt);
+            for (int j = 0; j < DIM; j++)
+            {
+               for (int i = 0; i < DIM; i++)
+               {
+                  Jinv(q, i, j, e) = Jrt[i+j*DIM];
+               }
+            }
+            wdet(q, e) = W[q] * detJ(q, e);
+         }
+      });
+   }
+   if (dim == 3)
+   {
+      constexpr int DIM = 3;
+      auto J = Reshape(geom->J.Read(), NQ, DIM, DIM, NE);
+      auto Jinv = Reshape(pa_jinv.Write(), NQ, DIM, DIM, NE);
+      MFEM_FORALL(e, NE,
+      {
+         for (int q = 0; q < NQ; ++q)
+         {
+            double Jtr[DIM*DIM], Jrt[DIM*DIM];
+            for (int j = 0; j < DIM; j++)
+            {
+               for (int i = 0; i < DIM; i++) { Jtr[i+j*DIM] = J(q, i, j, e); }
+            }
+            kernels::CalcInverse<DIM>(Jtr, Jrt);
+            for (int j = 0; j < DIM; j++)
+            {
+               for (int i = 0; i < DIM; i++)
+               {
+                  Jinv(q, i, j, e) = Jrt[i+j*DIM];
+               }
+            }
+            wdet(q, e) = W[q] * detJ(q, e);
+         }
+      });
+   }
+}
+
+void HyperelasticNLFIntegrator::ApplyPA(const int mode, const Vector &x,
+                                        Vector &y) const
+{
+   const int NE = ne;
+   const int D1D = maps->ndof;
+   const int Q1D = maps->nqpt;
+   const bool nh = (pa_model == PA_NEO_HOOKEAN);
+   const Array<double> &B = maps->B;
+   const Array<double> &G = maps->G;
+   Vector &F = const_cast<Vector&>(pa_grad);
+   if (dim == 2)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x24: return PAHyperelasticApply2D<2,4>(mode, nh, NE, B, G,
+                                                         pa_jinv, pa_wdet,
+                                                         pa_coeff, x, F, y);
+         case 0x36: return PAHyperelasticApply2D<3,6>(mode, nh, NE, B, G,
+                                                         pa_jinv, pa_wdet,
+                                                         pa_coeff, x, F, y);
+         case 0x47: return PAHyperelasticApply2D<4,7>(mode, nh, NE, B, G,
+                                                         pa_jinv, pa_wdet,
+                                                         pa_coeff, x, F, y);
+         default: return PAHyperelasticApply2D(mode, nh, NE, B, G, pa_jinv,
+                                                  pa_wdet, pa_coeff, x, F, y,
+                                                  D1D, Q1D);
+      }
+   }
+   if (dim == 3)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x24: return PAHyperelasticApply3D<2,4>(mode, nh, NE, B, G,
+                                                         pa_jinv, pa_wdet,
+                                                         pa_coeff, x, F, y);
+         case 0x36: return PAHyperelasticApply3D<3,6>(mode, nh, NE, B, G,
+                                                         pa_jinv, pa_wdet,
+                                                         pa_coeff, x, F, y);
+         case 0x47: return PAHyperelasticApply3D<4,7>(mode, nh, NE, B, G,
+                                                         pa_jinv, pa_wdet,
+                                                         pa_coeff, x, F, y);
+         default: return PAHyperelasticApply3D(mode, nh, NE, B, G, pa_jinv,
+                                                  pa_wdet, pa_coeff, x, F, y,
+                                                  D1D, Q1D);
+      }
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+void HyperelasticNLFIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   ApplyPA(HYPER_PA_MULT, x, y);
+}
+
+void HyperelasticNLFIntegrator::AssembleGradPA(const Vector &x,
+                                               const FiniteElementSpace &fes)
+{
+   MFEM_VERIFY(maps != NULL && fes.GetNE() == ne,
+               "AssemblePA() must be called before AssembleGradPA()!");
+   pa_grad.SetSize(ne * nq * dim * dim, Device::GetMemoryType());
+   Vector empty;
+   ApplyPA(HYPER_PA_GRAD_INIT, x, empty);
+}
+
+void HyperelasticNLFIntegrator::AddMultGradPA(const Vector &x, Vector &y) const
+{
+   ApplyPA(HYPER_PA_GRAD_MULT, x, y);
+}
+
+} // namespace mfem
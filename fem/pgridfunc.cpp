@@ -80,13 +80,13 @@ ParGridFunction::ParGridFunction(ParMesh *pmesh, std::istream &input)
 
 void ParGridFunction::Update()
 {
-   face_nbr_data.Destroy();
+   DestroyFaceNbrData();
    GridFunction::Update();
 }
 
 void ParGridFunction::SetSpace(FiniteElementSpace *f)
 {
-   face_nbr_data.Destroy();
+   DestroyFaceNbrData();
    GridFunction::SetSpace(f);
    pfes = dynamic_cast<ParFiniteElementSpace*>(f);
    MFEM_ASSERT(pfes != NULL, "not a ParFiniteElementSpace");
@@ -94,14 +94,14 @@ void ParGridFunction::SetSpace(FiniteElementSpace *f)
 
 void ParGridFunction::SetSpace(ParFiniteElementSpace *f)
 {
-   face_nbr_data.Destroy();
+   DestroyFaceNbrData();
    GridFunction::SetSpace(f);
    pfes = f;
 }
 
 void ParGridFunction::MakeRef(FiniteElementSpace *f, double *v)
 {
-   face_nbr_data.Destroy();
+   DestroyFaceNbrData();
    GridFunction::MakeRef(f, v);
    pfes = dynamic_cast<ParFiniteElementSpace*>(f);
    MFEM_ASSERT(pfes != NULL, "not a ParFiniteElementSpace");
@@ -109,14 +109,14 @@ void ParGridFunction::MakeRef(FiniteElementSpace *f, double *v)
 
 void ParGridFunction::MakeRef(ParFiniteElementSpace *f, double *v)
 {
-   face_nbr_data.Destroy();
+   DestroyFaceNbrData();
    GridFunction::MakeRef(f, v);
    pfes = f;
 }
 
 void ParGridFunction::MakeRef(FiniteElementSpace *f, Vector &v, int v_offset)
 {
-   face_nbr_data.Destroy();
+   DestroyFaceNbrData();
    GridFunction::MakeRef(f, v, v_offset);
    pfes = dynamic_cast<ParFiniteElementSpace*>(f);
    MFEM_ASSERT(pfes != NULL, "not a ParFiniteElementSpace");
@@ -124,7 +124,7 @@ void ParGridFunction::MakeRef(FiniteElementSpace *f, Vector &v, int v_offset)
 
 void ParGridFunction::MakeRef(ParFiniteElementSpace *f, Vector &v, int v_offset)
 {
-   face_nbr_data.Destroy();
+   DestroyFaceNbrData();
    GridFunction::MakeRef(f, v, v_offset);
    pfes = f;
 }
@@ -202,7 +202,21 @@ HypreParVector *ParGridFunction::ParallelAssemble() const
    return tv;
 }
 
+void ParGridFunction::DestroyFaceNbrData()
+{
+   face_nbr_exchange.Wait();
+   face_nbr_exchange.Clear();
+   face_nbr_send_data.Destroy();
+   face_nbr_data.Destroy();
+}
+
 void ParGridFunction::ExchangeFaceNbrData()
+{
+   ExchangeFaceNbrDataBegin();
+   ExchangeFaceNbrDataEnd();
+}
+
+void ParGridFunction::ExchangeFaceNbrDataBegin()
 {
    pfes->ExchangeFaceNbrData();
 
@@ -213,21 +227,13 @@ void ParGridFunction::ExchangeFaceNbrData()
 
    ParMesh *pmesh = pfes->GetParMesh();
 
+   face_nbr_exchange.Wait();
    face_nbr_data.SetSize(pfes->GetFaceNbrVSize());
-   Vector send_data(pfes->send_face_nbr_ldof.Size_of_connections());
+   face_nbr_send_data.SetSize(pfes->send_face_nbr_ldof.Size_of_connections());
+   Vector &send_data = face_nbr_send_data;
 
-   int *send_offset = pfes->send_face_nbr_ldof.GetI();
    const int *d_send_ldof = mfem::Read(pfes->send_face_nbr_ldof.GetJMemory(),
                                        send_data.Size());
-   int *recv_offset = pfes->face_nbr_ldof.GetI();
-   MPI_Comm MyComm = pfes->GetComm();
-
-   int num_face_nbrs = pmesh->GetNFaceNeighbors();
-   MPI_Request *requests = new MPI_Request[2*num_face_nbrs];
-   MPI_Request *send_requests = requests;
-   MPI_Request *recv_requests = requests + num_face_nbrs;
-   MPI_Status  *statuses = new MPI_Status[num_face_nbrs];
-
    auto d_data = this->Read();
    auto d_send_data = send_data.Write();
    MFEM_FORALL(i, send_data.Size(),
@@ -240,25 +246,30 @@ void ParGridFunction::ExchangeFaceNbrData()
    auto send_data_ptr = mpi_gpu_aware ? send_data.Read() : send_data.HostRead();
    auto face_nbr_data_ptr = mpi_gpu_aware ? face_nbr_data.Write() :
                             face_nbr_data.HostWrite();
+
+   const int num_face_nbrs = pmesh->GetNFaceNeighbors();
+   Array<int> nbr_ranks(num_face_nbrs);
    for (int fn = 0; fn < num_face_nbrs; fn++)
    {
-      int nbr_rank = pmesh->GetFaceNbrRank(fn);
-      int tag = 0;
-
-      MPI_Isend(&send_data_ptr[send_offset[fn]],
-                send_offset[fn+1] - send_offset[fn],
-                MPI_DOUBLE, nbr_rank, tag, MyComm, &send_requests[fn]);
-
-      MPI_Irecv(&face_nbr_data_ptr[recv_offset[fn]],
-                recv_offset[fn+1] - recv_offset[fn],
-                MPI_DOUBLE, nbr_rank, tag, MyComm, &recv_requests[fn]);
+      nbr_ranks[fn] = pmesh->GetFaceNbrRank(fn);
    }
+   if (!face_nbr_exchange.IsCreatedFor(num_face_nbrs, nbr_ranks.GetData(),
+                                       pfes->send_face_nbr_ldof.GetI(),
+                                       send_data_ptr,
+                                       pfes->face_nbr_ldof.GetI(),
+                                       face_nbr_data_ptr))
+   {
+      face_nbr_exchange.Create(pfes->GetComm(), num_face_nbrs,
+                               nbr_ranks.GetData(),
+                               pfes->send_face_nbr_ldof.GetI(), send_data_ptr,
+                               pfes->face_nbr_ldof.GetI(), face_nbr_data_ptr);
+   }
+   face_nbr_exchange.Start();
+}
 
-   MPI_Waitall(num_face_nbrs, send_requests, statuses);
-   MPI_Waitall(num_face_nbrs, recv_requests, statuses);
-
-   delete [] statuses;
-   delete [] requests;
+void ParGridFunction::ExchangeFaceNbrDataEnd()
+{
+   face_nbr_exchange.Wait();
 }
 
 double ParGridFunction::GetValue(int i, const IntegrationPoint &ip, int vdim)
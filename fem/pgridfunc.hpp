@@ -38,6 +38,13 @@ protected:
        initialized by ExchangeFaceNbrData(). */
    Vector face_nbr_data;
 
+   /// Send buffer and persistent MPI requests of ExchangeFaceNbrDataBegin().
+   Vector face_nbr_send_data;
+   PersistentNbrExchange face_nbr_exchange;
+
+   /// Destroy the face-neighbor data together with the persistent requests.
+   void DestroyFaceNbrData();
+
    void ProjectBdrCoefficient(Coefficient *coeff[], VectorCoefficient *vcoeff,
                               Array<int> &attr);
 
@@ -194,7 +201,27 @@ public:
    /// Returns a new vector assembled on the true dofs.
    HypreParVector *ParallelAssemble() const;
 
+   /** @brief Exchange the data of the face-neighbor elements with the
+       neighbor processors, see FaceNbrData(). Equivalent to calling
+       ExchangeFaceNbrDataBegin() followed by ExchangeFaceNbrDataEnd(). */
    void ExchangeFaceNbrData();
+
+   /** @brief Start the exchange of the face-neighbor data, without waiting for
+       its completion. */
+   /** The local data to send is copied to an internal buffer, so this object
+       may be modified before ExchangeFaceNbrDataEnd() is called, e.g. while
+       computing the contributions of the interior elements. The data returned
+       by FaceNbrData() must not be used until ExchangeFaceNbrDataEnd()
+       returns.
+
+       The MPI requests are persistent: they are created by the first call and
+       reused by all subsequent exchanges, until the space of the
+       ParGridFunction is changed or updated. */
+   void ExchangeFaceNbrDataBegin();
+
+   /// Complete the exchange started by ExchangeFaceNbrDataBegin().
+   void ExchangeFaceNbrDataEnd();
+
    Vector &FaceNbrData() { return face_nbr_data; }
    const Vector &FaceNbrData() const { return face_nbr_data; }
 
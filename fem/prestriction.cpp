@@ -40,7 +40,9 @@ ParL2FaceRestriction::ParL2FaceRestriction(const ParFiniteElementSpace &fes,
      scatter_indices1(nf*dof),
      scatter_indices2(m==L2FaceValues::DoubleValued?nf*dof:0),
      offsets(ndofs+1),
-     gather_indices((m==L2FaceValues::DoubleValued? 2 : 1)*nf*dof)
+     gather_indices((m==L2FaceValues::DoubleValued? 2 : 1)*nf*dof),
+     x_gf(const_cast<ParFiniteElementSpace*>(&fes), (double*)NULL),
+     exchange_x(NULL)
 {
    if (nf==0) { return; }
    // If fespace == L2
@@ -270,12 +272,21 @@ ParL2FaceRestriction::ParL2FaceRestriction(const ParFiniteElementSpace &fes,
    offsets[0] = 0;
 }
 
+void ParL2FaceRestriction::ExchangeBegin(const Vector &x) const
+{
+   x_gf.ExchangeFaceNbrDataEnd();
+   // Use Vector::MakeRef() which, unlike ParGridFunction::MakeRef(), keeps the
+   // face-neighbor buffers and the persistent MPI requests of x_gf.
+   x_gf.Vector::MakeRef(const_cast<Vector&>(x), 0, x.Size());
+   x_gf.ExchangeFaceNbrDataBegin();
+   exchange_x = &x;
+}
+
 void ParL2FaceRestriction::Mult(const Vector& x, Vector& y) const
 {
-   ParGridFunction x_gf;
-   x_gf.MakeRef(const_cast<ParFiniteElementSpace*>(&fes),
-                const_cast<Vector&>(x), 0);
-   x_gf.ExchangeFaceNbrData();
+   if (exchange_x != &x) { ExchangeBegin(x); }
+   x_gf.ExchangeFaceNbrDataEnd();
+   exchange_x = NULL;
 
    // Assumes all elements have the same number of dofs
    const int nd = dof;
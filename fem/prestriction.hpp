@@ -17,6 +17,7 @@
 #ifdef MFEM_USE_MPI
 
 #include "restriction.hpp"
+#include "pgridfunc.hpp"
 
 namespace mfem
 {
@@ -42,10 +43,23 @@ protected:
    Array<int> offsets;
    Array<int> gather_indices;
 
+   /// Reference to the input of Mult(), used for the face-neighbor exchange.
+   mutable ParGridFunction x_gf;
+   /// Input vector of the exchange started by ExchangeBegin(), if any.
+   mutable const Vector *exchange_x;
+
 public:
    ParL2FaceRestriction(const ParFiniteElementSpace&, ElementDofOrdering,
                         FaceType type,
                         L2FaceValues m = L2FaceValues::DoubleValued);
+
+   /** @brief Start the exchange of the face-neighbor values of @a x, which is
+       completed by the next call to Mult() with the same vector @a x. */
+   /** Work that does not need the face values, e.g. the element kernels, can
+       be performed between the two calls to overlap it with the
+       communication. */
+   void ExchangeBegin(const Vector &x) const;
+
    void Mult(const Vector &x, Vector &y) const;
    void MultTranspose(const Vector &x, Vector &y) const;
 };
@@ -13,6 +13,7 @@
 #include "gridfunc.hpp"
 #include "fespace.hpp"
 #include "../general/forall.hpp"
+#include "../general/profiler.hpp"
 
 namespace mfem
 {
@@ -148,6 +149,7 @@ ElementRestriction::ElementRestriction(const FiniteElementSpace &f,
 
 void ElementRestriction::Mult(const Vector& x, Vector& y) const
 {
+   MFEM_PERF_SCOPE("ElementRestriction::Mult");
    // Assumes all elements have the same number of dofs
    const int nd = dof;
    const int vd = vdim;
@@ -191,6 +193,7 @@ void ElementRestriction::MultUnsigned(const Vector& x, Vector& y) const
 
 void ElementRestriction::MultTranspose(const Vector& x, Vector& y) const
 {
+   MFEM_PERF_SCOPE("ElementRestriction::MultTranspose");
    // Assumes all elements have the same number of dofs
    const int nd = dof;
    const int vd = vdim;
@@ -14,6 +14,7 @@
 
 #include "../linalg/operator.hpp"
 #include "../mesh/mesh.hpp"
+#include "../general/forall.hpp"
 
 namespace mfem
 {
@@ -59,8 +60,37 @@ public:
        emulate SetSubVector and its transpose on GPUs. This method is running on
        the host, since the `processed` array requires a large shared memory. */
    void BooleanMask(Vector& y) const;
+
+   /// @brief Return the signed map from (scalar) E-vector entries to L-vector
+   /// dofs.
+   /** E-vector entry i is gathered from the dof j = map[i] if map[i] >= 0, and
+       from the dof j = -1-map[i], with a change of sign, otherwise. This map
+       allows kernels to read and write L-vectors directly, see
+       internal::GatherL() and internal::ScatterAddL(). */
+   const Array<int> &GatherMap() const { return gatherMap; }
 };
 
+namespace internal
+{
+
+/// Read the L-vector entry of @a x referenced by the signed gather index @a gid.
+/** See ElementRestriction::GatherMap(). */
+MFEM_HOST_DEVICE inline double GatherL(const double *x, const int gid)
+{
+   return gid >= 0 ? x[gid] : -x[-1-gid];
+}
+
+/// Atomically add @a val to the L-vector entry of @a y referenced by @a gid.
+/** See ElementRestriction::GatherMap(). */
+MFEM_HOST_DEVICE inline void ScatterAddL(double *y, const int gid,
+                                         const double val)
+{
+   if (gid >= 0) { AtomicAdd(y[gid], val); }
+   else { AtomicAdd(y[-1-gid], -val); }
+}
+
+} // namespace internal
+
 /// Operator that converts L2 FiniteElementSpace L-vectors to E-vectors.
 /** Objects of this type are typically created and owned by FiniteElementSpace
     objects, see FiniteElementSpace::GetElementRestriction(). L-vectors
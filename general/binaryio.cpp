@@ -12,6 +12,16 @@
 #include "binaryio.hpp"
 #include "error.hpp"
 
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 namespace mfem
 {
 namespace bin_io
@@ -52,4 +62,51 @@ void WriteBase64(std::ostream &out, const void *bytes, size_t nbytes)
 }
 
 } // namespace mfem::bin_io
+
+mapped_ifstream::mapped_ifstream(const std::string &filename_)
+   : std::istream(NULL), map_data(NULL), map_size(0), mapped(false),
+     filename(filename_)
+{
+   init(&buf);
+#ifndef _WIN32
+   const int fd = open(filename.c_str(), O_RDONLY);
+   if (fd < 0) { setstate(std::ios::failbit); return; }
+   struct stat st;
+   if (fstat(fd, &st) == 0 && st.st_size > 0)
+   {
+      void *ptr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (ptr != MAP_FAILED)
+      {
+         // The mapping is read sequentially by the mesh and grid function
+         // readers.
+         madvise(ptr, st.st_size, MADV_SEQUENTIAL);
+         map_data = static_cast<char*>(ptr);
+         map_size = st.st_size;
+         mapped = true;
+      }
+   }
+   close(fd);
+   if (mapped)
+   {
+      buf.set(map_data, map_size);
+      return;
+   }
+#endif
+   // Fallback: read the whole file into memory.
+   std::ifstream file(filename.c_str(), std::ios::binary);
+   if (!file) { setstate(std::ios::failbit); return; }
+   copy.assign(std::istreambuf_iterator<char>(file),
+               std::istreambuf_iterator<char>());
+   map_data = copy.empty() ? NULL : &copy[0];
+   map_size = copy.size();
+   buf.set(map_data, map_size);
+}
+
+mapped_ifstream::~mapped_ifstream()
+{
+#ifndef _WIN32
+   if (mapped) { munmap(map_data, map_size); }
+#endif
+}
+
 } // namespace mfem
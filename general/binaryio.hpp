@@ -16,6 +16,7 @@
 
 #include <iostream>
 #include <vector>
+#include <string>
 
 namespace mfem
 {
@@ -50,6 +51,45 @@ void WriteBase64(std::ostream &out, const void *bytes, size_t length);
 
 } // namespace mfem::bin_io
 
+/** @brief Input stream reading from a read-only memory mapping of a file.
+
+    On POSIX systems the file is mapped with mmap(), so that reading from the
+    stream, e.g. with std::istream::read(), copies directly from the page cache
+    without intermediate buffering. On other platforms the whole file is read
+    into memory when the stream is opened. If the file can not be opened, the
+    failbit of the stream is set. */
+class mapped_ifstream : public std::istream
+{
+protected:
+   class membuf : public std::streambuf
+   {
+   public:
+      void set(char *begin, size_t size) { setg(begin, begin, begin + size); }
+   };
+
+   membuf buf;
+   char *map_data;
+   size_t map_size;
+   bool mapped;
+   std::vector<char> copy;
+
+public:
+   explicit mapped_ifstream(const std::string &filename);
+
+   ~mapped_ifstream();
+
+   /// Pointer to the contents of the file.
+   const char *data() const { return map_data; }
+
+   /// Size of the file in bytes.
+   size_t size() const { return map_size; }
+
+   /// Return true if the file is memory-mapped (as opposed to copied).
+   bool is_mapped() const { return mapped; }
+
+   const std::string filename;
+};
+
 } // namespace mfem
 
 #endif
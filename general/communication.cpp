@@ -25,6 +25,7 @@
 #include "text.hpp"
 #include "sort_pairs.hpp"
 #include "globals.hpp"
+#include "profiler.hpp"
 
 #include <iostream>
 #include <map>
@@ -696,6 +697,7 @@ const T *GroupCommunicator::ReduceGroupFromBuffer(const T *buf, T *ldata,
 template <class T>
 void GroupCommunicator::BcastBegin(T *ldata, int layout) const
 {
+   MFEM_PERF_SCOPE("GroupCommunicator::BcastBegin");
    MFEM_VERIFY(comm_lock == 0, "object is already in use");
 
    if (group_buf_size == 0) { return; }
@@ -833,6 +835,7 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
 template <class T>
 void GroupCommunicator::BcastEnd(T *ldata, int layout) const
 {
+   MFEM_PERF_SCOPE("GroupCommunicator::BcastEnd");
    if (comm_lock == 0) { return; }
    // The above also handles the case (group_buf_size == 0).
    MFEM_VERIFY(comm_lock == 1, "object is NOT locked for Bcast");
@@ -895,6 +898,7 @@ void GroupCommunicator::BcastEnd(T *ldata, int layout) const
 template <class T>
 void GroupCommunicator::ReduceBegin(const T *ldata) const
 {
+   MFEM_PERF_SCOPE("GroupCommunicator::ReduceBegin");
    MFEM_VERIFY(comm_lock == 0, "object is already in use");
 
    if (group_buf_size == 0) { return; }
@@ -1015,6 +1019,7 @@ template <class T>
 void GroupCommunicator::ReduceEnd(T *ldata, int layout,
                                   void (*Op)(OpData<T>)) const
 {
+   MFEM_PERF_SCOPE("GroupCommunicator::ReduceEnd");
    if (comm_lock == 0) { return; }
    // The above also handles the case (group_buf_size == 0).
    MFEM_VERIFY(comm_lock == 2, "object is NOT locked for Reduce");
@@ -1283,6 +1288,105 @@ GroupCommunicator::~GroupCommunicator()
    delete [] requests;
 }
 
+void PersistentNbrExchange::Create(MPI_Comm comm, int nbrs,
+                                   const int *nbr_ranks,
+                                   const int *send_offsets, const double *send,
+                                   const int *recv_offsets, double *recv,
+                                   int tag)
+{
+   Clear();
+   num_nbrs = nbrs;
+   requests = new MPI_Request[2*nbrs];
+   send_buf = send;
+   recv_buf = recv;
+   ranks.SetSize(nbrs);
+   ranks.Assign(nbr_ranks);
+   send_offs.SetSize(nbrs + 1);
+   send_offs.Assign(send_offsets);
+   recv_offs.SetSize(nbrs + 1);
+   recv_offs.Assign(recv_offsets);
+   for (int i = 0; i < nbrs; i++)
+   {
+      MPI_Send_init(const_cast<double*>(send + send_offsets[i]),
+                    send_offsets[i+1] - send_offsets[i], MPI_DOUBLE,
+                    nbr_ranks[i], tag, comm, &requests[i]);
+      MPI_Recv_init(recv + recv_offsets[i],
+                    recv_offsets[i+1] - recv_offsets[i], MPI_DOUBLE,
+                    nbr_ranks[i], tag, comm, &requests[nbrs+i]);
+   }
+}
+
+bool PersistentNbrExchange::IsCreatedFor(int nbrs, const int *nbr_ranks,
+                                         const int *send_offsets,
+                                         const double *send,
+                                         const int *recv_offsets,
+                                         const double *recv) const
+{
+   if (!requests || nbrs != num_nbrs || send != send_buf || recv != recv_buf)
+   {
+      return false;
+   }
+   for (int i = 0; i < nbrs; i++)
+   {
+      if (nbr_ranks[i] != ranks[i]) { return false; }
+   }
+   for (int i = 0; i <= nbrs; i++)
+   {
+      if (send_offsets[i] != send_offs[i] || recv_offsets[i] != recv_offs[i])
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+void PersistentNbrExchange::Start()
+{
+   MFEM_VERIFY(requests, "the requests are not created");
+   MFEM_VERIFY(!active, "the exchange is already in progress");
+   MPI_Startall(2*num_nbrs, requests);
+   active = true;
+}
+
+void PersistentNbrExchange::Wait()
+{
+   if (!active) { return; }
+   MPI_Waitall(2*num_nbrs, requests, MPI_STATUSES_IGNORE);
+   active = false;
+}
+
+void PersistentNbrExchange::Clear()
+{
+   if (requests == NULL) { return; }
+   MFEM_VERIFY(!active, "cannot free the requests of an active exchange");
+   for (int i = 0; i < 2*num_nbrs; i++)
+   {
+      MPI_Request_free(&requests[i]);
+   }
+   delete [] requests;
+   requests = NULL;
+   num_nbrs = 0;
+   send_buf = NULL;
+   recv_buf = NULL;
+   ranks.DeleteAll();
+   send_offs.DeleteAll();
+   recv_offs.DeleteAll();
+}
+
+PersistentNbrExchange::~PersistentNbrExchange()
+{
+   // Objects in the scope of main() may be destroyed after MPI_Finalize()
+   int mpi_finalized;
+   MPI_Finalized(&mpi_finalized);
+   if (mpi_finalized)
+   {
+      delete [] requests;
+      return;
+   }
+   Wait();
+   Clear();
+}
+
 // @cond DOXYGEN_SKIP
 
 // instantiate GroupCommunicator::Bcast and Reduce for int and double
@@ -315,6 +315,75 @@ public:
 };
 
 
+/** @brief Persistent exchange of double data with a fixed set of neighbor
+    ranks, using MPI_Send_init() and MPI_Recv_init().
+
+    The MPI requests are created once by Create() for given send and receive
+    buffers, and are then reused by every exchange, Start() followed by Wait(),
+    which avoids the setup cost of MPI_Isend() and MPI_Irecv() in repeated
+    exchanges of the same pattern, e.g. in every stage of a time stepper. The
+    buffers must not be reallocated while the requests are in use; call Clear()
+    and Create() again when they change. */
+class PersistentNbrExchange
+{
+protected:
+   int num_nbrs;
+   MPI_Request *requests; // num_nbrs send requests, then num_nbrs receives
+   const double *send_buf;
+   double *recv_buf;
+   /// The arguments of Create(), used by IsCreatedFor()
+   Array<int> ranks, send_offs, recv_offs;
+   bool active;
+
+public:
+   PersistentNbrExchange()
+      : num_nbrs(0), requests(NULL), send_buf(NULL), recv_buf(NULL),
+        active(false) { }
+
+   /// Copies do not share the MPI requests: the new object is empty.
+   PersistentNbrExchange(const PersistentNbrExchange &)
+      : PersistentNbrExchange() { }
+
+   PersistentNbrExchange &operator=(const PersistentNbrExchange &) = delete;
+
+   /** @brief Create the persistent requests for sending to and receiving from
+       each of the @a nbrs ranks in @a nbr_ranks.
+
+       The data for neighbor i is in the range [send_offsets[i],
+       send_offsets[i+1]) of @a send and [recv_offsets[i], recv_offsets[i+1])
+       of @a recv. */
+   void Create(MPI_Comm comm, int nbrs, const int *nbr_ranks,
+               const int *send_offsets, const double *send,
+               const int *recv_offsets, double *recv, int tag = 0);
+
+   /** @brief Return true if the requests were created with the same
+       arguments, see Create().
+
+       Both the buffers and the ranks and offsets are compared, so that a
+       buffer reallocated at the same address with a different size does not
+       reuse the old requests. */
+   bool IsCreatedFor(int nbrs, const int *nbr_ranks,
+                     const int *send_offsets, const double *send,
+                     const int *recv_offsets, const double *recv) const;
+
+   /// Start all send and receive requests.
+   void Start();
+
+   /// Wait for the completion of the requests started with Start().
+   void Wait();
+
+   /// Return true between a call to Start() and the matching Wait().
+   bool IsActive() const { return active; }
+
+   /// Free the MPI requests. No exchange may be in progress.
+   void Clear();
+
+   /** @brief Wait for an active exchange and free the MPI requests, unless
+       MPI is already finalized. */
+   ~PersistentNbrExchange();
+};
+
+
 /// \brief Variable-length MPI message containing unspecific binary data.
 template<int Tag>
 struct VarMessage
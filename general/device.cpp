@@ -92,6 +92,12 @@ Device::Device() : mode(Device::SEQUENTIAL),
          host_mem_type = MemoryType::HOST_64;
          device_mem_type = MemoryType::HOST_64;
       }
+      else if (mem_backend == "pool")
+      {
+         mem_host_env = true;
+         host_mem_type = MemoryType::HOST_POOL;
+         device_mem_type = MemoryType::HOST_POOL;
+      }
       else if (mem_backend == "umpire")
       {
          mem_host_env = true;
@@ -233,6 +239,23 @@ void Device::Configure(const std::string &device, const int dev)
    destroy_mm = true;
 }
 
+void Device::SetHostMemoryType(MemoryType h_mt)
+{
+   // The MFEM_MEMORY environment variable takes precedence
+   if (mem_host_env) { return; }
+   MFEM_VERIFY(!IsConfigured(), "the host MemoryType must be set before the"
+               " Device is configured");
+   MFEM_VERIFY(IsHostMemory(h_mt) && h_mt != MemoryType::MANAGED,
+               "invalid host MemoryType: "
+               << MemoryTypeName[static_cast<int>(h_mt)]);
+   mem_host_env = true;
+   Get().host_mem_type = h_mt;
+   // Note: device_mem_type will be set to the dual of h_mt only when an actual
+   // device is configured, see Device::UpdateMemoryTypeAndClass().
+   Get().device_mem_type = h_mt;
+   mm.Configure(h_mt, h_mt);
+}
+
 void Device::Print(std::ostream &out)
 {
    out << "Device configuration: ";
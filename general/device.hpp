@@ -212,6 +212,14 @@ public:
    */
    void Configure(const std::string &device, const int dev = 0);
 
+   /** @brief Set the host MemoryType used by most MFEM classes, e.g.
+       MemoryType::HOST_POOL to reuse the memory of temporary objects. */
+   /** This method must be called before the Device is configured. It has the
+       same effect as the environment variable MFEM_MEMORY (with values 'host',
+       'host32', 'host64', 'pool', 'umpire' or 'debug'), which takes precedence
+       if it is set. */
+   static void SetHostMemoryType(MemoryType h_mt);
+
    /// Print the configuration of the MFEM virtual device object.
    void Print(std::ostream &out = mfem::out);
 
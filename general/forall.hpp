@@ -45,6 +45,27 @@ const int MAX_Q1D = 14;
 #define MFEM_UNROLL(N)
 #endif
 
+/// Atomically add @a val to @a add, returning the previous value of @a add.
+/** Can be used inside MFEM_FORALL kernels where several iterations may write
+    to the same memory location, e.g. when scattering element contributions
+    directly into an L-vector. */
+template <typename T> MFEM_HOST_DEVICE inline
+T AtomicAdd(T &add, const T val)
+{
+#if defined(MFEM_USE_CUDA) && defined(__CUDA_ARCH__)
+   return atomicAdd(&add, val);
+#elif defined(MFEM_USE_HIP) && defined(__HIP_DEVICE_COMPILE__)
+   return atomicAdd(&add, val);
+#else
+   T old;
+#ifdef MFEM_USE_OPENMP
+   #pragma omp atomic capture
+#endif
+   { old = add; add += val; }
+   return old;
+#endif
+}
+
 // Implementation of MFEM's "parallel for" (forall) device/host kernel
 // interfaces supporting RAJA, CUDA, OpenMP, and sequential backends.
 
@@ -25,7 +25,7 @@ namespace mfem
 struct Hashed2
 {
    int p1, p2;
-   int next;
+   int next; // -2 marks an unused item, see HashTable::Delete()
 };
 
 /** A concept for items that should be used in HashTable and be accessible by
@@ -34,7 +34,7 @@ struct Hashed2
 struct Hashed4
 {
    int p1, p2, p3; // NOTE: p4 is neither hashed nor stored
-   int next;
+   int next; // -2 marks an unused item, see HashTable::Delete()
 };
 
 
@@ -65,6 +65,11 @@ struct Hashed4
  *
  *  All items in the container can also be accessed sequentially using the
  *  provided iterator.
+ *
+ *  The hash table itself uses open addressing with linear probing. Each slot
+ *  stores the item id together with its full hash value, so that a lookup
+ *  only touches the (scattered) items whose hash matches, and a rehash does
+ *  not need to touch the items at all.
  */
 template<typename T>
 class HashTable : public BlockArray<T>
@@ -172,29 +177,46 @@ public:
    const_iterator cend() const { return const_iterator(); }
 
 protected:
-   int* table;
+   /// Slot of the hash table, empty if id < 0.
+   struct Slot
+   {
+      int id;
+      unsigned hash;
+   };
+
+   Slot* table;
    int mask;
    Array<int> unused;
 
+   /// Scramble the bits of 'h', so that the low bits used to index the table
+   /// depend on all bits of the parent IDs (needed for linear probing).
+   static inline unsigned Mix(unsigned h)
+   {
+      h ^= h >> 16;
+      h *= 0x85ebca6bu;
+      h ^= h >> 13;
+      return h;
+   }
+
    // hash functions (NOTE: the constants are arbitrary)
-   inline int Hash(int p1, int p2) const
-   { return (984120265*p1 + 125965121*p2) & mask; }
+   inline unsigned Hash(int p1, int p2) const
+   { return Mix(984120265u*p1 + 125965121u*p2); }
 
-   inline int Hash(int p1, int p2, int p3) const
-   { return (984120265*p1 + 125965121*p2 + 495698413*p3) & mask; }
+   inline unsigned Hash(int p1, int p2, int p3) const
+   { return Mix(984120265u*p1 + 125965121u*p2 + 495698413u*p3); }
 
    // Delete() and Reparent() use one of these:
-   inline int Hash(const Hashed2& item) const
+   inline unsigned Hash(const Hashed2& item) const
    { return Hash(item.p1, item.p2); }
 
-   inline int Hash(const Hashed4& item) const
+   inline unsigned Hash(const Hashed4& item) const
    { return Hash(item.p1, item.p2, item.p3); }
 
-   int SearchList(int id, int p1, int p2) const;
-   int SearchList(int id, int p1, int p2, int p3) const;
+   int Search(unsigned hash, int p1, int p2) const;
+   int Search(unsigned hash, int p1, int p2, int p3) const;
 
-   inline void Insert(int idx, int id, T &item);
-   void Unlink(int idx, int id);
+   inline void Insert(unsigned hash, int id);
+   void Unlink(unsigned hash, int id);
 
    /// Check table load factor and resize if necessary
    inline void CheckRehash();
@@ -211,8 +233,8 @@ HashTable<T>::HashTable(int block_size, int init_hash_size)
    mask = init_hash_size-1;
    MFEM_VERIFY(!(init_hash_size & mask), "init_size must be a power of two.");
 
-   table = new int[init_hash_size];
-   for (int i = 0; i < init_hash_size; i++) { table[i] = -1; }
+   table = new Slot[init_hash_size];
+   for (int i = 0; i < init_hash_size; i++) { table[i].id = -1; }
 }
 
 template<typename T>
@@ -220,8 +242,8 @@ HashTable<T>::HashTable(const HashTable& other)
    : Base(other), mask(other.mask)
 {
    int size = mask+1;
-   table = new int[size];
-   memcpy(table, other.table, size*sizeof(int));
+   table = new Slot[size];
+   memcpy(table, other.table, size*sizeof(Slot));
    other.unused.Copy(unused);
 }
 
@@ -280,8 +302,8 @@ int HashTable<T>::GetId(int p1, int p2)
 {
    // search for the item in the hashtable
    if (p1 > p2) { std::swap(p1, p2); }
-   int idx = Hash(p1, p2);
-   int id = SearchList(table[idx], p1, p2);
+   unsigned hash = Hash(p1, p2);
+   int id = Search(hash, p1, p2);
    if (id >= 0) { return id; }
 
    // not found - use an unused item or create a new one
@@ -299,8 +321,10 @@ int HashTable<T>::GetId(int p1, int p2)
    item.p1 = p1;
    item.p2 = p2;
 
+   item.next = -1;
+
    // insert into hashtable
-   Insert(idx, new_id, item);
+   Insert(hash, new_id);
    CheckRehash();
 
    return new_id;
@@ -311,8 +335,8 @@ int HashTable<T>::GetId(int p1, int p2, int p3, int p4)
 {
    // search for the item in the hashtable
    internal::sort4_ext(p1, p2, p3, p4);
-   int idx = Hash(p1, p2, p3);
-   int id = SearchList(table[idx], p1, p2, p3);
+   unsigned hash = Hash(p1, p2, p3);
+   int id = Search(hash, p1, p2, p3);
    if (id >= 0) { return id; }
 
    // not found - use an unused item or create a new one
@@ -331,8 +355,10 @@ int HashTable<T>::GetId(int p1, int p2, int p3, int p4)
    item.p2 = p2;
    item.p3 = p3;
 
+   item.next = -1;
+
    // insert into hashtable
-   Insert(idx, new_id, item);
+   Insert(hash, new_id);
    CheckRehash();
 
    return new_id;
@@ -370,36 +396,39 @@ template<typename T>
 int HashTable<T>::FindId(int p1, int p2) const
 {
    if (p1 > p2) { std::swap(p1, p2); }
-   return SearchList(table[Hash(p1, p2)], p1, p2);
+   return Search(Hash(p1, p2), p1, p2);
 }
 
 template<typename T>
 int HashTable<T>::FindId(int p1, int p2, int p3, int p4) const
 {
    internal::sort4_ext(p1, p2, p3, p4);
-   return SearchList(table[Hash(p1, p2, p3)], p1, p2, p3);
+   return Search(Hash(p1, p2, p3), p1, p2, p3);
 }
 
 template<typename T>
-int HashTable<T>::SearchList(int id, int p1, int p2) const
+int HashTable<T>::Search(unsigned hash, int p1, int p2) const
 {
-   while (id >= 0)
+   for (int i = hash & mask; table[i].id >= 0; i = (i+1) & mask)
    {
-      const T& item = Base::At(id);
-      if (item.p1 == p1 && item.p2 == p2) { return id; }
-      id = item.next;
+      if (table[i].hash != hash) { continue; }
+      const T& item = Base::At(table[i].id);
+      if (item.p1 == p1 && item.p2 == p2) { return table[i].id; }
    }
    return -1;
 }
 
 template<typename T>
-int HashTable<T>::SearchList(int id, int p1, int p2, int p3) const
+int HashTable<T>::Search(unsigned hash, int p1, int p2, int p3) const
 {
-   while (id >= 0)
+   for (int i = hash & mask; table[i].id >= 0; i = (i+1) & mask)
    {
-      const T& item = Base::At(id);
-      if (item.p1 == p1 && item.p2 == p2 && item.p3 == p3) { return id; }
-      id = item.next;
+      if (table[i].hash != hash) { continue; }
+      const T& item = Base::At(table[i].id);
+      if (item.p1 == p1 && item.p2 == p2 && item.p3 == p3)
+      {
+         return table[i].id;
+      }
    }
    return -1;
 }
@@ -407,10 +436,8 @@ int HashTable<T>::SearchList(int id, int p1, int p2, int p3) const
 template<typename T>
 inline void HashTable<T>::CheckRehash()
 {
-   const int fill_factor = 2;
-
-   // is the table overfull?
-   if (Base::Size() > (mask+1) * fill_factor)
+   // keep the table at most half full, so that the probe sequences are short
+   if (2*Size() > mask+1)
    {
       DoRehash();
    }
@@ -419,12 +446,13 @@ inline void HashTable<T>::CheckRehash()
 template<typename T>
 void HashTable<T>::DoRehash()
 {
-   delete [] table;
+   Slot* old_table = table;
+   int old_table_size = mask+1;
 
    // double the table size
-   int new_table_size = 2*(mask+1);
-   table = new int[new_table_size];
-   for (int i = 0; i < new_table_size; i++) { table[i] = -1; }
+   int new_table_size = 2*old_table_size;
+   table = new Slot[new_table_size];
+   for (int i = 0; i < new_table_size; i++) { table[i].id = -1; }
    mask = new_table_size-1;
 
 #if defined(MFEM_DEBUG) && !defined(MFEM_USE_MPI)
@@ -432,37 +460,46 @@ void HashTable<T>::DoRehash()
              << std::endl;
 #endif
 
-   // reinsert all items
-   for (iterator it = begin(); it != end(); ++it)
+   // reinsert all items, using the stored hash values
+   for (int i = 0; i < old_table_size; i++)
    {
-      Insert(Hash(*it), it.index(), *it);
+      if (old_table[i].id >= 0) { Insert(old_table[i].hash, old_table[i].id); }
    }
+   delete [] old_table;
 }
 
 template<typename T>
-inline void HashTable<T>::Insert(int idx, int id, T &item)
+inline void HashTable<T>::Insert(unsigned hash, int id)
 {
-   // add item at the beginning of the linked list
-   item.next = table[idx];
-   table[idx] = id;
+   // put the item into the first free slot starting at its home position
+   int i = hash & mask;
+   while (table[i].id >= 0) { i = (i+1) & mask; }
+   table[i].id = id;
+   table[i].hash = hash;
 }
 
 template<typename T>
-void HashTable<T>::Unlink(int idx, int id)
+void HashTable<T>::Unlink(unsigned hash, int id)
 {
-   // remove item from the linked list
-   int* p_id = table + idx;
-   while (*p_id >= 0)
+   int i = hash & mask;
+   while (table[i].id != id)
+   {
+      MFEM_VERIFY(table[i].id >= 0, "HashTable<>::Unlink: item not found!");
+      i = (i+1) & mask;
+   }
+
+   // remove the slot and shift back the following slots of the cluster that
+   // would otherwise become unreachable from their home positions
+   for (int j = (i+1) & mask; table[j].id >= 0; j = (j+1) & mask)
    {
-      T& item = Base::At(*p_id);
-      if (*p_id == id)
+      int home = table[j].hash & mask;
+      if (((j - home) & mask) >= ((j - i) & mask))
       {
-         *p_id = item.next;
-         return;
+         table[i] = table[j];
+         i = j;
       }
-      p_id = &(item.next);
    }
-   MFEM_ABORT("HashTable<>::Unlink: item not found!");
+   table[i].id = -1;
 }
 
 template<typename T>
@@ -478,7 +515,7 @@ template<typename T>
 void HashTable<T>::DeleteAll()
 {
    Base::DeleteAll();
-   for (int i = 0; i <= mask; i++) { table[i] = -1; }
+   for (int i = 0; i <= mask; i++) { table[i].id = -1; }
    unused.DeleteAll();
 }
 
@@ -493,8 +530,7 @@ void HashTable<T>::Reparent(int id, int new_p1, int new_p2)
    item.p2 = new_p2;
 
    // reinsert under new parent IDs
-   int new_idx = Hash(new_p1, new_p2);
-   Insert(new_idx, id, item);
+   Insert(Hash(new_p1, new_p2), id);
 }
 
 template<typename T>
@@ -510,20 +546,19 @@ void HashTable<T>::Reparent(int id,
    item.p3 = new_p3;
 
    // reinsert under new parent IDs
-   int new_idx = Hash(new_p1, new_p2, new_p3);
-   Insert(new_idx, id, item);
+   Insert(Hash(new_p1, new_p2, new_p3), id);
 }
 
 template<typename T>
 long HashTable<T>::MemoryUsage() const
 {
-   return (mask+1) * sizeof(int) + Base::MemoryUsage() + unused.MemoryUsage();
+   return (mask+1) * sizeof(Slot) + Base::MemoryUsage() + unused.MemoryUsage();
 }
 
 template<typename T>
 void HashTable<T>::PrintMemoryDetail() const
 {
-   mfem::out << Base::MemoryUsage() << " + " << (mask+1) * sizeof(int)
+   mfem::out << Base::MemoryUsage() << " + " << (mask+1) * sizeof(Slot)
              << " + " << unused.MemoryUsage();
 }
 
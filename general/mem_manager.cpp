@@ -16,6 +16,7 @@
 #include <cstring> // std::memcpy, std::memcmp
 #include <unordered_map>
 #include <algorithm> // std::max
+#include <mutex>
 
 // Uncomment to try _WIN32 platform
 //#define _WIN32
@@ -72,6 +73,7 @@ MemoryType MemoryManager::GetDualMemoryType_(MemoryType mt)
       case MemoryType::HOST_64:        return MemoryType::DEVICE;
       case MemoryType::HOST_DEBUG:     return MemoryType::DEVICE_DEBUG;
       case MemoryType::HOST_UMPIRE:    return MemoryType::DEVICE_UMPIRE;
+      case MemoryType::HOST_POOL:      return MemoryType::DEVICE;
       case MemoryType::MANAGED:        return MemoryType::MANAGED;
       case MemoryType::DEVICE:         return MemoryType::HOST;
       case MemoryType::DEVICE_DEBUG:   return MemoryType::HOST_DEBUG;
@@ -92,6 +94,7 @@ static void MFEM_VERIFY_TYPES(const MemoryType h_mt, const MemoryType d_mt)
       (h_mt == MemoryType::MANAGED && d_mt == MemoryType::MANAGED) ||
       (h_mt == MemoryType::HOST_64 && d_mt == MemoryType::DEVICE) ||
       (h_mt == MemoryType::HOST_32 && d_mt == MemoryType::DEVICE) ||
+      (h_mt == MemoryType::HOST_POOL && d_mt == MemoryType::DEVICE) ||
       (h_mt == MemoryType::HOST && d_mt == MemoryType::DEVICE);
    MFEM_VERIFY(sync, "");
 }
@@ -362,6 +365,154 @@ public:
    { MmuAllow(MmuAddrP(ptr), MmuLengthP(ptr, bytes)); }
 };
 
+/// Caching allocator with one free list per power-of-two size class
+/** The blocks handed out by the pool are recorded with their size, so that
+    Dealloc() recognizes them and rejects pointers not allocated by the pool,
+    e.g. external arrays adopted by a Memory object of type HOST_POOL. */
+class HostPool
+{
+   struct Block { Block *next; };
+   typedef std::unordered_map<void*, size_t> BlockMap;
+
+   static constexpr int min_class = 4;  // 16 bytes
+   static constexpr int max_class = 30; // 1 GB, larger blocks are not cached
+   static constexpr int num_classes = max_class - min_class + 1;
+
+   std::mutex mutex;
+   Block *free_list[num_classes];
+   // The blocks in use and their sizes. Created on first use and never
+   // deleted, so that the pool remains valid during static destruction.
+   BlockMap *in_use;
+   MemoryPoolStats stats;
+
+   static int SizeClass(size_t bytes)
+   {
+      int c = 0;
+      while (c < num_classes && (size_t(1) << (c + min_class)) < bytes) { c++; }
+      return c;
+   }
+
+   static size_t ClassBytes(int c, size_t bytes)
+   { return (c < num_classes) ? (size_t(1) << (c + min_class)) : bytes; }
+
+   void Insert(void *ptr, size_t block_bytes)
+   {
+      if (!in_use) { in_use = new BlockMap; }
+      (*in_use)[ptr] = block_bytes;
+   }
+
+public:
+   // Constant initialization: the pool can be used during static
+   // initialization and destruction of other objects.
+   constexpr HostPool() : mutex(), free_list{}, in_use(nullptr), stats{} { }
+
+   void *Alloc(size_t bytes)
+   {
+      const int c = SizeClass(bytes);
+      const size_t block_bytes = ClassBytes(c, bytes);
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         stats.bytes_in_use += block_bytes;
+         stats.peak_bytes = std::max(stats.peak_bytes, stats.bytes_in_use);
+         if (c < num_classes && free_list[c])
+         {
+            Block *block = free_list[c];
+            free_list[c] = block->next;
+            stats.bytes_cached -= block_bytes;
+            stats.hits++;
+            Insert(block, block_bytes);
+            return block;
+         }
+         stats.misses++;
+      }
+      void *ptr = std::malloc(block_bytes);
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!ptr)
+      {
+         stats.bytes_in_use -= block_bytes;
+         throw ::std::bad_alloc();
+      }
+      Insert(ptr, block_bytes);
+      return ptr;
+   }
+
+   /** @brief Return the block @a ptr to the pool. Returns false, without
+       changing the pool, if @a ptr was not allocated by Alloc(). */
+   bool Dealloc(void *ptr)
+   {
+      if (!ptr) { return true; }
+      size_t block_bytes;
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         BlockMap::iterator it;
+         if (!in_use || (it = in_use->find(ptr)) == in_use->end())
+         {
+            return false;
+         }
+         block_bytes = it->second;
+         in_use->erase(it);
+         stats.bytes_in_use -= block_bytes;
+         const int c = SizeClass(block_bytes);
+         if (c < num_classes)
+         {
+            Block *block = static_cast<Block*>(ptr);
+            block->next = free_list[c];
+            free_list[c] = block;
+            stats.bytes_cached += block_bytes;
+            return true;
+         }
+      }
+      std::free(ptr);
+      return true;
+   }
+
+   /// Return true if @a ptr is a block in use allocated by Alloc().
+   bool Owns(const void *ptr)
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      return in_use && in_use->count(const_cast<void*>(ptr));
+   }
+
+   void Release()
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (int c = 0; c < num_classes; c++)
+      {
+         while (free_list[c])
+         {
+            Block *block = free_list[c];
+            free_list[c] = block->next;
+            std::free(block);
+         }
+      }
+      stats.bytes_cached = 0;
+   }
+
+   MemoryPoolStats Stats()
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      return stats;
+   }
+};
+
+} // namespace mfem::internal
+
+static internal::HostPool host_pool;
+
+namespace internal
+{
+
+/// The pool host memory space, used for registered HOST_POOL memory
+class PoolHostMemorySpace : public HostMemorySpace
+{
+public:
+   PoolHostMemorySpace(): HostMemorySpace() { }
+   void Alloc(void **ptr, size_t bytes) { *ptr = host_pool.Alloc(bytes); }
+   // External arrays wrapped as HOST_POOL memory are not deleted here, see
+   // MemoryManager::Delete_()
+   void Dealloc(void *ptr) { host_pool.Dealloc(ptr); }
+};
+
 /// The UVM host memory space
 class UvmHostMemorySpace : public HostMemorySpace
 {
@@ -569,6 +720,7 @@ public:
       // HOST_DEBUG is delayed, as it reroutes signals
       host[static_cast<int>(MT::HOST_DEBUG)] = nullptr;
       host[static_cast<int>(MT::HOST_UMPIRE)] = new UmpireHostMemorySpace();
+      host[static_cast<int>(MT::HOST_POOL)] = new PoolHostMemorySpace();
       host[static_cast<int>(MT::MANAGED)] = new UvmHostMemorySpace();
 
       // Filling the device memory backends, shifting with the device size
@@ -722,6 +874,8 @@ MemoryType MemoryManager::Delete_(void *h_ptr, MemoryType mt, unsigned flags)
    const bool owns_device = flags & Mem::OWNS_DEVICE;
    const bool owns_internal = flags & Mem::OWNS_INTERNAL;
    MFEM_ASSERT(registered || IsHostMemory(mt),"");
+   MFEM_ASSERT(registered || mt != MemoryType::HOST_POOL,
+               "unregistered HOST_POOL memory is deleted by Memory::Delete");
    MFEM_ASSERT(!owns_device || owns_internal, "invalid Memory state");
    if (!mm.exists || !registered) { return mt; }
    if (alias)
@@ -736,9 +890,13 @@ MemoryType MemoryManager::Delete_(void *h_ptr, MemoryType mt, unsigned flags)
    }
    else // Known
    {
-      const MemoryType h_mt = mt;
+      MemoryType h_mt = mt;
       MFEM_ASSERT(!owns_internal ||
                   mt == maps->memories.at(h_ptr).h_mt,"");
+      // External arrays wrapped as HOST_POOL memory are deleted by
+      // Memory::Delete() as HOST memory
+      if (h_mt == MemoryType::HOST_POOL && !host_pool.Owns(h_ptr))
+      { h_mt = MemoryType::HOST; }
       if (owns_host && (h_mt != MemoryType::HOST))
       { ctrl->Host(h_mt)->Dealloc(h_ptr); }
       if (owns_internal) { mm.Erase(h_ptr, owns_device); }
@@ -1290,6 +1448,7 @@ void MemoryManager::Destroy()
    }
    delete maps; maps = nullptr;
    delete ctrl; ctrl = nullptr;
+   host_pool.Release();
    host_mem_type = MemoryType::HOST;
    device_mem_type = MemoryType::HOST;
    exists = false;
@@ -1352,6 +1511,26 @@ int MemoryManager::CompareHostAndDevice_(void *h_ptr, size_t size,
 }
 
 
+void *MemoryManager::PoolNew_(size_t bytes)
+{
+   return host_pool.Alloc(bytes);
+}
+
+bool MemoryManager::PoolDelete_(void *h_ptr)
+{
+   return host_pool.Dealloc(h_ptr);
+}
+
+MemoryPoolStats MemoryManager::GetHostPoolStats()
+{
+   return host_pool.Stats();
+}
+
+void MemoryManager::ReleaseHostPool()
+{
+   host_pool.Release();
+}
+
 void MemoryPrintFlags(unsigned flags)
 {
    typedef Memory<int> Mem;
@@ -1390,7 +1569,7 @@ MemoryType MemoryManager::device_mem_type = MemoryType::HOST;
 
 const char *MemoryTypeName[MemoryTypeSize] =
 {
-   "host-std", "host-32", "host-64", "host-debug", "host-umpire",
+   "host-std", "host-32", "host-64", "host-debug", "host-umpire", "host-pool",
 #if defined(MFEM_USE_CUDA)
    "cuda-uvm",
    "cuda",
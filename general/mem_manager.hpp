@@ -32,6 +32,8 @@ enum class MemoryType
    HOST_64,        ///< Host memory; aligned at 64 bytes
    HOST_DEBUG,     ///< Host memory; allocated from a "host-debug" pool
    HOST_UMPIRE,    ///< Host memory; using Umpire
+   HOST_POOL,      /**< Host memory; using MFEM's caching pool allocator, see
+                        MemoryManager::GetHostPoolStats() */
    MANAGED,        /**< Managed memory; using CUDA or HIP *MallocManaged
                         and *Free */
    DEVICE,         ///< Device memory; using CUDA or HIP *Malloc and *Free
@@ -58,7 +60,7 @@ extern const char *MemoryTypeName[MemoryTypeSize];
 enum class MemoryClass
 {
    HOST,    /**< Memory types: { HOST, HOST_32, HOST_64, HOST_DEBUG,
-                                 HOST_UMPIRE, MANAGED } */
+                                 HOST_UMPIRE, HOST_POOL, MANAGED } */
    HOST_32, ///< Memory types: { HOST_32, HOST_64, HOST_DEBUG }
    HOST_64, ///< Memory types: { HOST_64, HOST_DEBUG }
    DEVICE,  ///< Memory types: { DEVICE, DEVICE_DEBUG, DEVICE_UMPIRE, MANAGED }
@@ -82,6 +84,16 @@ MemoryType GetMemoryType(MemoryClass mc);
     HOST < HOST_32 < HOST_64 < DEVICE < MANAGED. */
 MemoryClass operator*(MemoryClass mc1, MemoryClass mc2);
 
+/// Statistics of the caching pool allocator used by MemoryType::HOST_POOL.
+struct MemoryPoolStats
+{
+   std::size_t hits;         ///< Number of allocations reusing a cached block
+   std::size_t misses;       ///< Number of allocations of a new block
+   std::size_t bytes_in_use; ///< Size of the blocks currently allocated
+   std::size_t peak_bytes;   ///< Maximum of #bytes_in_use
+   std::size_t bytes_cached; ///< Size of the blocks cached for reuse
+};
+
 /// Class used by MFEM to store pointers to host and/or device memory.
 /** The template class parameter, T, must be a plain-old-data (POD) type.
 
@@ -267,7 +279,9 @@ public:
    /** @brief Wrap an externally allocated host pointer, @a ptr with the current
        host memory type returned by MemoryManager::GetHostMemoryType(). */
    /** The parameter @a own determines whether @a ptr will be deleted when the
-       method Delete() is called.
+       method Delete() is called. An owned @a ptr must be allocated with the
+       current host memory type, e.g. by Memory(int). With the type
+       MemoryType::HOST_POOL, arrays allocated with new[] are also accepted.
 
        @note The current memory is NOT deleted by this method. */
    inline void Wrap(T *ptr, int size, bool own);
@@ -576,6 +590,13 @@ private: // Static methods used by the Memory<T> class
    /// Compare the contents of the host and the device memory.
    static int CompareHostAndDevice_(void *h_ptr, size_t size, unsigned flags);
 
+   /// Allocate @a bytes from the HOST_POOL allocator, without registration.
+   static void *PoolNew_(size_t bytes);
+
+   /** @brief Return a block allocated with PoolNew_() to the pool. Returns
+       false if @a h_ptr was not allocated by the pool. */
+   static bool PoolDelete_(void *h_ptr);
+
 private:
 
    /// Insert a host address in the memory map
@@ -651,6 +672,16 @@ public:
 
    static MemoryType GetHostMemoryType() { return host_mem_type; }
    static MemoryType GetDeviceMemoryType() { return device_mem_type; }
+
+   /// Return the statistics of the MemoryType::HOST_POOL allocator.
+   /** Blocks are cached in power-of-two size classes; @a hits counts the
+       allocations that reused a cached block. */
+   static MemoryPoolStats GetHostPoolStats();
+
+   /// Free all the blocks cached by the MemoryType::HOST_POOL allocator.
+   /** Blocks that are currently in use are not affected. The cache is also
+       released by Destroy(). */
+   static void ReleaseHostPool();
 };
 
 
@@ -681,6 +712,8 @@ inline void Memory<T>::New(int size)
    flags = OWNS_HOST | VALID_HOST;
    h_mt = MemoryManager::host_mem_type;
    h_ptr = (h_mt == MemoryType::HOST) ? Alloc<new_align_bytes>::New(size) :
+           (h_mt == MemoryType::HOST_POOL) ?
+           (T*)MemoryManager::PoolNew_(size*sizeof(T)) :
            (T*)MemoryManager::New_(nullptr, size*sizeof(T), h_mt, flags);
 }
 
@@ -689,11 +722,15 @@ inline void Memory<T>::New(int size, MemoryType mt)
 {
    capacity = size;
    const size_t bytes = size*sizeof(T);
-   const bool mt_host = mt == MemoryType::HOST;
+   // HOST and HOST_POOL memory is registered only when used on the device
+   const bool mt_host =
+      mt == MemoryType::HOST || mt == MemoryType::HOST_POOL;
    if (mt_host) { flags = OWNS_HOST | VALID_HOST; }
    h_mt = IsHostMemory(mt) ? mt : MemoryManager::GetDualMemoryType_(mt);
    T *h_tmp = (h_mt == MemoryType::HOST) ?
-              Alloc<new_align_bytes>::New(size) : nullptr;
+              Alloc<new_align_bytes>::New(size) :
+              (h_mt == MemoryType::HOST_POOL) ?
+              (T*)MemoryManager::PoolNew_(bytes) : nullptr;
    h_ptr = (mt_host) ? h_tmp : (T*)MemoryManager::New_(h_tmp, bytes, mt, flags);
 }
 
@@ -709,7 +746,9 @@ inline void Memory<T>::Wrap(T *ptr, int size, bool own)
    if (own && MemoryManager::Exists())
    { MFEM_VERIFY(h_mt == MemoryManager::GetHostMemoryType_(h_ptr),""); }
 #endif
-   if (own && h_mt != MemoryType::HOST)
+   // Owned HOST_POOL memory is not registered, as in New(), and it is returned
+   // to the pool by Delete()
+   if (own && h_mt != MemoryType::HOST && h_mt != MemoryType::HOST_POOL)
    { MemoryManager::Register_(ptr, ptr, bytes, h_mt, own, false, flags); }
 }
 
@@ -721,7 +760,7 @@ inline void Memory<T>::Wrap(T *ptr, int size, MemoryType mt, bool own)
    {
       h_mt = mt;
       h_ptr = ptr;
-      if (mt == MemoryType::HOST || !own)
+      if (mt == MemoryType::HOST || mt == MemoryType::HOST_POOL || !own)
       {
          // Skip restration
          flags = (own ? OWNS_HOST : 0) | VALID_HOST;
@@ -774,6 +813,14 @@ inline void Memory<T>::Delete()
    const bool mt_host = h_mt == MemoryType::HOST;
    const bool std_delete = !registered && mt_host;
 
+   if (!registered && h_mt == MemoryType::HOST_POOL)
+   {
+      // External arrays adopted as HOST_POOL memory, e.g. with
+      // SetHostPtrOwner(), are not returned to the pool
+      if ((flags & OWNS_HOST) && !MemoryManager::PoolDelete_(h_ptr))
+      { delete [] h_ptr; }
+      return;
+   }
    if (std_delete ||
        MemoryManager::Delete_((void*)h_ptr, h_mt, flags) == MemoryType::HOST)
    {
@@ -0,0 +1,421 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "profiler.hpp"
+#include "error.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mfem
+{
+
+namespace internal
+{
+
+struct ProfilerNode
+{
+   const char *name;
+   int parent;
+   std::vector<int> children;
+   long calls;
+   double time, start;
+   std::vector<std::pair<const char*, double>> counters;
+
+   ProfilerNode(const char *name_, int parent_)
+      : name(name_), parent(parent_), calls(0), time(0.0), start(0.0) { }
+};
+
+struct ProfilerEvent
+{
+   const char *name;
+   double start, duration;
+};
+
+/// The region tree and the trace events of one thread
+struct ProfilerThread
+{
+   int tid;
+   std::vector<ProfilerNode> nodes; // nodes[0] is the root
+   int current;
+   std::vector<ProfilerEvent> events;
+
+   explicit ProfilerThread(int tid_) : tid(tid_), current(0)
+   { nodes.emplace_back("", -1); }
+};
+
+/// Region data combined over threads and ranks, identified by name
+struct ProfilerEntry
+{
+   std::string name;
+   long calls = 0;
+   double time = 0.0;
+   std::map<std::string, double> counters;
+   std::vector<ProfilerEntry> children;
+
+   ProfilerEntry &Child(const std::string &child_name)
+   {
+      for (ProfilerEntry &c : children)
+      {
+         if (c.name == child_name) { return c; }
+      }
+      children.emplace_back();
+      children.back().name = child_name;
+      return children.back();
+   }
+};
+
+static std::mutex profiler_mutex;
+
+// Allocated on first use and never deleted, so that the data of threads
+// that are still running during static destruction remains valid.
+static std::vector<ProfilerThread*> &ProfilerThreads()
+{
+   static std::vector<ProfilerThread*> *threads =
+      new std::vector<ProfilerThread*>;
+   return *threads;
+}
+
+static ProfilerThread &ThisThread()
+{
+   thread_local ProfilerThread *data = nullptr;
+   if (!data)
+   {
+      std::lock_guard<std::mutex> lock(profiler_mutex);
+      std::vector<ProfilerThread*> &threads = ProfilerThreads();
+      data = new ProfilerThread((int) threads.size());
+      threads.push_back(data);
+   }
+   return *data;
+}
+
+static double ProfilerTime()
+{
+   typedef std::chrono::steady_clock clock;
+   static const clock::time_point epoch = clock::now();
+   return std::chrono::duration<double>(clock::now() - epoch).count();
+}
+
+static void MergeNode(const ProfilerThread &t, int n, ProfilerEntry &entry)
+{
+   const ProfilerNode &node = t.nodes[n];
+   entry.calls += node.calls;
+   entry.time += node.time;
+   for (const auto &c : node.counters) { entry.counters[c.first] += c.second; }
+   for (int c : node.children)
+   {
+      MergeNode(t, c, entry.Child(t.nodes[c].name));
+   }
+}
+
+static void MergeThreads(ProfilerEntry &root)
+{
+   std::lock_guard<std::mutex> lock(profiler_mutex);
+   for (const ProfilerThread *t : ProfilerThreads()) { MergeNode(*t, 0, root); }
+}
+
+static bool IsUsed(const ProfilerEntry &entry)
+{
+   if (entry.calls > 0) { return true; }
+   for (const ProfilerEntry &c : entry.children)
+   {
+      if (IsUsed(c)) { return true; }
+   }
+   return false;
+}
+
+static const int name_width = 48;
+
+static std::string Indented(const std::string &name, int depth)
+{
+   std::string s = std::string(2*depth, ' ') + name;
+   if ((int) s.size() > name_width) { s.resize(name_width); }
+   return s;
+}
+
+static void PrintEntry(const ProfilerEntry &entry, int depth, double parent,
+                       std::ostream &out)
+{
+   if (!IsUsed(entry)) { return; }
+   out << std::left << std::setw(name_width) << Indented(entry.name, depth)
+       << std::right << std::setw(10) << entry.calls
+       << std::setw(14) << entry.time
+       << std::setw(10) << std::setprecision(1) << std::fixed
+       << ((parent > 0.0) ? 100.0*entry.time/parent : 100.0)
+       << std::defaultfloat << std::setprecision(6) << '\n';
+   for (const auto &c : entry.counters)
+   {
+      out << std::left << std::setw(name_width)
+          << Indented("# " + c.first, depth + 1)
+          << std::right << std::setw(10) << c.second << '\n';
+   }
+   for (const ProfilerEntry &c : entry.children)
+   {
+      PrintEntry(c, depth + 1, entry.time, out);
+   }
+}
+
+#ifdef MFEM_USE_MPI
+// Separators of the names in region paths, of counter names and of the paths
+// in a list. Sorting the paths puts the counters and the children of a region
+// right after it.
+static const char counter_sep = '\x1e', path_sep = '\x1f', list_sep = '\n';
+
+// Flatten the tree into paths, with the counters after their region path
+static void Flatten(const ProfilerEntry &entry, const std::string &path,
+                    std::map<std::string, double> &calls,
+                    std::map<std::string, double> &values)
+{
+   if (!IsUsed(entry)) { return; }
+   calls[path] = entry.calls;
+   values[path] = entry.time;
+   for (const auto &c : entry.counters)
+   {
+      values[path + counter_sep + c.first] = c.second;
+   }
+   for (const ProfilerEntry &c : entry.children)
+   {
+      Flatten(c, path + path_sep + c.name, calls, values);
+   }
+}
+#endif
+
+} // namespace mfem::internal
+
+bool Profiler::enabled = false;
+bool Profiler::tracing = false;
+
+void Profiler::Enable(bool trace)
+{
+   internal::ProfilerTime(); // set the time origin
+   enabled = true;
+   tracing = trace;
+}
+
+void Profiler::Disable()
+{
+   enabled = false;
+}
+
+void Profiler::Reset()
+{
+   std::lock_guard<std::mutex> lock(internal::profiler_mutex);
+   for (internal::ProfilerThread *t : internal::ProfilerThreads())
+   {
+      for (internal::ProfilerNode &node : t->nodes)
+      {
+         node.calls = 0;
+         node.time = 0.0;
+         node.counters.clear();
+      }
+      t->events.clear();
+   }
+}
+
+void Profiler::Begin(const char *name)
+{
+   internal::ProfilerThread &t = internal::ThisThread();
+   const int parent = t.current;
+   int node = -1;
+   for (int c : t.nodes[parent].children)
+   {
+      const char *c_name = t.nodes[c].name;
+      if (c_name == name || !std::strcmp(c_name, name)) { node = c; break; }
+   }
+   if (node < 0)
+   {
+      node = (int) t.nodes.size();
+      t.nodes.emplace_back(name, parent);
+      t.nodes[parent].children.push_back(node);
+   }
+   t.current = node;
+   t.nodes[node].start = internal::ProfilerTime();
+}
+
+void Profiler::End()
+{
+   const double now = internal::ProfilerTime();
+   internal::ProfilerThread &t = internal::ThisThread();
+   MFEM_VERIFY(t.current > 0, "no open region");
+   internal::ProfilerNode &node = t.nodes[t.current];
+   node.calls++;
+   node.time += now - node.start;
+   if (tracing) { t.events.push_back({node.name, node.start, now - node.start}); }
+   t.current = node.parent;
+}
+
+void Profiler::AddCount(const char *name, double value)
+{
+   if (!enabled) { return; }
+   internal::ProfilerThread &t = internal::ThisThread();
+   auto &counters = t.nodes[t.current].counters;
+   for (auto &c : counters)
+   {
+      if (c.first == name || !std::strcmp(c.first, name))
+      {
+         c.second += value;
+         return;
+      }
+   }
+   counters.emplace_back(name, value);
+}
+
+void Profiler::Print(std::ostream &out)
+{
+   internal::ProfilerEntry root;
+   internal::MergeThreads(root);
+
+   using internal::name_width;
+   out << std::left << std::setw(name_width) << "Region"
+       << std::right << std::setw(10) << "Calls" << std::setw(14) << "Time (s)"
+       << std::setw(10) << "% parent" << '\n'
+       << std::string(name_width + 34, '-') << '\n';
+   for (const internal::ProfilerEntry &c : root.children)
+   {
+      internal::PrintEntry(c, 0, 0.0, out);
+   }
+   out << std::flush;
+}
+
+#ifdef MFEM_USE_MPI
+void Profiler::Print(MPI_Comm comm, std::ostream &out)
+{
+   using namespace internal;
+
+   int rank, size;
+   MPI_Comm_rank(comm, &rank);
+   MPI_Comm_size(comm, &size);
+
+   ProfilerEntry root;
+   MergeThreads(root);
+   std::map<std::string, double> calls, values;
+   for (const ProfilerEntry &c : root.children)
+   {
+      Flatten(c, c.name, calls, values);
+   }
+
+   // Gather the keys of all ranks on rank 0 and broadcast their union
+   std::string keys;
+   for (const auto &v : values) { keys += v.first + list_sep; }
+   int len = (int) keys.size();
+   std::vector<int> lens(size), offsets(size + 1, 0);
+   MPI_Gather(&len, 1, MPI_INT, lens.data(), 1, MPI_INT, 0, comm);
+   for (int i = 0; i < size; i++) { offsets[i+1] = offsets[i] + lens[i]; }
+   std::vector<char> all_keys(rank == 0 ? offsets[size] : 0);
+   MPI_Gatherv(&keys[0], len, MPI_CHAR, all_keys.data(), lens.data(),
+               offsets.data(), MPI_CHAR, 0, comm);
+   if (rank == 0)
+   {
+      std::map<std::string, double> all;
+      std::string key;
+      for (char ch : all_keys)
+      {
+         if (ch == list_sep) { all[key]; key.clear(); }
+         else { key += ch; }
+      }
+      keys.clear();
+      for (const auto &v : all) { keys += v.first + list_sep; }
+      len = (int) keys.size();
+   }
+   MPI_Bcast(&len, 1, MPI_INT, 0, comm);
+   keys.resize(len);
+   MPI_Bcast(&keys[0], len, MPI_CHAR, 0, comm);
+
+   std::vector<std::string> union_keys;
+   std::string key;
+   for (char ch : keys)
+   {
+      if (ch == list_sep) { union_keys.push_back(key); key.clear(); }
+      else { key += ch; }
+   }
+
+   // Reduce the values; missing regions count as zero
+   const int n = (int) union_keys.size();
+   std::vector<double> loc(2*n), min(2*n), max(2*n), sum(2*n);
+   for (int i = 0; i < n; i++)
+   {
+      auto v = values.find(union_keys[i]);
+      auto c = calls.find(union_keys[i]);
+      loc[i] = (v != values.end()) ? v->second : 0.0;
+      loc[n+i] = (c != calls.end()) ? c->second : 0.0;
+   }
+   MPI_Reduce(loc.data(), min.data(), 2*n, MPI_DOUBLE, MPI_MIN, 0, comm);
+   MPI_Reduce(loc.data(), max.data(), 2*n, MPI_DOUBLE, MPI_MAX, 0, comm);
+   MPI_Reduce(loc.data(), sum.data(), 2*n, MPI_DOUBLE, MPI_SUM, 0, comm);
+   if (rank != 0) { return; }
+
+   out << std::left << std::setw(name_width) << "Region"
+       << std::right << std::setw(10) << "Max calls"
+       << std::setw(14) << "Min" << std::setw(14) << "Max"
+       << std::setw(14) << "Avg" << '\n'
+       << std::string(name_width + 52, '-') << '\n';
+   for (int i = 0; i < n; i++)
+   {
+      const std::string &k = union_keys[i];
+      const size_t c_pos = k.find(counter_sep);
+      const bool counter = (c_pos != std::string::npos);
+      const std::string path = counter ? k.substr(0, c_pos) : k;
+      int depth = 0;
+      for (char ch : path) { depth += (ch == path_sep); }
+      const size_t start = path.rfind(path_sep);
+      std::string name = (start == std::string::npos) ?
+                         path : path.substr(start + 1);
+      if (counter) { name = "# " + k.substr(c_pos + 1); depth++; }
+      out << std::left << std::setw(name_width) << Indented(name, depth)
+          << std::right << std::setw(10);
+      if (counter) { out << ""; }
+      else { out << (long) max[n+i]; }
+      out << std::setw(14) << min[i] << std::setw(14) << max[i]
+          << std::setw(14) << sum[i]/size << '\n';
+   }
+   out << std::flush;
+}
+#endif
+
+void Profiler::PrintChromeTrace(std::ostream &out)
+{
+   int pid = 0;
+#ifdef MFEM_USE_MPI
+   int mpi_init;
+   MPI_Initialized(&mpi_init);
+   if (mpi_init) { MPI_Comm_rank(MPI_COMM_WORLD, &pid); }
+#endif
+   std::lock_guard<std::mutex> lock(internal::profiler_mutex);
+   out << "{\"traceEvents\":[";
+   bool first = true;
+   for (const internal::ProfilerThread *t : internal::ProfilerThreads())
+   {
+      for (const internal::ProfilerEvent &e : t->events)
+      {
+         std::string name;
+         for (const char *c = e.name; *c; c++)
+         {
+            if (*c == '"' || *c == '\\') { name += '\\'; }
+            name += *c;
+         }
+         out << (first ? "\n" : ",\n")
+             << "{\"name\":\"" << name << "\",\"cat\":\"mfem\",\"ph\":\"X\""
+             << ",\"ts\":" << std::fixed << std::setprecision(3)
+             << 1e6*e.start << ",\"dur\":" << 1e6*e.duration
+             << std::defaultfloat << ",\"pid\":" << pid
+             << ",\"tid\":" << t->tid << "}";
+         first = false;
+      }
+   }
+   out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+} // namespace mfem
@@ -0,0 +1,107 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_PROFILER
+#define MFEM_PROFILER
+
+#include "../config/config.hpp"
+#include "globals.hpp"
+
+#ifdef MFEM_USE_MPI
+#include <mpi.h>
+#endif
+
+namespace mfem
+{
+
+/** @brief Lightweight profiler of nested code regions.
+
+    Regions are opened and closed with the MFEM_PERF_SCOPE macro (or with a
+    ProfilerRegion object). When the profiler is enabled, each thread builds a
+    tree of regions, so the same region entered from different parents, e.g.
+    "ElementRestriction::Mult" from "CGSolver::Mult" and from
+    "BilinearForm::Assemble", is timed separately. Each region also holds
+    named counters, see AddCount().
+
+    The results can be printed as a text table, reduced over all MPI ranks
+    (min/max/avg), and written as a trace in the Chrome trace event format,
+    which can be viewed in chrome://tracing or https://ui.perfetto.dev.
+
+    When the profiler is disabled (the default), opening a region only checks
+    a flag. */
+class Profiler
+{
+public:
+   /// Start recording. If @a trace is true, also record all region events.
+   static void Enable(bool trace = false);
+
+   /// Stop recording. The recorded data is kept.
+   static void Disable();
+
+   /// Return true if the profiler is recording.
+   static bool IsEnabled() { return enabled; }
+
+   /// Clear all recorded data on all threads. Open regions are kept open.
+   static void Reset();
+
+   /// Open a region with the given @a name, nested in the current one.
+   /** The @a name must remain valid until Reset() or the end of the program,
+       e.g. a string literal. */
+   static void Begin(const char *name);
+
+   /// Close the current region.
+   static void End();
+
+   /// Add @a value to the counter @a name of the current region.
+   static void AddCount(const char *name, double value = 1.0);
+
+   /// Print a table with the calls, time and counters of all regions.
+   /** The data of all threads is combined. */
+   static void Print(std::ostream &out = mfem::out);
+
+#ifdef MFEM_USE_MPI
+   /** @brief Print a table with the min/max/avg time and counters of all
+       regions over the ranks of @a comm, on rank 0. Collective. */
+   static void Print(MPI_Comm comm, std::ostream &out = mfem::out);
+#endif
+
+   /// Write the recorded region events in the Chrome trace event format.
+   /** Requires that the profiler was enabled with @a trace = true. */
+   static void PrintChromeTrace(std::ostream &out);
+
+private:
+   static bool enabled, tracing;
+};
+
+/// Scoped profiler region, see MFEM_PERF_SCOPE.
+class ProfilerRegion
+{
+private:
+   bool active;
+
+public:
+   explicit ProfilerRegion(const char *name)
+      : active(Profiler::IsEnabled())
+   { if (active) { Profiler::Begin(name); } }
+
+   ~ProfilerRegion() { if (active) { Profiler::End(); } }
+};
+
+#define MFEM_PERF_CONCAT_(a,b) a##b
+#define MFEM_PERF_CONCAT(a,b) MFEM_PERF_CONCAT_(a,b)
+
+/// Time the enclosing scope as a region of the Profiler.
+#define MFEM_PERF_SCOPE(name) \
+   mfem::ProfilerRegion MFEM_PERF_CONCAT(mfem_perf_region_,__LINE__)(name)
+
+} // namespace mfem
+
+#endif
@@ -19,6 +19,7 @@
 #include "densemat.hpp"
 #include "../general/table.hpp"
 #include "../general/globals.hpp"
+#include "../general/forall.hpp"
 
 #include <iostream>
 #include <iomanip>
@@ -3500,4 +3501,432 @@ DenseTensor &DenseTensor::operator=(double c)
    return *this;
 }
 
+// Same algorithm as LUFactors::Factor() without LAPACK, for a single matrix of
+// the batch. The pivots are stored with the offset LUFactors::ipiv_base.
+MFEM_HOST_DEVICE static inline
+bool BatchLUFactorMatrix(const int m, double *lu, int *ipiv, const double TOL)
+{
+   for (int i = 0; i < m; i++)
+   {
+      // pivoting
+      int piv = i;
+      double a = fabs(lu[piv+i*m]);
+      for (int j = i+1; j < m; j++)
+      {
+         const double b = fabs(lu[j+i*m]);
+         if (b > a)
+         {
+            a = b;
+            piv = j;
+         }
+      }
+      ipiv[i] = piv + LUFactors::ipiv_base;
+      if (piv != i)
+      {
+         // swap rows i and piv in both L and U parts
+         for (int j = 0; j < m; j++)
+         {
+            const double tmp = lu[i+j*m];
+            lu[i+j*m] = lu[piv+j*m];
+            lu[piv+j*m] = tmp;
+         }
+      }
+
+      if (fabs(lu[i+i*m]) <= TOL)
+      {
+         return false; // failed
+      }
+
+      const double a_ii_inv = 1.0 / lu[i+i*m];
+      for (int j = i+1; j < m; j++)
+      {
+         lu[j+i*m] *= a_ii_inv;
+      }
+      for (int k = i+1; k < m; k++)
+      {
+         const double a_ik = lu[i+k*m];
+         for (int j = i+1; j < m; j++)
+         {
+            lu[j+k*m] -= a_ik * lu[j+i*m];
+         }
+      }
+   }
+   return true;
+}
+
+// x <- A^{-1} x for a single matrix of the batch, see LUFactors::Solve().
+MFEM_HOST_DEVICE static inline
+void BatchLUSolveVector(const int m, const double *lu, const int *ipiv,
+                        double *x)
+{
+   // x <- P x
+   for (int i = 0; i < m; i++)
+   {
+      const int piv = ipiv[i] - LUFactors::ipiv_base;
+      const double tmp = x[i];
+      x[i] = x[piv];
+      x[piv] = tmp;
+   }
+   // x <- L^{-1} x
+   for (int j = 0; j < m; j++)
+   {
+      const double x_j = x[j];
+      for (int i = j+1; i < m; i++)
+      {
+         x[i] -= lu[i+j*m] * x_j;
+      }
+   }
+   // x <- U^{-1} x
+   for (int j = m-1; j >= 0; j--)
+   {
+      const double x_j = (x[j] /= lu[j+j*m]);
+      for (int i = 0; i < j; i++)
+      {
+         x[i] -= lu[i+j*m] * x_j;
+      }
+   }
+}
+
+// The host versions of the batched LU kernels process groups of batch_width
+// matrices stored interleaved: entry (i,j) of matrix w of the group is stored
+// at index (i+j*m)*batch_width+w. The innermost loops run over the matrices of
+// the group, so they are vectorized by the compiler. Larger matrices, whose
+// interleaved group no longer fits in the L1 cache, and the device and OpenMP
+// backends use one MFEM_FORALL iteration per matrix.
+static const int batch_width = 8;
+static const int batch_max_size = 16;
+
+static bool UseInterleavedBatch(const int m)
+{
+   return (m <= batch_max_size &&
+           !Device::Allows(Backend::DEVICE_MASK | Backend::OMP_MASK));
+}
+
+// Interleave the @a nw <= batch_width matrices of size (m x m) starting at @a A
+// into @a B, filling the remaining matrices of the group with the identity.
+static void InterleaveBatch(const int m, const int nw, const double *A,
+                            double *B)
+{
+   const int W = batch_width;
+   for (int ij = 0; ij < m*m; ij++)
+   {
+      const double id = (ij % (m+1) == 0) ? 1.0 : 0.0;
+      for (int w = 0; w < nw; w++) { B[ij*W+w] = A[w*m*m+ij]; }
+      for (int w = nw; w < W; w++) { B[ij*W+w] = id; }
+   }
+}
+
+static void DeinterleaveBatch(const int m, const int nw, const double *B,
+                              double *A)
+{
+   const int W = batch_width;
+   for (int w = 0; w < nw; w++)
+   {
+      for (int ij = 0; ij < m*m; ij++)
+      {
+         A[w*m*m+ij] = B[ij*W+w];
+      }
+   }
+}
+
+// Interleave the pivots of @a nw matrices, see InterleaveBatch().
+static void InterleavePivots(const int m, const int nw, const int *P, int *Q)
+{
+   const int W = batch_width;
+   for (int w = 0; w < W; w++)
+   {
+      for (int i = 0; i < m; i++)
+      {
+         Q[i*W+w] = (w < nw) ? P[w*m+i] : i + LUFactors::ipiv_base;
+      }
+   }
+}
+
+// Same algorithm as BatchLUFactorMatrix() for a group of interleaved matrices,
+// with separate pivoting in each matrix.
+static bool BatchLUFactorInterleaved(const int m, double *lu, int *ipiv,
+                                     const double TOL)
+{
+   const int W = batch_width;
+   double a[W], a_ii_inv[W], u_ik[W];
+   int piv[W];
+   for (int i = 0; i < m; i++)
+   {
+      double *col_i = lu + i*m*W;
+      // pivoting
+      for (int w = 0; w < W; w++)
+      {
+         a[w] = fabs(col_i[i*W+w]);
+         piv[w] = i;
+      }
+      for (int j = i+1; j < m; j++)
+      {
+         for (int w = 0; w < W; w++)
+         {
+            const double b = fabs(col_i[j*W+w]);
+            piv[w] = (b > a[w]) ? j : piv[w];
+            a[w] = (b > a[w]) ? b : a[w];
+         }
+      }
+      for (int w = 0; w < W; w++)
+      {
+         ipiv[i*W+w] = piv[w] + LUFactors::ipiv_base;
+         if (piv[w] != i)
+         {
+            // swap rows i and piv in both L and U parts
+            for (int j = 0; j < m; j++)
+            {
+               const double tmp = lu[(i+j*m)*W+w];
+               lu[(i+j*m)*W+w] = lu[(piv[w]+j*m)*W+w];
+               lu[(piv[w]+j*m)*W+w] = tmp;
+            }
+         }
+      }
+      bool failed = false;
+      for (int w = 0; w < W; w++)
+      {
+         failed = failed || (fabs(col_i[i*W+w]) <= TOL);
+         a_ii_inv[w] = 1.0 / col_i[i*W+w];
+      }
+      if (failed) { return false; }
+
+      for (int j = i+1; j < m; j++)
+      {
+         for (int w = 0; w < W; w++) { col_i[j*W+w] *= a_ii_inv[w]; }
+      }
+      for (int k = i+1; k < m; k++)
+      {
+         double *col_k = lu + k*m*W;
+         for (int w = 0; w < W; w++) { u_ik[w] = col_k[i*W+w]; }
+         for (int j = i+1; j < m; j++)
+         {
+            for (int w = 0; w < W; w++)
+            {
+               col_k[j*W+w] -= u_ik[w] * col_i[j*W+w];
+            }
+         }
+      }
+   }
+   return true;
+}
+
+// Same algorithm as BatchLUSolveVector() for a group of interleaved matrices
+// and vectors; entry i of vector w is stored at x[i*batch_width+w].
+static void BatchLUSolveInterleaved(const int m, const double *lu,
+                                    const int *ipiv, double *x)
+{
+   const int W = batch_width;
+   // x <- P x
+   for (int i = 0; i < m; i++)
+   {
+      for (int w = 0; w < W; w++)
+      {
+         const int piv = ipiv[i*W+w] - LUFactors::ipiv_base;
+         const double tmp = x[i*W+w];
+         x[i*W+w] = x[piv*W+w];
+         x[piv*W+w] = tmp;
+      }
+   }
+   // x <- L^{-1} x
+   for (int j = 0; j < m; j++)
+   {
+      for (int i = j+1; i < m; i++)
+      {
+         for (int w = 0; w < W; w++)
+         {
+            x[i*W+w] -= lu[(i+j*m)*W+w] * x[j*W+w];
+         }
+      }
+   }
+   // x <- U^{-1} x
+   for (int j = m-1; j >= 0; j--)
+   {
+      for (int w = 0; w < W; w++)
+      {
+         x[j*W+w] /= lu[(j+j*m)*W+w];
+      }
+      for (int i = 0; i < j; i++)
+      {
+         for (int w = 0; w < W; w++)
+         {
+            x[i*W+w] -= lu[(i+j*m)*W+w] * x[j*W+w];
+         }
+      }
+   }
+}
+
+bool BatchLUFactor(DenseTensor &Mlu, Array<int> &P, const double TOL)
+{
+   const int m = Mlu.SizeI();
+   const int n = Mlu.SizeK();
+   MFEM_VERIFY(Mlu.SizeJ() == m, "the matrices must be square");
+   P.SetSize(m*n);
+
+   if (UseInterleavedBatch(m))
+   {
+      const int W = batch_width;
+      double *h_lu = Mlu.HostReadWrite();
+      int *h_P = P.HostWrite();
+      Vector lu_buf(W*m*m);
+      Array<int> P_buf(W*m);
+      bool success = true;
+      for (int k = 0; k < n; k += W)
+      {
+         const int nw = std::min(W, n - k);
+         InterleaveBatch(m, nw, h_lu + k*m*m, lu_buf.GetData());
+         success = BatchLUFactorInterleaved(m, lu_buf.GetData(),
+                                            P_buf.GetData(), TOL) && success;
+         DeinterleaveBatch(m, nw, lu_buf.GetData(), h_lu + k*m*m);
+         for (int w = 0; w < nw; w++)
+         {
+            for (int i = 0; i < m; i++) { h_P[(k+w)*m+i] = P_buf[i*W+w]; }
+         }
+      }
+      return success;
+   }
+
+   Array<int> success(n);
+   auto d_lu = Mlu.ReadWrite();
+   auto d_P = P.Write();
+   auto d_success = success.Write();
+   MFEM_FORALL(k, n,
+   {
+      d_success[k] = BatchLUFactorMatrix(m, d_lu + k*m*m, d_P + k*m, TOL);
+   });
+   const int *h_success = success.HostRead();
+   for (int k = 0; k < n; k++)
+   {
+      if (!h_success[k]) { return false; }
+   }
+   return true;
+}
+
+void BatchLUSolve(const DenseTensor &Mlu, const Array<int> &P, Vector &X)
+{
+   const int m = Mlu.SizeI();
+   const int n = Mlu.SizeK();
+   MFEM_VERIFY(P.Size() == m*n && X.Size() == m*n, "incompatible sizes");
+
+   if (UseInterleavedBatch(m))
+   {
+      const int W = batch_width;
+      const double *h_lu = Mlu.HostRead();
+      const int *h_P = P.HostRead();
+      double *h_X = X.HostReadWrite();
+      Vector lu_buf(W*m*m), X_buf(W*m);
+      Array<int> P_buf(W*m);
+      for (int k = 0; k < n; k += W)
+      {
+         const int nw = std::min(W, n - k);
+         InterleaveBatch(m, nw, h_lu + k*m*m, lu_buf.GetData());
+         InterleavePivots(m, nw, h_P + k*m, P_buf.GetData());
+         for (int i = 0; i < m; i++)
+         {
+            for (int w = 0; w < W; w++)
+            {
+               X_buf(i*W+w) = (w < nw) ? h_X[(k+w)*m+i] : 0.0;
+            }
+         }
+         BatchLUSolveInterleaved(m, lu_buf.GetData(), P_buf.GetData(),
+                                 X_buf.GetData());
+         for (int w = 0; w < nw; w++)
+         {
+            for (int i = 0; i < m; i++) { h_X[(k+w)*m+i] = X_buf(i*W+w); }
+         }
+      }
+      return;
+   }
+
+   auto d_lu = Mlu.Read();
+   auto d_P = P.Read();
+   auto d_X = X.ReadWrite();
+   MFEM_FORALL(k, n,
+   {
+      BatchLUSolveVector(m, d_lu + k*m*m, d_P + k*m, d_X + k*m);
+   });
+}
+
+void BatchInverse(const DenseTensor &M, DenseTensor &Minv)
+{
+   const int m = M.SizeI();
+   const int n = M.SizeK();
+   MFEM_VERIFY(M.SizeJ() == m, "the matrices must be square");
+
+   DenseTensor Mlu(m, m, n);
+   Array<int> P;
+   Mlu.GetMemory().CopyFrom(M.GetMemory(), m*m*n);
+   MFEM_VERIFY(BatchLUFactor(Mlu, P), "singular matrix in the batch");
+
+   Minv.SetSize(m, m, n);
+   if (UseInterleavedBatch(m))
+   {
+      const int W = batch_width;
+      const double *h_lu = Mlu.HostRead();
+      const int *h_P = P.HostRead();
+      double *h_inv = Minv.HostWrite();
+      Vector lu_buf(W*m*m), X_buf(W*m);
+      Array<int> P_buf(W*m);
+      for (int k = 0; k < n; k += W)
+      {
+         const int nw = std::min(W, n - k);
+         InterleaveBatch(m, nw, h_lu + k*m*m, lu_buf.GetData());
+         InterleavePivots(m, nw, h_P + k*m, P_buf.GetData());
+         for (int j = 0; j < m; j++)
+         {
+            for (int i = 0; i < m; i++)
+            {
+               for (int w = 0; w < W; w++) { X_buf(i*W+w) = (i == j); }
+            }
+            BatchLUSolveInterleaved(m, lu_buf.GetData(), P_buf.GetData(),
+                                    X_buf.GetData());
+            for (int w = 0; w < nw; w++)
+            {
+               for (int i = 0; i < m; i++)
+               {
+                  h_inv[(k+w)*m*m+i+j*m] = X_buf(i*W+w);
+               }
+            }
+         }
+      }
+      return;
+   }
+   auto d_lu = Mlu.Read();
+   auto d_P = P.Read();
+   auto d_inv = Minv.Write();
+   MFEM_FORALL(k, n,
+   {
+      double *inv = d_inv + k*m*m;
+      for (int j = 0; j < m; j++)
+      {
+         for (int i = 0; i < m; i++) { inv[i+j*m] = (i == j) ? 1.0 : 0.0; }
+         BatchLUSolveVector(m, d_lu + k*m*m, d_P + k*m, inv + j*m);
+      }
+   });
+}
+
+void BatchMult(const DenseTensor &A, const DenseTensor &B, DenseTensor &C)
+{
+   const int m = A.SizeI(), l = A.SizeJ(), n = B.SizeJ();
+   const int nb = A.SizeK();
+   MFEM_VERIFY(B.SizeI() == l && B.SizeK() == nb, "incompatible sizes");
+   MFEM_VERIFY(&C != &A && &C != &B, "C must not alias A or B");
+
+   C.SetSize(m, n, nb);
+   auto d_A = Reshape(A.Read(), m, l, nb);
+   auto d_B = Reshape(B.Read(), l, n, nb);
+   auto d_C = Reshape(C.Write(), m, n, nb);
+   MFEM_FORALL(k, nb,
+   {
+      for (int j = 0; j < n; j++)
+      {
+         for (int i = 0; i < m; i++) { d_C(i,j,k) = 0.0; }
+         for (int p = 0; p < l; p++)
+         {
+            const double b_pj = d_B(p,j,k);
+            for (int i = 0; i < m; i++) { d_C(i,j,k) += d_A(i,p,k) * b_pj; }
+         }
+      }
+   });
+}
+
 }
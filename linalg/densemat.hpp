@@ -859,6 +859,32 @@ public:
    ~DenseTensor() { tdata.Delete(); }
 };
 
+/** @brief Compute the LU factorizations of a batch of square matrices.
+
+    Factorize the n matrices of size (m x m) stored in @a Mlu, overwriting them
+    with their LU factors, such that L.U = P.A for each matrix A. The pivots
+    are returned in @a P, of size (m x n), in the format of LUFactors, so the
+    factors of matrix k can be used with LUFactors(Mlu.GetData(k), &P[k*m]).
+
+    The matrices are factored in parallel, using the current Device.
+
+    @return true if all factorizations were successful, i.e. if all pivots are
+    larger than @a TOL in absolute value. */
+bool BatchLUFactor(DenseTensor &Mlu, Array<int> &P, const double TOL = 0.0);
+
+/** @brief Solve the batch of linear systems A_k x_k = b_k, given the factors
+    computed by BatchLUFactor().
+
+    The vector @a X is of size (m x n): on input, it contains the right-hand
+    sides b_k and on output, the solutions x_k. */
+void BatchLUSolve(const DenseTensor &Mlu, const Array<int> &P, Vector &X);
+
+/// Compute the inverses of a batch of square matrices, Minv(k) = M(k)^{-1}.
+void BatchInverse(const DenseTensor &M, DenseTensor &Minv);
+
+/// Compute the batch of matrix products C(k) = A(k) B(k).
+void BatchMult(const DenseTensor &A, const DenseTensor &B, DenseTensor &C);
+
 
 // Inline methods
 
@@ -15,6 +15,7 @@
 
 #include "linalg.hpp"
 #include "../fem/fem.hpp"
+#include "../general/profiler.hpp"
 
 #include <fstream>
 #include <iomanip>
@@ -2455,6 +2456,7 @@ HypreSolver::HypreSolver(HypreParMatrix *_A)
 
 void HypreSolver::Mult(const HypreParVector &b, HypreParVector &x) const
 {
+   MFEM_PERF_SCOPE("HypreSolver::Mult");
    HYPRE_Int err;
    if (A == NULL)
    {
@@ -2463,6 +2465,7 @@ void HypreSolver::Mult(const HypreParVector &b, HypreParVector &x) const
    }
    if (!setup_called)
    {
+      MFEM_PERF_SCOPE("HypreSolver::Setup");
       err = SetupFcn()(*this, *A, b, x);
       if (error_mode == WARN_HYPRE_ERRORS)
       {
@@ -12,6 +12,7 @@
 #include "linalg.hpp"
 #include "../general/forall.hpp"
 #include "../general/globals.hpp"
+#include "../general/profiler.hpp"
 #include "../fem/bilinearform.hpp"
 #include <iostream>
 #include <iomanip>
@@ -115,6 +116,18 @@ void IterativeSolver::Monitor(int it, double norm, const Vector& r,
    }
 }
 
+/// Profiler region of an iterative solve, which also counts its iterations
+class IterativeSolverRegion : public ProfilerRegion
+{
+   const int &final_iter;
+
+public:
+   IterativeSolverRegion(const char *name, const int &final_iter_)
+      : ProfilerRegion(name), final_iter(final_iter_) { }
+
+   ~IterativeSolverRegion() { Profiler::AddCount("iterations", final_iter); }
+};
+
 OperatorJacobiSmoother::OperatorJacobiSmoother(const BilinearForm &a,
                                                const Array<int> &ess_tdofs,
                                                const double dmpng)
@@ -356,6 +369,7 @@ void SLISolver::UpdateVectors()
 
 void SLISolver::Mult(const Vector &b, Vector &x) const
 {
+   IterativeSolverRegion region("SLISolver::Mult", final_iter);
    int i;
 
    // Optimized preconditioned SLI with fixed number of iterations and given
@@ -534,6 +548,7 @@ void CGSolver::UpdateVectors()
 
 void CGSolver::Mult(const Vector &b, Vector &x) const
 {
+   IterativeSolverRegion region("CGSolver::Mult", final_iter);
    int i;
    double r0, den, nom, nom0, betanom, alpha, beta;
 
@@ -800,6 +815,8 @@ void GMRESSolver::Mult(const Vector &b, Vector &x) const
    // Generalized Minimum Residual method following the algorithm
    // on p. 20 of the SIAM Templates book.
 
+   IterativeSolverRegion region("GMRESSolver::Mult", final_iter);
+
    int n = width;
 
    DenseMatrix H(m+1, m);
@@ -984,6 +1001,7 @@ finish:
 
 void FGMRESSolver::Mult(const Vector &b, Vector &x) const
 {
+   IterativeSolverRegion region("FGMRESSolver::Mult", final_iter);
    DenseMatrix H(m+1,m);
    Vector s(m+1), cs(m+1), sn(m+1);
    Vector r(b.Size());
@@ -1194,6 +1212,8 @@ void BiCGSTABSolver::Mult(const Vector &b, Vector &x) const
    // BiConjugate Gradient Stabilized method following the algorithm
    // on p. 27 of the SIAM Templates book.
 
+   IterativeSolverRegion region("BiCGSTABSolver::Mult", final_iter);
+
    int i;
    double resid, tol_goal;
    double rho_1, rho_2=1.0, alpha=1.0, beta, omega=1.0;
@@ -1369,6 +1389,8 @@ void MINRESSolver::Mult(const Vector &b, Vector &x) const
    // by Henk A. van der Vorst, 2003.
    // Extended to support an SPD preconditioner.
 
+   IterativeSolverRegion region("MINRESSolver::Mult", final_iter);
+
    int it;
    double beta, eta, gamma0, gamma1, sigma0, sigma1;
    double alpha, delta, rho1, rho2, rho3, norm_goal;
@@ -2427,11 +2449,10 @@ void BlockILU::Factorize()
    int nblockrows = Height()/block_size;
 
    // Precompute LU factorization of diagonal blocks
-   for (int i=0; i<nblockrows; ++i)
-   {
-      LUFactors factorization(DB.GetData(i), &ipiv[i*block_size]);
-      factorization.Factor(block_size);
-   }
+   MFEM_VERIFY(BatchLUFactor(DB, ipiv), "singular diagonal block");
+   // The rest of the factorization is sequential and performed on the host
+   DB.HostReadWrite();
+   ipiv.HostReadWrite();
 
    // Note: we use UseExternalData to extract submatrices from the tensor AB
    // instead of the DenseTensor call operator, because the call operator does
@@ -12,6 +12,7 @@
 // Implementation of sparse matrix
 
 #include "linalg.hpp"
+#include "simd.hpp"
 #include "../general/forall.hpp"
 #include "../general/table.hpp"
 #include "../general/sort_pairs.hpp"
@@ -35,6 +36,7 @@ SparseMatrix::SparseMatrix(int nrows, int ncols)
      ColPtrJ(NULL),
      ColPtrNode(NULL),
      At(NULL),
+     Sell(NULL),
      isSorted(false)
 {
    // We probably do not need to set the ownership flags here.
@@ -58,6 +60,7 @@ SparseMatrix::SparseMatrix(int *i, int *j, double *data, int m, int n)
      ColPtrJ(NULL),
      ColPtrNode(NULL),
      At(NULL),
+     Sell(NULL),
      isSorted(false)
 {
    I.Wrap(i, height+1, true);
@@ -76,6 +79,7 @@ SparseMatrix::SparseMatrix(int *i, int *j, double *data, int m, int n,
      ColPtrJ(NULL),
      ColPtrNode(NULL),
      At(NULL),
+     Sell(NULL),
      isSorted(issorted)
 {
    I.Wrap(i, height+1, ownij);
@@ -106,6 +110,7 @@ SparseMatrix::SparseMatrix(int nrows, int ncols, int rowsize)
    , ColPtrJ(NULL)
    , ColPtrNode(NULL)
    , At(NULL)
+   , Sell(NULL)
    , isSorted(false)
 {
 #ifdef MFEM_USE_MEMALLOC
@@ -183,6 +188,7 @@ SparseMatrix::SparseMatrix(const SparseMatrix &mat, bool copy_graph)
    ColPtrJ = NULL;
    ColPtrNode = NULL;
    At = NULL;
+   Sell = NULL;
    isSorted = mat.isSorted;
 }
 
@@ -192,6 +198,7 @@ SparseMatrix::SparseMatrix(const Vector &v)
    , ColPtrJ(NULL)
    , ColPtrNode(NULL)
    , At(NULL)
+   , Sell(NULL)
    , isSorted(true)
 {
 #ifdef MFEM_USE_MEMALLOC
@@ -246,6 +253,7 @@ void SparseMatrix::SetEmpty()
    ColPtrJ = NULL;
    ColPtrNode = NULL;
    At = NULL;
+   Sell = NULL;
 #ifdef MFEM_USE_MEMALLOC
    NodesMem = NULL;
 #endif
@@ -545,6 +553,132 @@ void SparseMatrix::ToDenseMatrix(DenseMatrix & B) const
    }
 }
 
+struct SparseMatrix::SellStorage
+{
+   /// Number of rows per slice and size of the sorting window.
+   int C, sigma;
+   int num_slices;
+   /// Original row of each (sorted) slice row, -1 for padding rows.
+   Memory<int> perm;
+   /// Offsets of the slices in #col and #val, of size num_slices+1.
+   Memory<int> slice_ptr;
+   /// Column indices and values of the slices, stored column by column.
+   Memory<int> col;
+   Memory<double> val;
+
+   ~SellStorage()
+   {
+      perm.Delete();
+      slice_ptr.Delete();
+      col.Delete();
+      val.Delete();
+   }
+
+   void AddMult(const Vector &x, Vector &y, const double a) const;
+};
+
+template <int C>
+static void SellAddMultHost(const int num_slices, const int *perm,
+                            const int *slice_ptr, const int *col,
+                            const double *val, const double *x, double *y,
+                            const double a)
+{
+   typedef AutoSIMD<double,C,C*sizeof(double)> simd_t;
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for schedule(static)
+#endif
+   for (int s = 0; s < num_slices; s++)
+   {
+      const int *cs = col + slice_ptr[s];
+      const double *vs = val + slice_ptr[s];
+      const int width = (slice_ptr[s+1] - slice_ptr[s]) / C;
+      simd_t sum, v, xv;
+      sum = 0.0;
+      for (int j = 0; j < width; j++)
+      {
+         for (int k = 0; k < C; k++)
+         {
+            v[k] = vs[j*C+k];
+            xv[k] = x[cs[j*C+k]];
+         }
+         sum.fma(v, xv);
+      }
+      for (int k = 0; k < C; k++)
+      {
+         const int r = perm[s*C+k];
+         if (r >= 0) { y[r] += a * sum[k]; }
+      }
+   }
+}
+
+template <int C>
+static void SellAddMultDevice(const int num_slices, const Memory<int> &perm,
+                              const Memory<int> &slice_ptr,
+                              const Memory<int> &col, const Memory<double> &val,
+                              const Vector &x, Vector &y, const double a)
+{
+   const int nnz = slice_ptr[num_slices];
+   auto d_perm = Read(perm, num_slices*C);
+   auto d_ptr = Read(slice_ptr, num_slices+1);
+   auto d_col = Read(col, nnz);
+   auto d_val = Read(val, nnz);
+   auto d_x = x.Read();
+   auto d_y = y.ReadWrite();
+   MFEM_FORALL(s, num_slices,
+   {
+      const int offset = d_ptr[s];
+      const int width = (d_ptr[s+1] - offset) / C;
+      double sum[C];
+      for (int k = 0; k < C; k++) { sum[k] = 0.0; }
+      for (int j = 0; j < width; j++)
+      {
+         for (int k = 0; k < C; k++)
+         {
+            const int jk = offset + j*C + k;
+            sum[k] += d_val[jk] * d_x[d_col[jk]];
+         }
+      }
+      for (int k = 0; k < C; k++)
+      {
+         const int r = d_perm[s*C+k];
+         if (r >= 0) { d_y[r] += a * sum[k]; }
+      }
+   });
+}
+
+void SparseMatrix::SellStorage::AddMult(const Vector &x, Vector &y,
+                                        const double a) const
+{
+   if (Device::Allows(Backend::DEVICE_MASK))
+   {
+      switch (C)
+      {
+         case 4: return SellAddMultDevice<4>(num_slices, perm, slice_ptr,
+                                                col, val, x, y, a);
+         case 8: return SellAddMultDevice<8>(num_slices, perm, slice_ptr,
+                                                col, val, x, y, a);
+      }
+   }
+   else
+   {
+      const int nnz = slice_ptr[num_slices];
+      const int *h_perm = HostRead(perm, num_slices*C);
+      const int *h_ptr = HostRead(slice_ptr, num_slices+1);
+      const int *h_col = HostRead(col, nnz);
+      const double *h_val = HostRead(val, nnz);
+      const double *h_x = x.HostRead();
+      double *h_y = y.HostReadWrite();
+      switch (C)
+      {
+         case 4: return SellAddMultHost<4>(num_slices, h_perm, h_ptr, h_col,
+                                              h_val, h_x, h_y, a);
+         case 8: return SellAddMultHost<8>(num_slices, h_perm, h_ptr, h_col,
+                                              h_val, h_x, h_y, a);
+      }
+   }
+   MFEM_ABORT("unsupported SELL slice size C = " << C);
+}
+
 void SparseMatrix::Mult(const Vector &x, Vector &y) const
 {
    if (Finalized()) { y.UseDevice(true); }
@@ -579,6 +713,12 @@ void SparseMatrix::AddMult(const Vector &x, Vector &y, const double a) const
       return;
    }
 
+   if (Sell)
+   {
+      Sell->AddMult(x, y, a);
+      return;
+   }
+
 #ifndef MFEM_USE_LEGACY_OPENMP
    const int height = this->height;
    const int nnz = J.Capacity();
@@ -682,6 +822,83 @@ void SparseMatrix::ResetTranspose() const
    At = NULL;
 }
 
+void SparseMatrix::BuildSELL(int C, int sigma) const
+{
+   MFEM_VERIFY(Finalized(), "Matrix must be finalized.");
+   MFEM_VERIFY(C == 4 || C == 8, "unsupported SELL slice size C = " << C);
+   MFEM_VERIFY(sigma > 0 && sigma % C == 0,
+               "sigma must be a positive multiple of C");
+   if (Sell) { return; }
+
+   const int *Ip = HostRead(I, height+1);
+   const int *Jp = HostRead(J, J.Capacity());
+   const double *Ap = HostRead(A, A.Capacity());
+
+   const int num_slices = (height + C - 1) / C;
+   const int num_rows = num_slices * C;
+
+   // Sort the rows by decreasing length within each window of sigma rows.
+   Array<int> order(num_rows);
+   for (int i = 0; i < height; i++) { order[i] = i; }
+   for (int i = height; i < num_rows; i++) { order[i] = -1; }
+   for (int w = 0; w < height; w += sigma)
+   {
+      std::stable_sort(order.GetData() + w,
+                       order.GetData() + std::min(w + sigma, height),
+                       [Ip](int r1, int r2)
+      { return Ip[r1+1] - Ip[r1] > Ip[r2+1] - Ip[r2]; });
+   }
+
+   Sell = new SellStorage;
+   Sell->C = C;
+   Sell->sigma = sigma;
+   Sell->num_slices = num_slices;
+   Sell->perm.New(num_rows);
+   Sell->slice_ptr.New(num_slices+1);
+   int *perm = Sell->perm, *slice_ptr = Sell->slice_ptr;
+   slice_ptr[0] = 0;
+   for (int s = 0; s < num_slices; s++)
+   {
+      int width = 0;
+      for (int k = 0; k < C; k++)
+      {
+         const int r = order[s*C+k];
+         perm[s*C+k] = r;
+         if (r >= 0) { width = std::max(width, Ip[r+1] - Ip[r]); }
+      }
+      slice_ptr[s+1] = slice_ptr[s] + width*C;
+   }
+
+   const int nnz = slice_ptr[num_slices];
+   Sell->col.New(nnz);
+   Sell->val.New(nnz);
+   int *col = Sell->col;
+   double *val = Sell->val;
+   for (int s = 0; s < num_slices; s++)
+   {
+      const int width = (slice_ptr[s+1] - slice_ptr[s]) / C;
+      for (int k = 0; k < C; k++)
+      {
+         const int r = perm[s*C+k];
+         const int row_size = (r >= 0) ? Ip[r+1] - Ip[r] : 0;
+         for (int j = 0; j < width; j++)
+         {
+            const int jk = slice_ptr[s] + j*C + k;
+            // Pad with zeros, using the column index 0 which is always valid
+            // when the slice is not empty.
+            col[jk] = (j < row_size) ? Jp[Ip[r]+j] : 0;
+            val[jk] = (j < row_size) ? Ap[Ip[r]+j] : 0.0;
+         }
+      }
+   }
+}
+
+void SparseMatrix::ResetSELL() const
+{
+   delete Sell;
+   Sell = NULL;
+}
+
 void SparseMatrix::PartMult(
    const Array<int> &rows, const Vector &x, Vector &y) const
 {
@@ -2938,6 +3155,7 @@ void SparseMatrix::Destroy()
    delete NodesMem;
 #endif
    delete At;
+   delete Sell;
 }
 
 int SparseMatrix::ActualWidth() const
@@ -3665,6 +3883,7 @@ void SparseMatrix::Swap(SparseMatrix &other)
    mfem::Swap(ColPtrJ, other.ColPtrJ);
    mfem::Swap(ColPtrNode, other.ColPtrNode);
    mfem::Swap(At, other.At);
+   mfem::Swap(Sell, other.Sell);
 
 #ifdef MFEM_USE_MEMALLOC
    mfem::Swap(NodesMem, other.NodesMem);
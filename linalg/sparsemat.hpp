@@ -69,6 +69,12 @@ protected:
    /// Transpose of A. Owned. Used to perform MultTranspose() on devices.
    mutable SparseMatrix *At;
 
+   /// SELL-C-sigma storage of the matrix, see BuildSELL().
+   struct SellStorage;
+
+   /// SELL-C-sigma copy of A. Owned. Used to perform Mult() and AddMult().
+   mutable SellStorage *Sell;
+
 #ifdef MFEM_USE_MEMALLOC
    typedef MemAlloc <RowNode, 1024> RowNodeAlloc;
    RowNodeAlloc * NodesMem;
@@ -302,6 +308,35 @@ public:
        more details. */
    void ResetTranspose() const;
 
+   /** @brief Build and store internally a copy of this matrix in the SELL-C-
+       sigma (sliced ELLPACK) format which will be used in the methods Mult()
+       and AddMult(). */
+   /** In this format, the rows are sorted by decreasing length within windows
+       of @a sigma consecutive rows and then grouped in slices of @a C rows.
+       Each slice is stored column by column and padded with zeros to the
+       length of its longest row, so the product is vectorized across the rows
+       of a slice, using the SIMD types from linalg/simd.hpp on the host, and
+       the slices are processed in parallel, using OpenMP on the host.
+
+       The supported values of @a C are 4 (e.g. AVX2) and 8 (e.g. AVX-512),
+       and @a sigma must be a multiple of @a C. Larger values of @a sigma
+       reduce the zero padding, while smaller values preserve the locality of
+       the row ordering.
+
+       Warning: any changes in this matrix will invalidate the internal copy.
+       To rebuild it, call ResetSELL() followed by a call to this method. If
+       the internal copy is already built, this method has no effect.
+
+       This method can only be used when the sparse matrix is finalized. */
+   void BuildSELL(int C = 4, int sigma = 256) const;
+
+   /** Reset (destroy) the internal SELL-C-sigma copy of the matrix. See
+       BuildSELL() for more details. */
+   void ResetSELL() const;
+
+   /// Return true if the internal SELL-C-sigma copy is built.
+   bool HasSELL() const { return Sell != NULL; }
+
    void PartMult(const Array<int> &rows, const Vector &x, Vector &y) const;
    void PartAddMult(const Array<int> &rows, const Vector &x, Vector &y,
                     const double a=1.0) const;
@@ -18,6 +18,7 @@
 #include "../general/text.hpp"
 #include "../general/device.hpp"
 #include "../general/tic_toc.hpp"
+#include "../general/profiler.hpp"
 #include "../general/gecko.hpp"
 #include "../fem/quadinterpolator.hpp"
 
@@ -1586,22 +1587,25 @@ static void HilbertSort3D(int coord1, bool dir1, bool dir2, bool dir3,
    }
 }
 
-void Mesh::GetHilbertElementOrdering(Array<int> &ordering)
+// Sort the element indices of @a mesh along the Hilbert curve through the
+// element centers.
+static void HilbertSortElements(Mesh &mesh, Array<int> &indices)
 {
+   const int spaceDim = mesh.SpaceDimension();
    MFEM_VERIFY(spaceDim <= 3, "");
 
    Vector min, max, center;
-   GetBoundingBox(min, max);
+   mesh.GetBoundingBox(min, max);
 
-   Array<int> indices(GetNE());
-   Array<double> points(3*GetNE());
+   indices.SetSize(mesh.GetNE());
+   Array<double> points(3*mesh.GetNE());
 
    if (spaceDim < 3) { points = 0.0; }
 
    // calculate element centers
-   for (int i = 0; i < GetNE(); i++)
+   for (int i = 0; i < mesh.GetNE(); i++)
    {
-      GetElementCenter(i, center);
+      mesh.GetElementCenter(i, center);
       for (int j = 0; j < spaceDim; j++)
       {
          points[3*i + j] = center(j);
@@ -1628,6 +1632,12 @@ void Mesh::GetHilbertElementOrdering(Array<int> &ordering)
                     points, indices.begin(), indices.end(),
                     min(0), min(1), min(2), max(0), max(1), max(2));
    }
+}
+
+void Mesh::GetHilbertElementOrdering(Array<int> &ordering)
+{
+   Array<int> indices;
+   HilbertSortElements(*this, indices);
 
    // return ordering in the format required by ReorderElements
    ordering.SetSize(GetNE());
@@ -3016,6 +3026,18 @@ Mesh::Mesh(const char *filename, int generate_edges, int refine,
    // Initialization as in the default constructor
    SetEmpty();
 
+   {
+      // Binary meshes are read directly from a memory mapping of the file.
+      mapped_ifstream imesh(filename);
+      const char magic[] = "MFEM binary mesh";
+      if (imesh && imesh.size() >= sizeof(magic)-1 &&
+          std::strncmp(imesh.data(), magic, sizeof(magic)-1) == 0)
+      {
+         Load(imesh, generate_edges, refine, fix_orientation);
+         return;
+      }
+   }
+
    named_ifgzstream imesh(filename);
    if (!imesh)
    {
@@ -3250,6 +3272,10 @@ void Mesh::Loader(std::istream &input, int generate_edges,
       }
       ReadMFEMMesh(input, mfem_v11, curved);
    }
+   else if (mesh_type == "MFEM binary mesh v1.0")
+   {
+      ReadMFEMBinaryMesh(input, curved);
+   }
    else if (mesh_type == "linemesh") // 1D mesh
    {
       ReadLineMesh(input);
@@ -5530,6 +5556,11 @@ int *Mesh::CartesianPartitioning(int nxyz[])
 
 int *Mesh::GeneratePartitioning(int nparts, int part_method)
 {
+   if (part_method == 6)
+   {
+      return GenerateHilbertPartitioning(nparts);
+   }
+
 #ifdef MFEM_USE_METIS
 
    int print_messages = 1;
@@ -5825,14 +5856,59 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
 
 #else
 
-   mfem_error("Mesh::GeneratePartitioning(...): "
-              "MFEM was compiled without Metis.");
-
-   return NULL;
+   // Without METIS, fall back to the space-filling curve partitioning
+   return GenerateHilbertPartitioning(nparts);
 
 #endif
 }
 
+int *Mesh::GenerateHilbertPartitioning(int nparts,
+                                       const Array<double> *weights)
+{
+   const int NE = GetNE();
+   MFEM_VERIFY(nparts > 0, "invalid number of parts: " << nparts);
+   MFEM_VERIFY(!weights || weights->Size() == NE, "invalid element weights");
+
+   int *partitioning = new int[NE];
+   if (NE <= nparts)
+   {
+      for (int i = 0; i < NE; i++) { partitioning[i] = i; }
+      return partitioning;
+   }
+
+   Array<int> indices;
+   HilbertSortElements(*this, indices);
+
+   double total = 0.0;
+   for (int i = 0; i < NE; i++)
+   {
+      const double w = weights ? (*weights)[i] : 1.0;
+      MFEM_VERIFY(w >= 0.0, "invalid element weight: " << w);
+      total += w;
+   }
+   if (total == 0.0) { total = 1.0; }
+
+   // Cut the curve into contiguous pieces of (approximately) equal weight: each
+   // element goes to the part containing the middle of its weight interval.
+   // The part index is advanced by at most one per element, and the remaining
+   // elements are always enough to fill the remaining parts, so that no part
+   // is empty.
+   double sum = 0.0;
+   int part = -1;
+   for (int k = 0; k < NE; k++)
+   {
+      const int i = indices[k];
+      const double w = weights ? (*weights)[i] : 1.0;
+      int p = (int) std::floor((sum + 0.5*w) * nparts / total);
+      p = std::max(part, std::min(part + 1, p));
+      p = std::min(p, nparts - 1);
+      p = std::max(p, nparts - (NE - k));
+      partitioning[i] = part = p;
+      sum += w;
+   }
+   return partitioning;
+}
+
 /* required: 0 <= partitioning[i] < num_part */
 void FindPartitioningComponents(Table &elem_elem,
                                 const Array<int> &partitioning,
@@ -7727,6 +7803,7 @@ static Array<int>& AllElements(Array<int> &list, int nelem)
 
 void Mesh::UniformRefinement(int ref_algo)
 {
+   MFEM_PERF_SCOPE("Mesh::UniformRefinement");
    Array<int> list;
 
    if (NURBSext)
@@ -7757,6 +7834,7 @@ void Mesh::UniformRefinement(int ref_algo)
 void Mesh::GeneralRefinement(const Array<Refinement> &refinements,
                              int nonconforming, int nc_limit)
 {
+   MFEM_PERF_SCOPE("Mesh::GeneralRefinement");
    if (ncmesh)
    {
       nonconforming = 1;
@@ -8581,6 +8659,70 @@ void Mesh::Printer(std::ostream &out, std::string section_delimiter) const
    }
 }
 
+// Write the geometry types, the attributes and the vertex indices of the
+// given elements, see ReadBinaryElements() in mesh_readers.cpp.
+static void PrintBinaryElements(const Array<Element *> &elems, int ne,
+                                std::ostream &out)
+{
+   Array<int> geom(ne), attr(ne), vert;
+   for (int i = 0; i < ne; i++)
+   {
+      geom[i] = elems[i]->GetGeometryType();
+      attr[i] = elems[i]->GetAttribute();
+      vert.Append(elems[i]->GetVertices(), elems[i]->GetNVertices());
+   }
+   out.write((const char *) geom.GetData(), ne*sizeof(int));
+   out.write((const char *) attr.GetData(), ne*sizeof(int));
+   out.write((const char *) vert.GetData(), vert.Size()*sizeof(int));
+}
+
+void Mesh::PrintBinary(std::ostream &out) const
+{
+   MFEM_VERIFY(NURBSext == NULL,
+               "the binary mesh format does not support NURBS meshes");
+
+   out << "MFEM binary mesh v1.0\n";
+   bin_io::write<int>(out, 1); // byte order check
+   bin_io::write<int>(out, Dim);
+   bin_io::write<int>(out, spaceDim);
+   bin_io::write<int>(out, NumOfElements);
+   bin_io::write<int>(out, NumOfBdrElements);
+   bin_io::write<int>(out, NumOfVertices);
+   bin_io::write<int>(out, Nodes ? 1 : 0);
+   bin_io::write<int>(out, ncmesh ? 1 : 0);
+
+   PrintBinaryElements(elements, NumOfElements, out);
+   PrintBinaryElements(boundary, NumOfBdrElements, out);
+
+   if (ncmesh)
+   {
+      ostringstream nc_out;
+      ncmesh->PrintVertexParents(nc_out);
+      ncmesh->PrintCoarseElements(nc_out);
+      const string text = nc_out.str();
+      bin_io::write<long long>(out, text.size());
+      out.write(text.c_str(), text.size());
+   }
+
+   if (Nodes == NULL)
+   {
+      Vector coord(NumOfVertices*spaceDim);
+      for (int j = 0; j < NumOfVertices; j++)
+      {
+         for (int i = 0; i < spaceDim; i++)
+         {
+            coord(j*spaceDim + i) = vertices[j](i);
+         }
+      }
+      out.write((const char *) coord.GetData(), coord.Size()*sizeof(double));
+   }
+   else
+   {
+      Nodes->SaveBinary(out);
+   }
+   out.flush();
+}
+
 void Mesh::PrintTopo(std::ostream &out,const Array<int> &e_to_k) const
 {
    int i;
@@ -9350,6 +9492,43 @@ void Mesh::GetElementColoring(Array<int> &colors, int el0)
    }
 }
 
+int Mesh::GetVertexElementColoring(Array<int> &colors)
+{
+   const int num_el = GetNE();
+   Table *vert_el = GetVertexToElementTable();
+   const int *i_vert_el = vert_el->GetI();
+   const int *j_vert_el = vert_el->GetJ();
+
+   colors.SetSize(num_el);
+   colors = -1;
+   // col_marker[c] == el means that color c is used by a neighbor of el
+   Array<int> col_marker, v;
+   int num_col = 0;
+   for (int el = 0; el < num_el; el++)
+   {
+      GetElementVertices(el, v);
+      for (int i = 0; i < v.Size(); i++)
+      {
+         for (int j = i_vert_el[v[i]]; j < i_vert_el[v[i]+1]; j++)
+         {
+            const int col = colors[j_vert_el[j]];
+            if (col >= 0) { col_marker[col] = el; }
+         }
+      }
+      int col = 0;
+      while (col < num_col && col_marker[col] == el) { col++; }
+      if (col == num_col)
+      {
+         col_marker.Append(-1);
+         num_col++;
+      }
+      colors[el] = col;
+   }
+
+   delete vert_el;
+   return num_col;
+}
+
 void Mesh::PrintWithPartitioning(int *partitioning, std::ostream &out,
                                  int elem_attr) const
 {
@@ -10329,100 +10508,9 @@ int Mesh::FindPoints(DenseMatrix &point_mat, Array<int>& elem_ids,
    elem_ids = -1;
    if (!GetNE()) { return 0; }
 
-   double *data = point_mat.GetData();
-   InverseElementTransformation *inv_tr = inv_trans;
-   inv_tr = inv_tr ? inv_tr : new InverseElementTransformation;
-
-   // For each point in 'point_mat', find the element whose center is closest.
-   Vector min_dist(npts);
-   Array<int> e_idx(npts);
-   min_dist = std::numeric_limits<double>::max();
-   e_idx = -1;
-
-   Vector pt(spaceDim);
-   for (int i = 0; i < GetNE(); i++)
-   {
-      GetElementTransformation(i)->Transform(
-         Geometries.GetCenter(GetElementBaseGeometry(i)), pt);
-      for (int k = 0; k < npts; k++)
-      {
-         double dist = pt.DistanceTo(data+k*spaceDim);
-         if (dist < min_dist(k))
-         {
-            min_dist(k) = dist;
-            e_idx[k] = i;
-         }
-      }
-   }
-
-   // Checks if the points lie in the closest element
-   int pts_found = 0;
-   pt.NewDataAndSize(NULL, spaceDim);
-   for (int k = 0; k < npts; k++)
-   {
-      pt.SetData(data+k*spaceDim);
-      inv_tr->SetTransformation(*GetElementTransformation(e_idx[k]));
-      int res = inv_tr->Transform(pt, ips[k]);
-      if (res == InverseElementTransformation::Inside)
-      {
-         elem_ids[k] = e_idx[k];
-         pts_found++;
-      }
-   }
-   if (pts_found != npts)
-   {
-      Array<int> vertices;
-      Table *vtoel = GetVertexToElementTable();
-      for (int k = 0; k < npts; k++)
-      {
-         if (elem_ids[k] != -1) { continue; }
-         // Try all vertex-neighbors of element e_idx[k]
-         pt.SetData(data+k*spaceDim);
-         GetElementVertices(e_idx[k], vertices);
-         for (int v = 0; v < vertices.Size(); v++)
-         {
-            int vv = vertices[v];
-            int ne = vtoel->RowSize(vv);
-            const int* els = vtoel->GetRow(vv);
-            for (int e = 0; e < ne; e++)
-            {
-               if (els[e] == e_idx[k]) { continue; }
-               inv_tr->SetTransformation(*GetElementTransformation(els[e]));
-               int res = inv_tr->Transform(pt, ips[k]);
-               if (res == InverseElementTransformation::Inside)
-               {
-                  elem_ids[k] = els[e];
-                  pts_found++;
-                  goto next_point;
-               }
-            }
-         }
-         // Try neighbors for non-conforming meshes
-         if (ncmesh)
-         {
-            Array<int> neigh;
-            int le = ncmesh->leaf_elements[e_idx[k]];
-            ncmesh->FindNeighbors(le,neigh);
-            for (int e = 0; e < neigh.Size(); e++)
-            {
-               int nn = neigh[e];
-               if (ncmesh->IsGhost(ncmesh->elements[nn])) { continue; }
-               int el = ncmesh->elements[nn].index;
-               inv_tr->SetTransformation(*GetElementTransformation(el));
-               int res = inv_tr->Transform(pt, ips[k]);
-               if (res == InverseElementTransformation::Inside)
-               {
-                  elem_ids[k] = el;
-                  pts_found++;
-                  goto next_point;
-               }
-            }
-         }
-      next_point: ;
-      }
-      delete vtoel;
-   }
-   if (inv_trans == NULL) { delete inv_tr; }
+   PointLocator locator(*this);
+   const int pts_found = locator.FindPoints(point_mat, elem_ids, ips,
+                                            inv_trans);
 
    if (warn && pts_found != npts)
    {
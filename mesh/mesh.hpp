@@ -57,6 +57,7 @@ class Mesh
 #endif
    friend class NCMesh;
    friend class NURBSExtension;
+   friend class MeshPartitioner;
 
 #ifdef MFEM_USE_ADIOS2
    friend class adios2stream;
@@ -227,6 +228,7 @@ protected:
    // Readers for different mesh formats, used in the Load() method.
    // The implementations of these methods are in mesh_readers.cpp.
    void ReadMFEMMesh(std::istream &input, bool mfem_v11, int &curved);
+   void ReadMFEMBinaryMesh(std::istream &input, int &curved);
    void ReadLineMesh(std::istream &input);
    void ReadNetgen2DMesh(std::istream &input, int &curved);
    void ReadNetgen3DMesh(std::istream &input);
@@ -1046,7 +1048,30 @@ public:
    virtual void ReorientTetMesh();
 
    int *CartesianPartitioning(int nxyz[]);
+
+   /** @brief Partition the elements of the mesh into @a nparts parts and
+       return the part of each element in a new array, owned by the caller. */
+   /** The values of @a part_method are:
+       - 0, 1, 2: METIS_PartGraphRecursive, METIS_PartGraphKway and
+         METIS_PartGraphVKway, with sorted neighbor lists,
+       - 3, 4, 5: the same METIS methods, with unsorted neighbor lists,
+       - 6: space-filling curve partitioning, see
+         GenerateHilbertPartitioning().
+
+       When MFEM is compiled without METIS, the space-filling curve
+       partitioning is used for all values of @a part_method. */
    int *GeneratePartitioning(int nparts, int part_method = 1);
+
+   /** @brief Partition the elements of the mesh into @a nparts parts by
+       cutting the Hilbert curve through the element centers into contiguous
+       pieces of equal total weight. */
+   /** This method does not require METIS and runs in O(NE log NE) time. The
+       optional @a weights, one per element, can account for e.g. the
+       polynomial order or the refinement level of the elements; by default
+       all elements have the same weight. No part is empty when NE >= @a nparts.
+       The returned array is owned by the caller. */
+   int *GenerateHilbertPartitioning(int nparts,
+                                    const Array<double> *weights = NULL);
    void CheckPartitioning(int *partitioning);
 
    void CheckDisplacements(const Vector &displacements, double &tmax);
@@ -1202,6 +1227,19 @@ public:
    /// \see mfem::ofgzstream() for on-the-fly compression of ascii outputs
    virtual void Print(std::ostream &out = mfem::out) const { Printer(out); }
 
+   /** @brief Print the mesh to the given stream using the MFEM binary mesh
+       format. */
+   /** The binary format stores the same data as the MFEM mesh format v1.0 and
+       v1.1, including the refinement hierarchy of non-conforming meshes and
+       the mesh nodes (see GridFunction::SaveBinary()), but with the element
+       connectivity, the attributes and the coordinates written as raw arrays,
+       so that they can be loaded without parsing. Meshes in this format are
+       recognized by Load() and by the Mesh constructors. The Mesh constructor
+       taking a file name reads binary meshes through a memory mapping of the
+       file, see mapped_ifstream. NURBS meshes are not supported. The data is
+       written in the native byte order. */
+   void PrintBinary(std::ostream &out) const;
+
    /// Print the mesh to the given stream using the adios2 bp format
 #ifdef MFEM_USE_ADIOS2
    virtual void Print(adios2stream &out) const;
@@ -1230,6 +1268,15 @@ public:
 
    void GetElementColoring(Array<int> &colors, int el0 = 0);
 
+   /** @brief Greedy coloring of the elements such that no two elements that
+       share a vertex have the same color. Returns the number of colors.
+
+       Unlike GetElementColoring(), which only separates face neighbors, two
+       elements of the same color do not share any degree of freedom of a finite
+       element space on this mesh. Hence, the contributions of the elements of
+       one color can be assembled concurrently without write conflicts. */
+   int GetVertexElementColoring(Array<int> &colors);
+
    /** @brief Prints the mesh with boundary elements given by the boundary of
        the subdomains, so that the boundary of subdomain i has boundary
        attribute i+1. */
@@ -1318,6 +1365,10 @@ public:
 
        If no element is found for the i-th point, elem_ids[i] is set to -1.
 
+       The candidate elements are found with a temporary PointLocator; when
+       points are located repeatedly in the same mesh, it is more efficient to
+       create a PointLocator once and to use PointLocator::FindPoints().
+
        In the ParMesh implementation, the @a point_mat is expected to be the
        same on all ranks. If the i-th point is found by multiple ranks, only one
        of them will mark that point as found, i.e. set its elem_ids[i] to a
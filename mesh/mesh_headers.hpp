@@ -25,6 +25,8 @@
 #include "ncmesh.hpp"
 #include "mesh.hpp"
 #include "mesh_operators.hpp"
+#include "mesh_partitioner.hpp"
+#include "point_locator.hpp"
 #include "nurbs.hpp"
 #include "wedge.hpp"
 
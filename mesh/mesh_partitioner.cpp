@@ -0,0 +1,352 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mesh_partitioner.hpp"
+#include "mesh_headers.hpp"
+#include "../fem/fem.hpp"
+#include "../general/sort_pairs.hpp"
+
+namespace mfem
+{
+
+MeshPartitioner::MeshPartitioner(Mesh &mesh_, int num_parts_,
+                                 const int *partitioning_, int part_method)
+   : mesh(mesh_), num_parts(num_parts_), vert_element(NULL),
+     edge_element(NULL)
+{
+   const int dim = mesh.Dimension();
+   MFEM_VERIFY(mesh.Conforming() && !mesh.NURBSext,
+               "non-conforming and NURBS meshes are not supported");
+   MFEM_VERIFY(dim == 1 || mesh.GetNE() == 0 || mesh.GetNEdges() > 0,
+               "the mesh edges must be generated");
+
+   partitioning.SetSize(mesh.GetNE());
+   if (partitioning_)
+   {
+      for (int i = 0; i < mesh.GetNE(); i++)
+      {
+         partitioning[i] = partitioning_[i];
+      }
+   }
+   else
+   {
+      int *part = mesh.GeneratePartitioning(num_parts, part_method);
+      for (int i = 0; i < mesh.GetNE(); i++) { partitioning[i] = part[i]; }
+      delete [] part;
+   }
+   MFEM_VERIFY(mesh.GetNE() == 0 ||
+               (partitioning.Min() >= 0 && partitioning.Max() < num_parts),
+               "invalid partitioning");
+   Transpose(partitioning, part_element, num_parts);
+
+   vert_element = mesh.GetVertexToElementTable();
+   if (dim >= 2)
+   {
+      edge_element = new Table;
+      Transpose(mesh.ElementToEdgeTable(), *edge_element, mesh.GetNEdges());
+   }
+
+   // Assign the boundary elements to the parts, as in ParMesh
+   Array<int> bdr_partitioning(mesh.GetNBE());
+   for (int i = 0; i < mesh.GetNBE(); i++)
+   {
+      int el1, el2;
+      if (dim == 3)
+      {
+         int face, o;
+         mesh.GetBdrElementFace(i, &face, &o);
+         mesh.GetFaceElements(face, &el1, &el2);
+         if (o % 2 != 0 && el2 >= 0) { el1 = el2; }
+      }
+      else if (dim == 2)
+      {
+         el1 = edge_element->GetRow(mesh.GetBdrElementEdgeIndex(i))[0];
+      }
+      else
+      {
+         const int vert = mesh.GetBdrElement(i)->GetVertices()[0];
+         mesh.GetFaceElements(vert, &el1, &el2);
+      }
+      bdr_partitioning[i] = partitioning[el1];
+   }
+   Transpose(bdr_partitioning, part_bdr_element, num_parts);
+
+   vert_global_local.SetSize(mesh.GetNV());
+   vert_global_local = -1;
+}
+
+void MeshPartitioner::GetGroup(const int *elems, int n,
+                               IntegerSet &group) const
+{
+   Array<int> &parts = group;
+   parts.SetSize(n);
+   for (int i = 0; i < n; i++) { parts[i] = partitioning[elems[i]]; }
+   parts.Sort();
+   parts.Unique();
+}
+
+// Build the Table @a group_ent from the pairs (group, entity) in @a ent_group.
+static void MakeGroupTable(int ngroups, const Array<Pair<int, int> > &ent_group,
+                           Table &group_ent)
+{
+   group_ent.MakeI(ngroups);
+   for (int i = 0; i < ent_group.Size(); i++)
+   {
+      group_ent.AddAColumnInRow(ent_group[i].one);
+   }
+   group_ent.MakeJ();
+   for (int i = 0; i < ent_group.Size(); i++)
+   {
+      group_ent.AddConnection(ent_group[i].one, ent_group[i].two);
+   }
+   group_ent.ShiftUpI();
+}
+
+void MeshPartitioner::PrintPart(int part, std::ostream &out) const
+{
+   MFEM_VERIFY(0 <= part && part < num_parts, "invalid part: " << part);
+   const int dim = mesh.Dimension();
+   const int ne = part_element.RowSize(part);
+   const int *elems = part_element.GetRow(part);
+   const int nbe = part_bdr_element.RowSize(part);
+   const int *bdr_elems = part_bdr_element.GetRow(part);
+
+   // The local vertices, numbered in the global order
+   Array<int> vert_local_global, v;
+   for (int i = 0; i < ne; i++)
+   {
+      mesh.GetElementVertices(elems[i], v);
+      for (int j = 0; j < v.Size(); j++)
+      {
+         if (vert_global_local[v[j]] < 0)
+         {
+            vert_global_local[v[j]] = 0;
+            vert_local_global.Append(v[j]);
+         }
+      }
+   }
+   vert_local_global.Sort();
+   for (int i = 0; i < vert_local_global.Size(); i++)
+   {
+      vert_global_local[vert_local_global[i]] = i;
+   }
+
+   // The serial part of the mesh
+   {
+      Mesh part_mesh(dim, vert_local_global.Size(), ne, nbe,
+                     mesh.SpaceDimension());
+      for (int i = 0; i < vert_local_global.Size(); i++)
+      {
+         part_mesh.AddVertex(mesh.GetVertex(vert_local_global[i]));
+      }
+      for (int i = 0; i < ne; i++)
+      {
+         Element *el = mesh.GetElement(elems[i])->Duplicate(&part_mesh);
+         int *ev = el->GetVertices();
+         for (int j = 0; j < el->GetNVertices(); j++)
+         {
+            ev[j] = vert_global_local[ev[j]];
+         }
+         part_mesh.AddElement(el);
+      }
+      for (int i = 0; i < nbe; i++)
+      {
+         Element *el = mesh.GetBdrElement(bdr_elems[i])->Duplicate(&part_mesh);
+         int *ev = el->GetVertices();
+         for (int j = 0; j < el->GetNVertices(); j++)
+         {
+            ev[j] = vert_global_local[ev[j]];
+         }
+         part_mesh.AddBdrElement(el);
+      }
+
+      const GridFunction *nodes = mesh.GetNodes();
+      if (nodes) // curved mesh
+      {
+         part_mesh.FinalizeTopology(false);
+         const FiniteElementSpace *fes = nodes->FESpace();
+         FiniteElementCollection *fec =
+            FiniteElementCollection::New(fes->FEColl()->Name());
+         FiniteElementSpace *part_fes =
+            new FiniteElementSpace(&part_mesh, fec, fes->GetVDim(),
+                                   fes->GetOrdering());
+         GridFunction *part_nodes = new GridFunction(part_fes);
+         part_nodes->MakeOwner(fec); // part_nodes will own fec and part_fes
+         part_mesh.NewNodes(*part_nodes, true);
+
+         Array<int> gvdofs, lvdofs;
+         Vector lnodes;
+         for (int i = 0; i < ne; i++)
+         {
+            part_fes->GetElementVDofs(i, lvdofs);
+            fes->GetElementVDofs(elems[i], gvdofs);
+            nodes->GetSubVector(gvdofs, lnodes);
+            part_nodes->SetSubVector(lvdofs, lnodes);
+         }
+      }
+
+      part_mesh.Printer(out, "mfem_serial_mesh_end");
+   }
+
+   // The communication groups of the shared entities: the first group is the
+   // local one. The entities are visited in the order of their global indices.
+   ListOfIntegerSets groups;
+   IntegerSet group;
+   group.Recreate(1, &part);
+   groups.Insert(group);
+
+   Array<Pair<int, int> > sface_group, sedge_group, svert_group;
+   if (dim == 3)
+   {
+      Array<int> faces, ori;
+      for (int i = 0; i < ne; i++)
+      {
+         mesh.GetElementFaces(elems[i], faces, ori);
+         for (int j = 0; j < faces.Size(); j++)
+         {
+            int el[2];
+            mesh.GetFaceElements(faces[j], &el[0], &el[1]);
+            if (el[1] >= 0 && partitioning[el[0]] != partitioning[el[1]])
+            {
+               GetGroup(el, 2, group);
+               sface_group.Append(Pair<int, int>(faces[j],
+                                                 groups.Insert(group)));
+            }
+         }
+      }
+      // each shared face is in exactly one local element
+      SortPairs<int, int>(sface_group, sface_group.Size());
+   }
+   if (dim >= 2)
+   {
+      Array<int> edges, ori, all_edges;
+      for (int i = 0; i < ne; i++)
+      {
+         mesh.GetElementEdges(elems[i], edges, ori);
+         all_edges.Append(edges);
+      }
+      all_edges.Sort();
+      all_edges.Unique();
+      for (int i = 0; i < all_edges.Size(); i++)
+      {
+         const int edge = all_edges[i];
+         GetGroup(edge_element->GetRow(edge), edge_element->RowSize(edge),
+                  group);
+         if (group.Size() > 1)
+         {
+            sedge_group.Append(Pair<int, int>(groups.Insert(group), edge));
+         }
+      }
+   }
+   for (int i = 0; i < vert_local_global.Size(); i++)
+   {
+      const int vert = vert_local_global[i];
+      GetGroup(vert_element->GetRow(vert), vert_element->RowSize(vert), group);
+      if (group.Size() > 1)
+      {
+         svert_group.Append(Pair<int, int>(groups.Insert(group), i));
+      }
+   }
+
+   // The Pairs above are (entity, group) for the faces, and (group, entity)
+   // for the edges and the vertices
+   for (int i = 0; i < sface_group.Size(); i++)
+   {
+      Swap(sface_group[i].one, sface_group[i].two);
+   }
+   const int ngroups = groups.Size();
+   Table group_sface, group_sedge, group_svert;
+   MakeGroupTable(ngroups, sface_group, group_sface);
+   MakeGroupTable(ngroups, sedge_group, group_sedge);
+   MakeGroupTable(ngroups, svert_group, group_svert);
+
+   // Write the group topology, as in GroupTopology::Save()
+   Table group_part;
+   groups.AsTable(group_part);
+   out << "\ncommunication_groups\n";
+   out << "number_of_groups " << ngroups << "\n\n";
+   out << "# number of entities in each group, followed by group ids in group\n";
+   for (int gr = 0; gr < ngroups; gr++)
+   {
+      out << group_part.RowSize(gr);
+      for (int j = 0; j < group_part.RowSize(gr); j++)
+      {
+         out << ' ' << group_part.GetRow(gr)[j];
+      }
+      out << '\n';
+   }
+
+   // Write the shared entities, as in ParMesh::ParPrint()
+   out << "\ntotal_shared_vertices " << svert_group.Size() << '\n';
+   if (dim >= 2)
+   {
+      out << "total_shared_edges " << sedge_group.Size() << '\n';
+   }
+   if (dim >= 3)
+   {
+      out << "total_shared_faces " << sface_group.Size() << '\n';
+   }
+   for (int gr = 1; gr < ngroups; gr++)
+   {
+      {
+         const int  nv = group_svert.RowSize(gr);
+         const int *sv = group_svert.GetRow(gr);
+         out << "\n# group " << gr << "\nshared_vertices " << nv << '\n';
+         for (int i = 0; i < nv; i++)
+         {
+            out << sv[i] << '\n';
+         }
+      }
+      if (dim >= 2)
+      {
+         const int  nse = group_sedge.RowSize(gr);
+         const int *se = group_sedge.GetRow(gr);
+         out << "\nshared_edges " << nse << '\n';
+         for (int i = 0; i < nse; i++)
+         {
+            mesh.GetEdgeVertices(se[i], v);
+            out << vert_global_local[v[0]] << ' '
+                << vert_global_local[v[1]] << '\n';
+         }
+      }
+      if (dim >= 3)
+      {
+         const int  nf = group_sface.RowSize(gr);
+         const int *sf = group_sface.GetRow(gr);
+         out << "\nshared_faces " << nf << '\n';
+         for (int i = 0; i < nf; i++)
+         {
+            out << mesh.GetFaceGeometryType(sf[i]);
+            mesh.GetFaceVertices(sf[i], v);
+            for (int j = 0; j < v.Size(); j++)
+            {
+               out << ' ' << vert_global_local[v[j]];
+            }
+            out << '\n';
+         }
+      }
+   }
+   out << "\nmfem_mesh_end" << std::endl;
+
+   // Reset the work array
+   for (int i = 0; i < vert_local_global.Size(); i++)
+   {
+      vert_global_local[vert_local_global[i]] = -1;
+   }
+}
+
+MeshPartitioner::~MeshPartitioner()
+{
+   delete edge_element;
+   delete vert_element;
+}
+
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_MESH_PARTITIONER
+#define MFEM_MESH_PARTITIONER
+
+#include "../config/config.hpp"
+#include "../general/table.hpp"
+#include "../general/sets.hpp"
+#include "mesh.hpp"
+#include <iostream>
+
+namespace mfem
+{
+
+/** @brief Class for extracting the parts of a partitioned serial Mesh, one at a
+    time, without constructing a ParMesh.
+
+    Each part is written in the parallel mesh format of ParMesh::ParPrint(),
+    i.e. it can be loaded on the rank with the same index with the constructor
+    ParMesh::ParMesh(MPI_Comm, std::istream &, bool). The parts are identical to
+    the ones created by ParMesh::ParMesh(MPI_Comm, Mesh &, int *, int), however
+    only the process holding the serial mesh needs to create them, see
+    ParMesh::Distribute().
+
+    The shared vertices, edges and faces of each communication group are listed
+    in the order of their global indices, so that all the parts in a group list
+    them consistently. Non-conforming and NURBS meshes are not supported. */
+class MeshPartitioner
+{
+protected:
+   Mesh &mesh;
+   int num_parts;
+   Array<int> partitioning;
+
+   /// The elements and the boundary elements of each part
+   Table part_element, part_bdr_element;
+
+   /// The elements containing each vertex and each edge (2D and 3D)
+   Table *vert_element, *edge_element;
+
+   /// Work array: global to local vertex map of the current part, or -1
+   mutable Array<int> vert_global_local;
+
+   /// Returns in @a group the parts of the @a n elements in @a elems
+   void GetGroup(const int *elems, int n, IntegerSet &group) const;
+
+public:
+   /** @brief Partition @a mesh into @a num_parts parts, given by the array
+       @a partitioning_, if not NULL, or by Mesh::GeneratePartitioning() with
+       @a part_method otherwise. */
+   /** The mesh must be conforming, with generated edges in 2D and 3D, and
+       must not be modified while the MeshPartitioner is used. */
+   MeshPartitioner(Mesh &mesh_, int num_parts_,
+                   const int *partitioning_ = NULL, int part_method = 1);
+
+   /// Returns the number of parts
+   int GetNParts() const { return num_parts; }
+
+   /// Returns the part of each element of the mesh
+   const Array<int> &GetPartitioning() const { return partitioning; }
+
+   /// Returns the number of elements in the part @a part
+   int GetPartNE(int part) const { return part_element.RowSize(part); }
+
+   /// Returns the number of boundary elements in the part @a part
+   int GetPartNBE(int part) const { return part_bdr_element.RowSize(part); }
+
+   /** @brief Write the part @a part to @a out, in the format of
+       ParMesh::ParPrint(). */
+   void PrintPart(int part, std::ostream &out) const;
+
+   ~MeshPartitioner();
+};
+
+}
+
+#endif
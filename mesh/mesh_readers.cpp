@@ -12,8 +12,10 @@
 #include "mesh_headers.hpp"
 #include "../fem/fem.hpp"
 #include "../general/text.hpp"
+#include "../general/binaryio.hpp"
 
 #include <iostream>
+#include <sstream>
 #include <cstdio>
 
 #ifdef MFEM_USE_NETCDF
@@ -113,6 +115,103 @@ void Mesh::ReadMFEMMesh(std::istream &input, bool mfem_v11, int &curved)
    if (remove_unused_vertices) { RemoveUnusedVertices(); }
 }
 
+// Read the geometry types, the attributes and the vertex indices of 'ne'
+// elements written by Mesh::PrintBinary().
+static void ReadBinaryElements(std::istream &input, int ne, Array<int> &geom,
+                               Array<int> &attr, Array<int> &vert)
+{
+   geom.SetSize(ne);
+   attr.SetSize(ne);
+   input.read((char *) geom.GetData(), ne*sizeof(int));
+   input.read((char *) attr.GetData(), ne*sizeof(int));
+   MFEM_VERIFY(input, "invalid binary mesh");
+   int nv = 0;
+   for (int i = 0; i < ne; i++)
+   {
+      MFEM_VERIFY(geom[i] >= 0 && geom[i] < Geometry::NumGeom,
+                  "invalid element geometry: " << geom[i]);
+      nv += Geometry::NumVerts[geom[i]];
+   }
+   vert.SetSize(nv);
+   input.read((char *) vert.GetData(), nv*sizeof(int));
+   MFEM_VERIFY(input, "invalid binary mesh");
+}
+
+void Mesh::ReadMFEMBinaryMesh(std::istream &input, int &curved)
+{
+   // Read MFEM binary mesh v1.0 format, see Mesh::PrintBinary()
+   MFEM_VERIFY(bin_io::read<int>(input) == 1,
+               "invalid binary mesh or byte order mismatch");
+   Dim = bin_io::read<int>(input);
+   spaceDim = bin_io::read<int>(input);
+   NumOfElements = bin_io::read<int>(input);
+   NumOfBdrElements = bin_io::read<int>(input);
+   NumOfVertices = bin_io::read<int>(input);
+   const int has_nodes = bin_io::read<int>(input);
+   const int has_ncmesh = bin_io::read<int>(input);
+   MFEM_VERIFY(input, "invalid binary mesh");
+
+   Array<int> geom, attr, vert;
+   ReadBinaryElements(input, NumOfElements, geom, attr, vert);
+   elements.SetSize(NumOfElements);
+   for (int j = 0, k = 0; j < NumOfElements; j++)
+   {
+      elements[j] = NewElement(geom[j]);
+      elements[j]->SetVertices(&vert[k]);
+      elements[j]->SetAttribute(attr[j]);
+      k += elements[j]->GetNVertices();
+   }
+
+   ReadBinaryElements(input, NumOfBdrElements, geom, attr, vert);
+   boundary.SetSize(NumOfBdrElements);
+   for (int j = 0, k = 0; j < NumOfBdrElements; j++)
+   {
+      boundary[j] = NewElement(geom[j]);
+      boundary[j]->SetVertices(&vert[k]);
+      boundary[j]->SetAttribute(attr[j]);
+      k += boundary[j]->GetNVertices();
+   }
+
+   if (has_ncmesh)
+   {
+      // The refinement hierarchy is stored in the text format of the sections
+      // 'vertex_parents' and 'coarse_elements' of the MFEM mesh v1.1 format.
+      const long long len = bin_io::read<long long>(input);
+      MFEM_VERIFY(input && len >= 0, "invalid binary mesh");
+      string text(len, '\0');
+      if (len > 0) { input.read(&text[0], len); }
+      MFEM_VERIFY(input, "invalid binary mesh");
+      istringstream nc_input(text);
+      ncmesh = new NCMesh(this, &nc_input);
+      ncmesh->LoadCoarseElements(nc_input);
+   }
+
+   vertices.SetSize(NumOfVertices);
+   if (!has_nodes)
+   {
+      Vector coord(NumOfVertices*spaceDim);
+      input.read((char *) coord.GetData(), coord.Size()*sizeof(double));
+      MFEM_VERIFY(input, "invalid binary mesh");
+      for (int j = 0; j < NumOfVertices; j++)
+      {
+         for (int i = 0; i < spaceDim; i++)
+         {
+            vertices[j](i) = coord(j*spaceDim + i);
+         }
+      }
+
+      // initialize vertex positions in NCMesh
+      if (ncmesh) { ncmesh->SetVertexPositions(vertices); }
+   }
+   else
+   {
+      // the nodes follow, see GridFunction::SaveBinary()
+      curved = 1;
+   }
+
+   if (remove_unused_vertices) { RemoveUnusedVertices(); }
+}
+
 void Mesh::ReadLineMesh(std::istream &input)
 {
    int j,p1,p2,a;
@@ -12,6 +12,7 @@
 #include "mesh_headers.hpp"
 #include "../fem/fem.hpp"
 #include "../general/sort_pairs.hpp"
+#include "../general/profiler.hpp"
 
 #include <string>
 #include <cmath>
@@ -1491,6 +1492,7 @@ void NCMesh::RefineElement(int elem, char ref_type)
 
 void NCMesh::Refine(const Array<Refinement>& refinements)
 {
+   MFEM_PERF_SCOPE("NCMesh::Refine");
    // push all refinements on the stack in reverse order
    ref_stack.Reserve(refinements.Size());
    for (int i = refinements.Size()-1; i >= 0; i--)
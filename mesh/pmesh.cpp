@@ -22,6 +22,8 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <limits>
 
 using namespace std;
 
@@ -1057,6 +1059,65 @@ ParMesh::ParMesh(MPI_Comm comm, istream &input, bool refine)
    // TODO: AMR meshes, NURBS meshes?
 }
 
+ParMesh *ParMesh::Distribute(MPI_Comm comm, Mesh *mesh, int root,
+                             const int *partitioning_, int part_method,
+                             bool refine)
+{
+   int nranks, myrank;
+   MPI_Comm_size(comm, &nranks);
+   MPI_Comm_rank(comm, &myrank);
+
+   const int tag = 827;
+   string part_str;
+   if (myrank == root)
+   {
+      MFEM_VERIFY(mesh, "the serial mesh must be given on the root rank");
+      MeshPartitioner partitioner(*mesh, nranks, partitioning_, part_method);
+      for (int r = 0; r < nranks; r++)
+      {
+         ostringstream part_out;
+         part_out.precision(17); // the vertices must be sent exactly
+         partitioner.PrintPart(r, part_out);
+         if (r == root) { part_str = part_out.str(); continue; }
+
+         const string str = part_out.str();
+         MFEM_VERIFY(str.size() <= (size_t)std::numeric_limits<int>::max(),
+                     "the mesh part " << r << " is too large");
+         int size = (int)str.size();
+         MPI_Send(&size, 1, MPI_INT, r, tag, comm);
+         MPI_Send(const_cast<char*>(str.data()), size, MPI_CHAR, r, tag, comm);
+      }
+   }
+   else
+   {
+      int size;
+      MPI_Recv(&size, 1, MPI_INT, root, tag, comm, MPI_STATUS_IGNORE);
+      part_str.resize(size);
+      MPI_Recv(&part_str[0], size, MPI_CHAR, root, tag, comm,
+               MPI_STATUS_IGNORE);
+   }
+
+   istringstream part_in(part_str);
+   string().swap(part_str);
+   ParMesh *pmesh = new ParMesh(comm, part_in, refine);
+
+   // Convert the Nodes to a ParGridFunction, as in ParMesh(MPI_Comm, Mesh &)
+   if (pmesh->Nodes)
+   {
+      const FiniteElementSpace *fes = pmesh->Nodes->FESpace();
+      FiniteElementCollection *nfec =
+         FiniteElementCollection::New(fes->FEColl()->Name());
+      ParFiniteElementSpace *pfes =
+         new ParFiniteElementSpace(pmesh, nfec, fes->GetVDim(),
+                                   fes->GetOrdering());
+      ParGridFunction *pnodes = new ParGridFunction(pfes);
+      pnodes->MakeOwner(nfec); // pnodes will own nfec and pfes
+      *pnodes = *pmesh->Nodes;
+      pmesh->NewNodes(*pnodes, true);
+   }
+   return pmesh;
+}
+
 ParMesh::ParMesh(ParMesh *orig_mesh, int ref_factor, int ref_type)
    : Mesh(orig_mesh, ref_factor, ref_type),
      MyComm(orig_mesh->GetComm()),
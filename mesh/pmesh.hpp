@@ -210,6 +210,19 @@ public:
    /** The @a refine parameter is passed to the method Mesh::Finalize(). */
    ParMesh(MPI_Comm comm, std::istream &input, bool refine = true);
 
+   /** @brief Create a parallel mesh from the serial @a mesh, which is only
+       needed on the rank @a root of @a comm. */
+   /** Unlike ParMesh(MPI_Comm, Mesh &, int *, int), the serial mesh is not
+       replicated on all ranks: the rank @a root partitions it and extracts the
+       parts, one at a time, with a MeshPartitioner, and sends each of them to
+       its rank. The other ranks only store their own part and its shared
+       entities. The arguments @a partitioning_ and @a part_method are used on
+       @a root, see MeshPartitioner, and @a refine is passed to the method
+       Mesh::Finalize(). The returned ParMesh is owned by the caller. */
+   static ParMesh *Distribute(MPI_Comm comm, Mesh *mesh, int root = 0,
+                              const int *partitioning_ = NULL,
+                              int part_method = 1, bool refine = true);
+
    /// Create a uniformly refined (by any factor) version of @a orig_mesh.
    /** @param[in] orig_mesh  The starting coarse mesh.
        @param[in] ref_factor The refinement factor, an integer > 1.
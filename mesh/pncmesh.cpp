@@ -16,6 +16,7 @@
 #include "mesh_headers.hpp"
 #include "pncmesh.hpp"
 #include "../general/binaryio.hpp"
+#include "../general/profiler.hpp"
 
 #include <map>
 #include <climits> // INT_MIN, INT_MAX
@@ -1379,6 +1380,7 @@ void ParNCMesh::Prune()
 
 void ParNCMesh::Refine(const Array<Refinement> &refinements)
 {
+   MFEM_PERF_SCOPE("ParNCMesh::Refine");
    if (NRanks == 1)
    {
       NCMesh::Refine(refinements);
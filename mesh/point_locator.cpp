@@ -0,0 +1,290 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "point_locator.hpp"
+#include "mesh_headers.hpp"
+#include "../fem/fem.hpp"
+#include "../general/sort_pairs.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace mfem
+{
+
+// Check if the point @a x is in the box @a box (lower and upper corners).
+static inline bool InBox(const double *box, const double *x, const int sdim)
+{
+   for (int d = 0; d < sdim; d++)
+   {
+      if (x[d] < box[d] || x[d] > box[sdim+d]) { return false; }
+   }
+   return true;
+}
+
+PointLocator::PointLocator(Mesh &mesh_, double bb_tol_, int leaf_size_)
+   : mesh(mesh_), sdim(0), bb_tol(bb_tol_), leaf_size(leaf_size_)
+{
+   MFEM_VERIFY(leaf_size > 0, "invalid leaf size: " << leaf_size);
+   Update();
+}
+
+void PointLocator::ComputeElementBox(int e, Vector &vals, Array<int> &vdofs)
+{
+   double *box = &elem_box[2*sdim*e];
+   for (int d = 0; d < sdim; d++)
+   {
+      box[d] = std::numeric_limits<double>::max();
+      box[sdim+d] = -std::numeric_limits<double>::max();
+   }
+
+   const GridFunction *nodes = mesh.GetNodes();
+   if (nodes)
+   {
+      // The element vdofs are ordered by components
+      nodes->FESpace()->GetElementVDofs(e, vdofs);
+      nodes->GetSubVector(vdofs, vals);
+      const int nd = vdofs.Size() / sdim;
+      for (int d = 0; d < sdim; d++)
+      {
+         for (int j = 0; j < nd; j++)
+         {
+            box[d] = std::min(box[d], vals(j + nd*d));
+            box[sdim+d] = std::max(box[sdim+d], vals(j + nd*d));
+         }
+      }
+   }
+   else
+   {
+      mesh.GetElementVertices(e, vdofs);
+      for (int j = 0; j < vdofs.Size(); j++)
+      {
+         const double *v = mesh.GetVertex(vdofs[j]);
+         for (int d = 0; d < sdim; d++)
+         {
+            box[d] = std::min(box[d], v[d]);
+            box[sdim+d] = std::max(box[sdim+d], v[d]);
+         }
+      }
+   }
+
+   double size = 0.0;
+   for (int d = 0; d < sdim; d++)
+   {
+      size = std::max(size, box[sdim+d] - box[d]);
+   }
+   for (int d = 0; d < sdim; d++)
+   {
+      box[d] -= bb_tol*size;
+      box[sdim+d] += bb_tol*size;
+   }
+}
+
+int PointLocator::AddNode(int begin, int end)
+{
+   node_box.SetSize(node_box.Size() + 2*sdim);
+   node_begin.Append(begin);
+   node_end.Append(end);
+   return node_child.Append(-1) - 1;
+}
+
+void PointLocator::BuildNode(int node)
+{
+   const int begin = node_begin[node], end = node_end[node];
+   const double *eb = elem_box.GetData();
+   const int sd = sdim;
+   double *box = &node_box[2*sd*node];
+   double cmin[3], cmax[3];
+   for (int d = 0; d < sd; d++)
+   {
+      box[d] = cmin[d] = std::numeric_limits<double>::max();
+      box[sd+d] = cmax[d] = -std::numeric_limits<double>::max();
+   }
+   for (int i = begin; i < end; i++)
+   {
+      const double *b = eb + 2*sd*elems[i];
+      for (int d = 0; d < sd; d++)
+      {
+         const double c = 0.5*(b[d] + b[sd+d]);
+         box[d] = std::min(box[d], b[d]);
+         box[sd+d] = std::max(box[sd+d], b[sd+d]);
+         cmin[d] = std::min(cmin[d], c);
+         cmax[d] = std::max(cmax[d], c);
+      }
+   }
+   if (end - begin <= leaf_size) { return; }
+
+   // Split at the median of the box centers along their widest direction
+   int axis = 0;
+   for (int d = 1; d < sd; d++)
+   {
+      if (cmax[d] - cmin[d] > cmax[axis] - cmin[axis]) { axis = d; }
+   }
+   const int mid = (begin + end) / 2;
+   std::nth_element(elems.GetData() + begin, elems.GetData() + mid,
+                    elems.GetData() + end, [&](int a, int b)
+   {
+      return eb[2*sd*a+axis] + eb[2*sd*a+sd+axis] <
+             eb[2*sd*b+axis] + eb[2*sd*b+sd+axis];
+   });
+
+   const int child = AddNode(begin, mid);
+   AddNode(mid, end);
+   node_child[node] = child;
+   BuildNode(child);
+   BuildNode(child + 1);
+}
+
+void PointLocator::Update()
+{
+   sdim = mesh.SpaceDimension();
+   MFEM_VERIFY(1 <= sdim && sdim <= 3, "invalid space dimension: " << sdim);
+   const int NE = mesh.GetNE();
+
+   elem_box.SetSize(2*sdim*NE);
+   Vector vals;
+   Array<int> vdofs;
+   for (int e = 0; e < NE; e++)
+   {
+      ComputeElementBox(e, vals, vdofs);
+   }
+
+   elems.SetSize(NE);
+   for (int e = 0; e < NE; e++) { elems[e] = e; }
+
+   node_box.SetSize(0);
+   node_begin.SetSize(0);
+   node_end.SetSize(0);
+   node_child.SetSize(0);
+   if (NE == 0) { return; }
+   AddNode(0, NE);
+   BuildNode(0);
+}
+
+void PointLocator::FindCandidates(const double *x, Array<int> &cand) const
+{
+   cand.SetSize(0);
+   if (node_child.Size() == 0) { return; }
+
+   // The BVH is balanced, so its depth is at most 32
+   const int max_stack = 64;
+   int stack[max_stack], top = 0;
+   stack[top++] = 0;
+   while (top > 0)
+   {
+      const int node = stack[--top];
+      if (!InBox(&node_box[2*sdim*node], x, sdim)) { continue; }
+      const int child = node_child[node];
+      if (child < 0)
+      {
+         for (int i = node_begin[node]; i < node_end[node]; i++)
+         {
+            if (InBox(&elem_box[2*sdim*elems[i]], x, sdim))
+            {
+               cand.Append(elems[i]);
+            }
+         }
+      }
+      else
+      {
+         MFEM_ASSERT(top + 2 <= max_stack, "BVH stack overflow");
+         stack[top++] = child;
+         stack[top++] = child + 1;
+      }
+   }
+
+   if (cand.Size() > 1)
+   {
+      const double *eb = elem_box.GetData();
+      const int sd = sdim;
+      auto dist = [&](int e)
+      {
+         double d2 = 0.0;
+         for (int d = 0; d < sd; d++)
+         {
+            const double c = 0.5*(eb[2*sd*e+d] + eb[2*sd*e+sd+d]) - x[d];
+            d2 += c*c;
+         }
+         return d2;
+      };
+      std::sort(cand.begin(), cand.end(),
+                [&](int a, int b) { return dist(a) < dist(b); });
+   }
+}
+
+int PointLocator::FindPoints(const DenseMatrix &points, Array<int> &elem_ids,
+                             Array<IntegrationPoint> &ips,
+                             InverseElementTransformation *inv_trans) const
+{
+   const int npts = points.Width();
+   MFEM_VERIFY(npts == 0 || points.Height() == sdim, "invalid points matrix");
+   elem_ids.SetSize(npts);
+   ips.SetSize(npts);
+   elem_ids = -1;
+   if (npts == 0 || mesh.GetNE() == 0) { return 0; }
+
+   // The candidate elements of all points
+   Array<int> cand_offsets(npts + 1), cand_all, cand;
+   cand_offsets[0] = 0;
+   for (int k = 0; k < npts; k++)
+   {
+      FindCandidates(points.Data() + k*sdim, cand);
+      cand_all.Append(cand);
+      cand_offsets[k+1] = cand_all.Size();
+   }
+
+   InverseElementTransformation *inv_tr = inv_trans;
+   inv_tr = inv_tr ? inv_tr : new InverseElementTransformation;
+
+   // In round r, try the r-th candidate of all points that were not found yet.
+   // The points are grouped by element, so that each element transformation
+   // is set once per round.
+   int pts_found = 0;
+   Array<Pair<int, int> > elem_pt;
+   Vector pt;
+   IntegrationPoint ip;
+   for (int r = 0; ; r++)
+   {
+      elem_pt.SetSize(0);
+      for (int k = 0; k < npts; k++)
+      {
+         if (elem_ids[k] < 0 && cand_offsets[k] + r < cand_offsets[k+1])
+         {
+            elem_pt.Append(Pair<int, int>(cand_all[cand_offsets[k] + r], k));
+         }
+      }
+      if (elem_pt.Size() == 0) { break; }
+      SortPairs<int, int>(elem_pt, elem_pt.Size());
+
+      for (int i = 0; i < elem_pt.Size(); )
+      {
+         const int e = elem_pt[i].one;
+         inv_tr->SetTransformation(*mesh.GetElementTransformation(e));
+         for ( ; i < elem_pt.Size() && elem_pt[i].one == e; i++)
+         {
+            const int k = elem_pt[i].two;
+            pt.SetDataAndSize(points.Data() + k*sdim, sdim);
+            if (inv_tr->Transform(pt, ip) ==
+                InverseElementTransformation::Inside)
+            {
+               elem_ids[k] = e;
+               ips[k] = ip;
+               pts_found++;
+            }
+         }
+      }
+   }
+
+   if (inv_trans == NULL) { delete inv_tr; }
+   return pts_found;
+}
+
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_POINT_LOCATOR
+#define MFEM_POINT_LOCATOR
+
+#include "../config/config.hpp"
+#include "../general/array.hpp"
+#include "../linalg/densemat.hpp"
+#include "../fem/intrules.hpp"
+
+namespace mfem
+{
+
+class Mesh;
+class InverseElementTransformation;
+
+/** @brief Class for locating arbitrary physical points in the elements of a
+    Mesh, using a bounding volume hierarchy (BVH) of the element bounding
+    boxes.
+
+    The BVH is built once, in O(NE log NE) operations, and can then be used to
+    locate any number of points: the candidate elements of each point are the
+    elements whose bounding boxes contain it, and the reference coordinates of
+    the point are computed with InverseElementTransformation. The points are
+    processed in batches grouped by candidate element, so that each element
+    transformation is set up once per batch.
+
+    For curved meshes, the bounding box of an element is the bounding box of
+    its nodes, enlarged by a relative tolerance, see the constructor. The
+    PointLocator must be updated with Update() when the mesh or its nodes
+    change. */
+class PointLocator
+{
+protected:
+   Mesh &mesh;
+   int sdim;
+   double bb_tol;
+   int leaf_size;
+
+   /// Bounding boxes of the elements: lower and upper corners, 2*sdim x NE
+   Array<double> elem_box;
+
+   /// Element indices, ordered so that each BVH node has a contiguous range
+   Array<int> elems;
+
+   /** BVH nodes: bounding box (2*sdim values), range [begin,end) in the array
+       elems, and index of the first child (the second child follows it), or
+       -1 for leaves. The root is the node 0. */
+   Array<double> node_box;
+   Array<int> node_begin, node_end, node_child;
+
+   void ComputeElementBox(int e, Vector &vals, Array<int> &vdofs);
+   int AddNode(int begin, int end);
+   void BuildNode(int node);
+
+public:
+   /** @brief Build the BVH of the elements of @a mesh_. */
+   /** The element bounding boxes are enlarged by @a bb_tol times their size in
+       each direction, which accounts for curved elements bulging out of the
+       box of their nodes. The leaves of the BVH contain at most
+       @a leaf_size_ elements. */
+   PointLocator(Mesh &mesh_, double bb_tol_ = 0.1, int leaf_size_ = 4);
+
+   /// Rebuild the BVH after the mesh or its nodes have changed
+   void Update();
+
+   /** @brief Set @a cand to the elements whose bounding boxes contain the
+       point @a x, ordered by the distance from @a x to the box centers. */
+   void FindCandidates(const double *x, Array<int> &cand) const;
+
+   /** @brief Find the elements and reference coordinates of the points given
+       by the columns of @a points, see Mesh::FindPoints(). */
+   /** If no element is found for the i-th point, @a elem_ids[i] is set to -1.
+       An optional @a inv_trans can be given to customize the inversion of the
+       element transformations. Returns the number of points found. */
+   int FindPoints(const DenseMatrix &points, Array<int> &elem_ids,
+                  Array<IntegrationPoint> &ips,
+                  InverseElementTransformation *inv_trans = NULL) const;
+
+   /// Return the Mesh of the PointLocator
+   Mesh &GetMesh() const { return mesh; }
+};
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include "general/stable3d.hpp"
 #include "general/table.hpp"
 #include "general/tic_toc.hpp"
+#include "general/profiler.hpp"
 #ifdef MFEM_USE_ADIOS2
 #include "general/adios2stream.hpp"
 #endif
@@ -32,6 +33,7 @@
 #include "general/socketstream.hpp"
 #include "general/optparser.hpp"
 #include "general/zstr.hpp"
+#include "general/binaryio.hpp"
 #include "general/version.hpp"
 #include "general/globals.hpp"
 #ifdef MFEM_USE_MPI
@@ -316,8 +316,7 @@ void NavierSolver::Step(double &time, double dt, int cur_step)
    if (cur_step <= 2)
    {
       H_bdfcoeff.constant = bd0 / dt;
-      H_form->Update();
-      H_form->Assemble();
+      H_form->ReassembleCoefficients();
       H_form->FormSystemMatrix(vel_ess_tdof, H);
 
       if (partial_assembly)
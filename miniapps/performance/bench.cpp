@@ -0,0 +1,557 @@
+//                    MFEM Performance Benchmarks
+//
+// Compile with: make bench
+//
+// Sample runs:  bench
+//               bench -dim 3 -e tensor -p "1 2 3 4" -l "partial none"
+//               bench -i "diffusion" -s "" -dofs 1e6 -o diffusion.csv
+//               bench -i "" -s "cg-jacobi multigrid" -p "2 4 8"
+//               bench -dev cuda -l partial
+//
+// Description:  This miniapp measures the throughput of the bilinear form
+//               operators and of a few preconditioned solvers, and writes the
+//               results in CSV format, one row per configuration.
+//
+//               The operator benchmarks sweep the dimension, the element type
+//               (tensor-product or simplex), the order, the assembly level
+//               (full, element, partial, none) and the integrator (mass,
+//               diffusion, vector-diffusion, convection, curl-curl, div-div).
+//               For each configuration, the setup (assembly) and the operator
+//               action (Mult) are timed, and reported in DOFs per second.
+//
+//               The solver benchmarks solve a Poisson problem with CG and a
+//               Jacobi, Chebyshev or p-multigrid preconditioner, and report
+//               the setup time, the number of iterations and the DOFs per
+//               second of one iteration.
+//
+//               Combinations that are not supported by the library, or whose
+//               element matrices would exceed the given memory limit, are
+//               skipped. The problem size of each configuration is close to
+//               the requested number of DOFs.
+
+#include "mfem.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cmath>
+
+using namespace std;
+using namespace mfem;
+
+static const char *level_names[] = { "full", "element", "partial", "none" };
+
+struct BenchConfig
+{
+   int dim;
+   bool simplex;
+   int order;
+   AssemblyLevel level;
+};
+
+// Split a space-separated list of names
+static vector<string> Split(const char *list)
+{
+   vector<string> words;
+   istringstream in(list);
+   string w;
+   while (in >> w) { words.push_back(w); }
+   return words;
+}
+
+static bool ParseLevel(const string &name, AssemblyLevel &level)
+{
+   for (int i = 0; i < 4; i++)
+   {
+      if (name == level_names[i])
+      {
+         level = static_cast<AssemblyLevel>(i);
+         return true;
+      }
+   }
+   return false;
+}
+
+static const char *LevelName(AssemblyLevel level)
+{
+   return level_names[static_cast<int>(level)];
+}
+
+static const char *ElementName(int dim, bool simplex)
+{
+   if (dim == 2) { return simplex ? "tri" : "quad"; }
+   return simplex ? "tet" : "hex";
+}
+
+// Return true if the library supports the integrator at the given assembly
+// level and element type.
+static bool Supported(const string &integ, const BenchConfig &c)
+{
+   switch (c.level)
+   {
+      case AssemblyLevel::FULL:
+         return true;
+      case AssemblyLevel::ELEMENT:
+         return !c.simplex &&
+                (integ == "mass" || integ == "diffusion" ||
+                 integ == "convection");
+      case AssemblyLevel::PARTIAL:
+         return !c.simplex || integ == "mass" || integ == "diffusion" ||
+                integ == "curl-curl";
+      case AssemblyLevel::NONE:
+         return !c.simplex && (integ == "mass" || integ == "diffusion");
+   }
+   return false;
+}
+
+// The solver benchmarks need the diagonal of the operator, which is not
+// available with element assembly and matrix-free forms
+static bool SolverSupported(const BenchConfig &c)
+{
+   return (c.level == AssemblyLevel::FULL ||
+           c.level == AssemblyLevel::PARTIAL) && Supported("diffusion", c);
+}
+
+// Uniform Cartesian mesh of the unit square or cube with about the given
+// number of DOFs for an H1 space of the given order
+static Mesh *MakeMesh(const BenchConfig &c, double dofs)
+{
+   const int n = max(1, (int) round(pow(dofs, 1.0/c.dim)/c.order));
+   if (c.dim == 2)
+   {
+      return new Mesh(n, n, c.simplex ? Element::TRIANGLE :
+                      Element::QUADRILATERAL, true, 1.0, 1.0);
+   }
+   Mesh *mesh = new Mesh(n, n, n, c.simplex ? Element::TETRAHEDRON :
+                         Element::HEXAHEDRON, true, 1.0, 1.0, 1.0);
+   // Needed by the ND and RT spaces of order > 1 on tetrahedra
+   if (c.simplex) { mesh->ReorientTetMesh(); }
+   return mesh;
+}
+
+static FiniteElementCollection *MakeFEC(const string &integ,
+                                        const BenchConfig &c)
+{
+   if (integ == "curl-curl") { return new ND_FECollection(c.order, c.dim); }
+   if (integ == "div-div") { return new RT_FECollection(c.order-1, c.dim); }
+   return new H1_FECollection(c.order, c.dim);
+}
+
+// Estimated size in bytes of the element matrices of the given space
+static double ElementMatrixBytes(const FiniteElementSpace &fes)
+{
+   if (fes.GetNE() == 0) { return 0.0; }
+   const double nd = fes.GetFE(0)->GetDof() * fes.GetVDim();
+   return 8.0 * nd * nd * fes.GetNE();
+}
+
+// Diagonal of the operator A formed by the bilinear form a. With full
+// assembly, the form must use the DIAG_ONE policy, like the constrained
+// operators of the other assembly levels.
+static void GetDiagonal(const BilinearForm &a, AssemblyLevel level,
+                        const OperatorPtr &A, Vector &diag)
+{
+   diag.SetSize(A->Height());
+   if (level == AssemblyLevel::FULL) { A.As<SparseMatrix>()->GetDiag(diag); }
+   else { a.AssembleDiagonal(diag); }
+}
+
+struct Timing
+{
+   double setup, apply;
+   int reps;
+};
+
+// Time the action of the operator, repeating it for at least min_time seconds
+static void TimeMult(const Operator &op, double min_time, Timing &t)
+{
+   Vector x(op.Width()), y(op.Height());
+   x.Randomize(1);
+   op.Mult(x, y); // warm up
+   y.HostRead();
+
+   StopWatch sw;
+   sw.Start();
+   t.reps = 0;
+   do
+   {
+      op.Mult(x, y);
+      t.reps++;
+      if (t.reps % 4 == 0) { y.HostRead(); }
+   }
+   while (t.reps < 3 || sw.RealTime() < min_time);
+   y.HostRead();
+   sw.Stop();
+   t.apply = sw.RealTime() / t.reps;
+}
+
+static void PrintHeader(ostream &out)
+{
+   out << "benchmark,dim,element,order,level,integrator,solver,dofs,"
+       << "setup_s,setup_dofs_per_s,apply_s,apply_dofs_per_s,iterations\n";
+}
+
+static void PrintRow(ostream &out, const char *benchmark,
+                     const BenchConfig &c, const string &integ,
+                     const string &solver, int dofs, double setup,
+                     double apply, int iterations)
+{
+   out << benchmark << ',' << c.dim << ',' << ElementName(c.dim, c.simplex)
+       << ',' << c.order << ',' << LevelName(c.level) << ',' << integ << ','
+       << solver << ',' << dofs << ',' << setup << ',' << dofs/setup << ','
+       << apply << ',' << dofs/apply << ',' << iterations << endl;
+}
+
+static void BenchOperator(const string &integ, const BenchConfig &c,
+                          double target_dofs, double min_time,
+                          double max_bytes, ostream &out)
+{
+   Mesh *mesh = MakeMesh(c, target_dofs);
+   FiniteElementCollection *fec = MakeFEC(integ, c);
+   const int vdim = (integ == "vector-diffusion") ? c.dim : 1;
+   FiniteElementSpace fes(mesh, fec, vdim);
+
+   if (c.level != AssemblyLevel::PARTIAL && c.level != AssemblyLevel::NONE &&
+       ElementMatrixBytes(fes) > max_bytes)
+   {
+      mfem::err << "Skipping " << integ << ", " << LevelName(c.level)
+                << ", order " << c.order << ": element matrices exceed "
+                << "the memory limit\n";
+      delete fec;
+      delete mesh;
+      return;
+   }
+
+   ConstantCoefficient one(1.0);
+   Vector vel(c.dim);
+   for (int d = 0; d < c.dim; d++) { vel(d) = 1.0 + d; }
+   VectorConstantCoefficient velocity(vel);
+
+   Timing t;
+   StopWatch sw;
+   sw.Start();
+   BilinearForm a(&fes);
+   a.SetAssemblyLevel(c.level);
+   if (integ == "mass") { a.AddDomainIntegrator(new MassIntegrator(one)); }
+   else if (integ == "diffusion")
+   {
+      a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   }
+   else if (integ == "vector-diffusion")
+   {
+      a.AddDomainIntegrator(new VectorDiffusionIntegrator(one));
+   }
+   else if (integ == "convection")
+   {
+      a.AddDomainIntegrator(new ConvectionIntegrator(velocity));
+   }
+   else if (integ == "curl-curl")
+   {
+      a.AddDomainIntegrator(new CurlCurlIntegrator(one));
+   }
+   else if (integ == "div-div")
+   {
+      a.AddDomainIntegrator(new DivDivIntegrator(one));
+   }
+   a.Assemble();
+   if (c.level == AssemblyLevel::FULL) { a.Finalize(); }
+   sw.Stop();
+   t.setup = sw.RealTime();
+
+   TimeMult(a, min_time, t);
+   PrintRow(out, "operator", c, integ, "", fes.GetVSize(), t.setup, t.apply,
+            0);
+
+   delete fec;
+   delete mesh;
+}
+
+// p-multigrid for the diffusion operator: the orders are halved from the
+// finest to the coarsest level (order 1), which is solved with CG. The other
+// levels use Chebyshev smoothing.
+class DiffusionPMultigrid : public Multigrid
+{
+private:
+   ConstantCoefficient one;
+   AssemblyLevel level;
+
+   void AddForm(FiniteElementSpace &fes, Array<int> &ess_bdr)
+   {
+      BilinearForm *form = new BilinearForm(&fes);
+      form->SetAssemblyLevel(level);
+      form->SetDiagonalPolicy(Matrix::DIAG_ONE);
+      form->AddDomainIntegrator(new DiffusionIntegrator(one));
+      form->Assemble();
+      bfs.Append(form);
+
+      essentialTrueDofs.Append(new Array<int>());
+      fes.GetEssentialTrueDofs(ess_bdr, *essentialTrueDofs.Last());
+   }
+
+public:
+   DiffusionPMultigrid(FiniteElementSpaceHierarchy &fespaces,
+                       Array<int> &ess_bdr, AssemblyLevel level_)
+      : Multigrid(fespaces), one(1.0), level(level_)
+   {
+      for (int l = 0; l < fespaces.GetNumLevels(); l++)
+      {
+         FiniteElementSpace &fes = fespaces.GetFESpaceAtLevel(l);
+         AddForm(fes, ess_bdr);
+
+         OperatorPtr op;
+         op.SetType(Operator::ANY_TYPE);
+         bfs.Last()->FormSystemMatrix(*essentialTrueDofs.Last(), op);
+         const bool own_op = op.OwnsOperator();
+         op.SetOperatorOwner(false);
+
+         Solver *smoother;
+         if (l == 0)
+         {
+            CGSolver *cg = new CGSolver();
+            cg->SetPrintLevel(-1);
+            cg->SetMaxIter(200);
+            cg->SetRelTol(1e-2);
+            cg->SetOperator(*op.Ptr());
+            smoother = cg;
+         }
+         else
+         {
+            Vector diag;
+            GetDiagonal(*bfs.Last(), level, op, diag);
+            smoother = new OperatorChebyshevSmoother(
+               op.Ptr(), diag, *essentialTrueDofs.Last(), 2);
+         }
+         AddLevel(op.Ptr(), smoother, own_op, true);
+      }
+   }
+};
+
+static void BenchSolver(const string &solver, const BenchConfig &c,
+                        double target_dofs, double max_bytes, ostream &out)
+{
+   Mesh *mesh = MakeMesh(c, target_dofs);
+   Array<FiniteElementCollection*> fecs;
+   Array<int> orders;
+   if (solver == "multigrid")
+   {
+      for (int p = c.order; p > 1; p /= 2) { orders.Prepend(p); }
+   }
+   orders.Prepend(solver == "multigrid" ? 1 : c.order);
+
+   fecs.Append(new H1_FECollection(orders[0], c.dim));
+   FiniteElementSpace *coarse = new FiniteElementSpace(mesh, fecs[0]);
+   FiniteElementSpaceHierarchy fespaces(mesh, coarse, true, true);
+   for (int l = 1; l < orders.Size(); l++)
+   {
+      fecs.Append(new H1_FECollection(orders[l], c.dim));
+      fespaces.AddOrderRefinedLevel(fecs.Last());
+   }
+   FiniteElementSpace &fes = fespaces.GetFinestFESpace();
+
+   if (c.level == AssemblyLevel::FULL && ElementMatrixBytes(fes) > max_bytes)
+   {
+      mfem::err << "Skipping " << solver << ", order " << c.order
+                << ": element matrices exceed the memory limit\n";
+      for (int l = 0; l < fecs.Size(); l++) { delete fecs[l]; }
+      return;
+   }
+
+   Array<int> ess_bdr(mesh->bdr_attributes.Max());
+   ess_bdr = 1;
+   Array<int> ess_tdof_list;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+   GridFunction x(&fes);
+   x = 0.0;
+
+   StopWatch sw;
+   sw.Start();
+   BilinearForm *a = NULL;
+   Solver *prec = NULL;
+   Vector diag;
+   OperatorPtr A;
+   Vector B, X;
+   if (solver == "multigrid")
+   {
+      DiffusionPMultigrid *mg = new DiffusionPMultigrid(fespaces, ess_bdr,
+                                                        c.level);
+      mg->FormFineLinearSystem(x, b, A, X, B);
+      prec = mg;
+   }
+   else
+   {
+      a = new BilinearForm(&fes);
+      a->SetAssemblyLevel(c.level);
+      a->SetDiagonalPolicy(Matrix::DIAG_ONE);
+      a->AddDomainIntegrator(new DiffusionIntegrator(one));
+      a->Assemble();
+      a->FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+      GetDiagonal(*a, c.level, A, diag);
+      if (solver == "cg-jacobi")
+      {
+         prec = new OperatorJacobiSmoother(diag, ess_tdof_list);
+      }
+      else
+      {
+         prec = new OperatorChebyshevSmoother(A.Ptr(), diag, ess_tdof_list, 2);
+      }
+   }
+   CGSolver cg;
+   cg.SetRelTol(1e-8);
+   cg.SetMaxIter(2000);
+   cg.SetPrintLevel(-1);
+   cg.SetOperator(*A);
+   cg.SetPreconditioner(*prec);
+   sw.Stop();
+   const double setup = sw.RealTime();
+
+   sw.Clear();
+   sw.Start();
+   cg.Mult(B, X);
+   X.HostRead();
+   sw.Stop();
+   const int iter = max(1, cg.GetNumIterations());
+   PrintRow(out, "solver", c, "diffusion", solver, fes.GetTrueVSize(), setup,
+            sw.RealTime()/iter, cg.GetNumIterations());
+
+   delete prec;
+   delete a;
+   for (int l = 0; l < fecs.Size(); l++) { delete fecs[l]; }
+}
+
+int main(int argc, char *argv[])
+{
+   // 1. Parse command-line options.
+   const char *dims = "2 3";
+   const char *elements = "tensor simplex";
+   const char *orders = "1 2 3 4 5 6 7 8";
+   const char *levels = "full element partial none";
+   const char *integrators =
+      "mass diffusion vector-diffusion convection curl-curl div-div";
+   const char *solvers = "cg-jacobi cg-chebyshev multigrid";
+   double target_dofs = 1e5;
+   double min_time = 0.1;
+   double max_gb = 2.0;
+   const char *output = "";
+   const char *device_config = "cpu";
+
+   OptionsParser args(argc, argv);
+   args.AddOption(&dims, "-dim", "--dimensions",
+                  "Space dimensions to benchmark: 2 and/or 3.");
+   args.AddOption(&elements, "-e", "--elements",
+                  "Element types to benchmark: tensor and/or simplex.");
+   args.AddOption(&orders, "-p", "--orders",
+                  "Finite element orders to benchmark.");
+   args.AddOption(&levels, "-l", "--levels",
+                  "Assembly levels: full, element, partial, none.");
+   args.AddOption(&integrators, "-i", "--integrators",
+                  "Integrators: mass, diffusion, vector-diffusion, "
+                  "convection, curl-curl, div-div.");
+   args.AddOption(&solvers, "-s", "--solvers",
+                  "Solvers: cg-jacobi, cg-chebyshev, multigrid.");
+   args.AddOption(&target_dofs, "-dofs", "--dofs",
+                  "Approximate number of DOFs of each benchmark.");
+   args.AddOption(&min_time, "-t", "--min-time",
+                  "Minimal time in seconds to measure the operator action.");
+   args.AddOption(&max_gb, "-mem", "--max-memory",
+                  "Skip full and element assembly if the element matrices "
+                  "exceed this size in GB.");
+   args.AddOption(&output, "-o", "--output",
+                  "CSV output file; the default is the standard output.");
+   args.AddOption(&device_config, "-dev", "--device",
+                  "Device configuration string, see Device::Configure().");
+   args.Parse();
+   if (!args.Good())
+   {
+      args.PrintUsage(mfem::out);
+      return 1;
+   }
+
+   Device device(device_config);
+
+   ofstream ofs;
+   if (output[0]) { ofs.open(output); }
+   ostream &out = output[0] ? ofs : cout;
+   out.precision(6);
+   PrintHeader(out);
+
+   const vector<string> integ_list = Split(integrators);
+   const vector<string> solver_list = Split(solvers);
+   for (const string &integ : integ_list)
+   {
+      if (integ != "mass" && integ != "diffusion" &&
+          integ != "vector-diffusion" && integ != "convection" &&
+          integ != "curl-curl" && integ != "div-div")
+      {
+         mfem::err << "Unknown integrator: " << integ << '\n';
+         return 2;
+      }
+   }
+   for (const string &solver : solver_list)
+   {
+      if (solver != "cg-jacobi" && solver != "cg-chebyshev" &&
+          solver != "multigrid")
+      {
+         mfem::err << "Unknown solver: " << solver << '\n';
+         return 2;
+      }
+   }
+
+   const double max_bytes = 1e9 * max_gb;
+   vector<BenchConfig> configs;
+   for (const string &d : Split(dims))
+   {
+      for (const string &e : Split(elements))
+      {
+         for (const string &p : Split(orders))
+         {
+            for (const string &l : Split(levels))
+            {
+               BenchConfig c;
+               c.dim = stoi(d);
+               c.simplex = (e == "simplex");
+               c.order = stoi(p);
+               if (!ParseLevel(l, c.level) || (c.dim != 2 && c.dim != 3) ||
+                   (e != "tensor" && e != "simplex") || c.order < 1)
+               {
+                  mfem::err << "Invalid benchmark: dim " << d << ", "
+                            << e << ", order " << p << ", " << l << '\n';
+                  return 2;
+               }
+               configs.push_back(c);
+            }
+         }
+      }
+   }
+
+   // 2. Operator benchmarks.
+   for (const BenchConfig &c : configs)
+   {
+      for (const string &integ : integ_list)
+      {
+         if (Supported(integ, c))
+         {
+            BenchOperator(integ, c, target_dofs, min_time, max_bytes, out);
+         }
+      }
+   }
+
+   // 3. Solver benchmarks.
+   for (const BenchConfig &c : configs)
+   {
+      for (const string &solver : solver_list)
+      {
+         if (SolverSupported(c))
+         {
+            BenchSolver(solver, c, target_dofs, max_bytes, out);
+         }
+      }
+   }
+
+   return 0;
+}
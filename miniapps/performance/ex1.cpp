@@ -71,6 +71,7 @@ int main(int argc, char *argv[])
    const char *pc = "none";
    bool perf = true;
    bool matrix_free = true;
+   bool sfc_ordering = false;
    bool visualization = 1;
 
    OptionsParser args(argc, argv);
@@ -94,6 +95,9 @@ int main(int argc, char *argv[])
                   "ho - high-order (assembled) GS, none.");
    args.AddOption(&static_cond, "-sc", "--static-condensation", "-no-sc",
                   "--no-static-condensation", "Enable static condensation.");
+   args.AddOption(&sfc_ordering, "-sfc", "--sfc-ordering", "-no-sfc",
+                  "--no-sfc-ordering",
+                  "Renumber the elements and the DOFs along a Hilbert curve.");
    args.AddOption(&visualization, "-vis", "--visualization", "-no-vis",
                   "--no-visualization",
                   "Enable or disable GLVis visualization.");
@@ -111,6 +115,8 @@ int main(int argc, char *argv[])
    }
    MFEM_VERIFY(perf || !matrix_free,
                "--standard-version is not compatible with --matrix-free");
+   MFEM_VERIFY(!sfc_ordering || strcmp(pc, "lor"),
+               "--sfc-ordering is not compatible with the LOR preconditioner");
    args.PrintOptions(cout);
 
    enum PCType { NONE, LOR, HO };
@@ -175,6 +181,14 @@ int main(int argc, char *argv[])
       MFEM_VERIFY(pc_choice != LOR, "triangle and tet meshes do not support"
                   " the LOR preconditioner yet");
    }
+   if (sfc_ordering)
+   {
+      // Visit the elements along a space-filling curve through their centers
+      // to improve the memory locality of the assembly and the evaluation.
+      Array<int> ordering;
+      mesh->GetHilbertElementOrdering(ordering);
+      mesh->ReorderElements(ordering);
+   }
 
    // 5. Define a finite element space on the mesh. Here we use continuous
    //    Lagrange finite elements of the specified order. If order < 1, we
@@ -194,6 +208,11 @@ int main(int argc, char *argv[])
       fec = new H1_FECollection(order = 1, dim, basis);
    }
    FiniteElementSpace *fespace = new FiniteElementSpace(mesh, fec);
+   if (sfc_ordering)
+   {
+      // Number the DOFs in the order they are first touched by the elements.
+      fespace->ReorderElementToDofTable();
+   }
    cout << "Number of finite element unknowns: "
         << fespace->GetTrueVSize() << endl;
 
@@ -348,6 +367,8 @@ int main(int argc, char *argv[])
    cout << " done, " << tic_toc.RealTime() << "s." << endl;
 
    // Solve with CG or PCG, depending if the matrix A_pc is available
+   tic_toc.Clear();
+   tic_toc.Start();
    if (pc_choice != NONE)
    {
       GSSmoother M(A_pc);
@@ -357,6 +378,9 @@ int main(int argc, char *argv[])
    {
       CG(*a_oper, B, X, 1, 500, 1e-12, 0.0);
    }
+   tic_toc.Stop();
+   cout << "Solving the linear system ... done, " << tic_toc.RealTime() << "s."
+        << endl;
 
    // 13. Recover the solution as a finite element grid function.
    if (perf && matrix_free)
@@ -65,3 +65,93 @@ TEST_CASE("Test order of boundary integrators",
       delete D;
    }
 }
+
+namespace bilinearform_threaded
+{
+
+static double q(const Vector &x)
+{
+   return 1.0 + x(0)*x(0) + x(1);
+}
+
+static void vq(const Vector &x, Vector &v)
+{
+   v = 0.0;
+   v(0) = 1.0 + x(1);
+   v(1) = -x(0);
+}
+
+// Integrators that opt out of threaded assembly, so that
+// BilinearForm::Assemble() uses the serial element loop
+class SerialMassIntegrator : public MassIntegrator
+{
+public:
+   SerialMassIntegrator(Coefficient &Q) : MassIntegrator(Q) { }
+   virtual bool SupportsThreadedAssembly() const { return false; }
+};
+
+class SerialDiffusionIntegrator : public DiffusionIntegrator
+{
+public:
+   SerialDiffusionIntegrator(Coefficient &Q) : DiffusionIntegrator(Q) { }
+   virtual bool SupportsThreadedAssembly() const { return false; }
+};
+
+class SerialConvectionIntegrator : public ConvectionIntegrator
+{
+public:
+   SerialConvectionIntegrator(VectorCoefficient &Q) : ConvectionIntegrator(Q) { }
+   virtual bool SupportsThreadedAssembly() const { return false; }
+};
+
+static void CheckEqual(const SparseMatrix &A, const SparseMatrix &B)
+{
+   SparseMatrix *D = Add(1.0, A, -1.0, B);
+   REQUIRE(D->MaxNorm() < 1e-12 * B.MaxNorm());
+   delete D;
+}
+
+// With MFEM_USE_THREADED_ASSEMBLY, the integrators supporting threaded
+// assembly are assembled with colored OpenMP loops; compare them with the
+// serial loop.
+TEST_CASE("BilinearForm threaded assembly", "[BilinearForm]")
+{
+   for (int dim = 2; dim <= 3; dim++)
+   {
+      CAPTURE(dim);
+      Mesh *mesh = (dim == 2) ?
+                   new Mesh(6, 6, Element::TRIANGLE, true) :
+                   new Mesh(3, 3, 3, Element::HEXAHEDRON, true);
+      const int order = 2;
+      H1_FECollection fec(order, dim);
+      FiniteElementSpace fes(mesh, &fec);
+      FunctionCoefficient qcoeff(q);
+      VectorFunctionCoefficient vcoeff(dim, vq);
+
+      BilinearForm a(&fes), a_serial(&fes), a_mixed(&fes);
+      a.AddDomainIntegrator(new MassIntegrator(qcoeff));
+      a.AddDomainIntegrator(new DiffusionIntegrator(qcoeff));
+      a.AddDomainIntegrator(new ConvectionIntegrator(vcoeff));
+      a.Assemble();
+      a.Finalize();
+
+      a_serial.AddDomainIntegrator(new SerialMassIntegrator(qcoeff));
+      a_serial.AddDomainIntegrator(new SerialDiffusionIntegrator(qcoeff));
+      a_serial.AddDomainIntegrator(new SerialConvectionIntegrator(vcoeff));
+      a_serial.Assemble();
+      a_serial.Finalize();
+      CheckEqual(a.SpMat(), a_serial.SpMat());
+
+      // One integrator without threaded assembly disables it for all
+      a_mixed.AddDomainIntegrator(new MassIntegrator(qcoeff));
+      a_mixed.AddDomainIntegrator(new SerialDiffusionIntegrator(qcoeff));
+      a_mixed.AddDomainIntegrator(new ConvectionIntegrator(vcoeff));
+      a_mixed.Assemble();
+      a_mixed.Finalize();
+      CheckEqual(a_mixed.SpMat(), a_serial.SpMat());
+
+      delete mesh;
+   }
+}
+
+} // namespace bilinearform_threaded
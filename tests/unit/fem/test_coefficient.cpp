@@ -0,0 +1,336 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "catch.hpp"
+
+using namespace mfem;
+
+namespace coefficient_project
+{
+
+double scalar_func(const Vector &x)
+{
+   double r = 1.0;
+   for (int d = 0; d < x.Size(); d++) { r += (d + 1)*x(d)*x(d); }
+   return r;
+}
+
+double scalar_td_func(const Vector &x, double t)
+{
+   return scalar_func(x)*(1.0 + t);
+}
+
+void vector_func(const Vector &x, Vector &v)
+{
+   for (int d = 0; d < v.Size(); d++) { v(d) = sin(x(d % x.Size())) + d; }
+}
+
+void matrix_func(const Vector &x, DenseMatrix &m)
+{
+   for (int i = 0; i < m.Height(); i++)
+   {
+      for (int j = 0; j < m.Width(); j++)
+      {
+         m(i,j) = x(i % x.Size())*(j + 1) + (i == j);
+      }
+   }
+}
+
+void perturb(const Vector &x, Vector &p)
+{
+   p(0) = x(0) + 0.1*sin(x(1));
+   p(1) = x(1) + 0.1*sin(x(0));
+}
+
+// Compare Coefficient::Project() with pointwise evaluation
+double ProjectError(Coefficient &c, QuadratureFunction &qf)
+{
+   c.Project(qf);
+   Mesh &mesh = *qf.GetSpace()->GetMesh();
+   double err = 0.0;
+   Vector values;
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      ElementTransformation &T = *mesh.GetElementTransformation(e);
+      const IntegrationRule &ir = qf.GetElementIntRule(e);
+      qf.GetElementValues(e, values);
+      for (int i = 0; i < ir.GetNPoints(); i++)
+      {
+         T.SetIntPoint(&ir.IntPoint(i));
+         err = std::max(err, fabs(values(i) - c.Eval(T, ir.IntPoint(i))));
+      }
+   }
+   return err;
+}
+
+double ProjectError(VectorCoefficient &c, QuadratureFunction &qf)
+{
+   c.Project(qf);
+   Mesh &mesh = *qf.GetSpace()->GetMesh();
+   double err = 0.0;
+   DenseMatrix values;
+   Vector v;
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      ElementTransformation &T = *mesh.GetElementTransformation(e);
+      const IntegrationRule &ir = qf.GetElementIntRule(e);
+      qf.GetElementValues(e, values);
+      for (int i = 0; i < ir.GetNPoints(); i++)
+      {
+         T.SetIntPoint(&ir.IntPoint(i));
+         c.Eval(v, T, ir.IntPoint(i));
+         for (int d = 0; d < v.Size(); d++)
+         {
+            err = std::max(err, fabs(values(d,i) - v(d)));
+         }
+      }
+   }
+   return err;
+}
+
+double ProjectError(MatrixCoefficient &c, QuadratureFunction &qf)
+{
+   c.Project(qf);
+   Mesh &mesh = *qf.GetSpace()->GetMesh();
+   double err = 0.0;
+   DenseMatrix values, m;
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      ElementTransformation &T = *mesh.GetElementTransformation(e);
+      const IntegrationRule &ir = qf.GetElementIntRule(e);
+      qf.GetElementValues(e, values);
+      for (int i = 0; i < ir.GetNPoints(); i++)
+      {
+         T.SetIntPoint(&ir.IntPoint(i));
+         c.Eval(m, T, ir.IntPoint(i));
+         for (int j = 0; j < m.Height()*m.Width(); j++)
+         {
+            err = std::max(err, fabs(values(j,i) - m.Data()[j]));
+         }
+      }
+   }
+   return err;
+}
+
+void TestProject(Mesh &mesh, QuadratureSpace &qs)
+{
+   const int dim = mesh.Dimension();
+   const double tol = 1e-12;
+
+   H1_FECollection h1_fec(3, dim);
+   FiniteElementSpace fes(&mesh, &h1_fec);
+   FiniteElementSpace vfes(&mesh, &h1_fec, dim);
+   L2_FECollection l2_fec(2, dim);
+   FiniteElementSpace l2_fes(&mesh, &l2_fec);
+   RT_FECollection rt_fec(1, dim);
+   FiniteElementSpace rt_fes(&mesh, &rt_fec);
+
+   FunctionCoefficient f_coeff(scalar_func);
+   VectorFunctionCoefficient vf_coeff(dim, vector_func);
+
+   GridFunction u(&fes), vu(&vfes), l2u(&l2_fes), rtu(&rt_fes);
+   u.ProjectCoefficient(f_coeff);
+   vu.ProjectCoefficient(vf_coeff);
+   l2u.ProjectCoefficient(f_coeff);
+   rtu.ProjectCoefficient(vf_coeff);
+
+   QuadratureFunction qf(&qs), vqf(&qs, dim), mqf(&qs, dim*dim);
+
+   SECTION("Scalar coefficients")
+   {
+      ConstantCoefficient c_coeff(2.5);
+      REQUIRE(ProjectError(c_coeff, qf) == 0.0);
+
+      Vector pw(mesh.attributes.Max());
+      for (int i = 0; i < pw.Size(); i++) { pw(i) = i + 1; }
+      PWConstCoefficient pw_coeff(pw);
+      REQUIRE(ProjectError(pw_coeff, qf) == 0.0);
+
+      REQUIRE(ProjectError(f_coeff, qf) < tol);
+
+      FunctionCoefficient td_coeff(scalar_td_func);
+      td_coeff.SetTime(0.5);
+      REQUIRE(ProjectError(td_coeff, qf) < tol);
+
+      GridFunctionCoefficient gf_coeff(&u);
+      REQUIRE(ProjectError(gf_coeff, qf) < tol);
+
+      GridFunctionCoefficient vgf_coeff(&vu, dim);
+      REQUIRE(ProjectError(vgf_coeff, qf) < tol);
+
+      GridFunctionCoefficient l2_coeff(&l2u);
+      REQUIRE(ProjectError(l2_coeff, qf) < tol);
+
+      ProductCoefficient prod_coeff(f_coeff, gf_coeff);
+      REQUIRE(ProjectError(prod_coeff, qf) < tol);
+   }
+
+   SECTION("Vector coefficients")
+   {
+      Vector v(dim);
+      v.Randomize(1);
+      VectorConstantCoefficient c_coeff(v);
+      REQUIRE(ProjectError(c_coeff, vqf) == 0.0);
+
+      REQUIRE(ProjectError(vf_coeff, vqf) < tol);
+
+      VectorFunctionCoefficient scaled_coeff(dim, vector_func, &f_coeff);
+      REQUIRE(ProjectError(scaled_coeff, vqf) < tol);
+
+      VectorGridFunctionCoefficient gf_coeff(&vu);
+      REQUIRE(ProjectError(gf_coeff, vqf) < tol);
+
+      VectorGridFunctionCoefficient rt_coeff(&rtu);
+      REQUIRE(ProjectError(rt_coeff, vqf) < tol);
+   }
+
+   SECTION("Matrix coefficients")
+   {
+      DenseMatrix m(dim);
+      for (int j = 0; j < dim*dim; j++) { m.Data()[j] = j + 0.5; }
+      MatrixConstantCoefficient c_coeff(m);
+      REQUIRE(ProjectError(c_coeff, mqf) == 0.0);
+
+      MatrixFunctionCoefficient mf_coeff(dim, matrix_func);
+      REQUIRE(ProjectError(mf_coeff, mqf) < tol);
+
+      MatrixFunctionCoefficient scaled_coeff(dim, matrix_func, &f_coeff);
+      REQUIRE(ProjectError(scaled_coeff, mqf) < tol);
+
+      MatrixFunctionCoefficient const_coeff(m, f_coeff);
+      REQUIRE(ProjectError(const_coeff, mqf) < tol);
+   }
+}
+
+} // namespace coefficient_project
+
+using namespace coefficient_project;
+
+TEST_CASE("Coefficient projection on QuadratureSpaces",
+          "[Coefficient][QuadratureFunction]")
+{
+   SECTION("Quadrilateral mesh, uniform rule")
+   {
+      Mesh mesh(3, 3, Element::QUADRILATERAL, true, 1.0, 2.0);
+      mesh.SetCurvature(2);
+      mesh.Transform(perturb);
+      const IntegrationRule &ir = IntRules.Get(Geometry::SQUARE, 7);
+      QuadratureSpace qs(&mesh, ir);
+      REQUIRE(qs.GetUniformIntRule() == &ir);
+      REQUIRE(qs.GetSize() == mesh.GetNE()*ir.GetNPoints());
+      TestProject(mesh, qs);
+   }
+
+   SECTION("Tetrahedral mesh")
+   {
+      Mesh mesh(2, 2, 2, Element::TETRAHEDRON, true);
+      QuadratureSpace qs(&mesh, 4);
+      REQUIRE(qs.GetUniformIntRule() != NULL);
+      TestProject(mesh, qs);
+   }
+
+   SECTION("Mixed mesh")
+   {
+      Mesh mesh("../../data/star-mixed.mesh");
+      QuadratureSpace qs(&mesh, 3);
+      REQUIRE(qs.GetUniformIntRule() == NULL);
+      TestProject(mesh, qs);
+   }
+}
+
+TEST_CASE("Coefficient projection on moving meshes",
+          "[Coefficient][QuadratureFunction]")
+{
+   const double tol = 1e-12;
+   FunctionCoefficient f_coeff(scalar_func);
+   VectorFunctionCoefficient vf_coeff(2, vector_func);
+
+   SECTION("Curved mesh")
+   {
+      Mesh mesh(3, 3, Element::QUADRILATERAL, true, 1.0, 2.0);
+      mesh.SetCurvature(2);
+      QuadratureSpace qs(&mesh, 5);
+      QuadratureFunction qf(&qs), vqf(&qs, 2);
+      REQUIRE(ProjectError(f_coeff, qf) < tol);
+      REQUIRE(ProjectError(vf_coeff, vqf) < tol);
+
+      // The projections must use the current coordinates of the nodes
+      Vector disp(*mesh.GetNodes());
+      disp *= 0.5;
+      mesh.MoveNodes(disp);
+      REQUIRE(ProjectError(f_coeff, qf) < tol);
+      REQUIRE(ProjectError(vf_coeff, vqf) < tol);
+
+      mesh.Transform(perturb);
+      REQUIRE(ProjectError(f_coeff, qf) < tol);
+      REQUIRE(ProjectError(vf_coeff, vqf) < tol);
+   }
+
+   SECTION("Linear mesh without nodes")
+   {
+      Mesh mesh(3, 3, Element::TRIANGLE, true, 1.0, 2.0);
+      QuadratureSpace qs(&mesh, 4);
+      QuadratureFunction qf(&qs), vqf(&qs, 2);
+      REQUIRE(ProjectError(f_coeff, qf) < tol);
+      REQUIRE(ProjectError(vf_coeff, vqf) < tol);
+      REQUIRE(mesh.GetNodes() == NULL);
+
+      Vector disp(2*mesh.GetNV());
+      disp.Randomize(1);
+      disp *= 0.1;
+      mesh.MoveVertices(disp);
+      REQUIRE(ProjectError(f_coeff, qf) < tol);
+      REQUIRE(ProjectError(vf_coeff, vqf) < tol);
+      REQUIRE(mesh.GetNodes() == NULL);
+   }
+}
+
+TEST_CASE("QuadratureFunction save and load",
+          "[Coefficient][QuadratureFunction]")
+{
+   Mesh mesh(3, 2, Element::QUADRILATERAL, true, 1.0, 2.0);
+   FunctionCoefficient f_coeff(scalar_func);
+   IntegrationRules gl_rules(0, Quadrature1D::GaussLobatto);
+   const IntegrationRule &custom_ir = gl_rules.Get(Geometry::SQUARE, 5);
+   QuadratureSpace default_qs(&mesh, 3), custom_qs(&mesh, custom_ir);
+
+   QuadratureSpace *spaces[2] = { &default_qs, &custom_qs };
+   for (int s = 0; s < 2; s++)
+   {
+      CAPTURE(s);
+      QuadratureFunction qf(spaces[s]);
+      f_coeff.Project(qf);
+
+      std::stringstream str;
+      str.precision(17);
+      qf.Save(str);
+      if (s == 1)
+      {
+         REQUIRE(str.str().find("custom_quadrature") != std::string::npos);
+      }
+      QuadratureFunction qf_new(&mesh, str);
+
+      const IntegrationRule *ir = spaces[s]->GetUniformIntRule();
+      const IntegrationRule *ir_new = qf_new.GetSpace()->GetUniformIntRule();
+      REQUIRE(ir_new != NULL);
+      REQUIRE(ir_new->GetNPoints() == ir->GetNPoints());
+      for (int i = 0; i < ir->GetNPoints(); i++)
+      {
+         REQUIRE(ir_new->IntPoint(i).x == ir->IntPoint(i).x);
+         REQUIRE(ir_new->IntPoint(i).y == ir->IntPoint(i).y);
+         REQUIRE(ir_new->IntPoint(i).weight == ir->IntPoint(i).weight);
+      }
+      REQUIRE(qf_new.Size() == qf.Size());
+      qf_new -= qf;
+      REQUIRE(qf_new.Normlinf() < 1e-14);
+   }
+}
@@ -170,3 +170,187 @@ TEST_CASE("Save and load from collections", "[DataCollection]")
 #endif
    }
 }
+
+TEST_CASE("Save and load checkpoints", "[DataCollection]")
+{
+   Mesh mesh(3, 2, 2, Element::HEXAHEDRON, false, 2.0, 3.0, 1.0);
+   mesh.SetCurvature(2);
+   for (int i = 0; i < mesh.GetNE(); i++) { mesh.SetAttribute(i, 1 + i%2); }
+
+   H1_FECollection h1_fec(3, 3);
+   ND_FECollection nd_fec(2, 3);
+   FiniteElementSpace h1_fes(&mesh, &h1_fec, 3);
+   FiniteElementSpace nd_fes(&mesh, &nd_fec);
+   GridFunction u(&h1_fes), E(&nd_fes);
+   u.Randomize(1);
+   E.Randomize(2);
+
+   CheckpointDataCollection dc("checkpoint", &mesh);
+   dc.RegisterField("u", &u);
+   dc.RegisterField("E", &E);
+   dc.SetCycle(3);
+   dc.SetTime(1.5);
+   dc.SetTimeStep(0.25);
+   dc.SetPadDigits(5);
+   dc.Save();
+   REQUIRE(dc.Error() == DataCollection::NO_ERROR);
+
+   CheckpointDataCollection dc_new("checkpoint");
+   dc_new.SetPadDigits(5);
+   dc_new.Load(3);
+   REQUIRE(dc_new.Error() == DataCollection::NO_ERROR);
+   REQUIRE(dc_new.GetTime() == 1.5);
+   REQUIRE(dc_new.GetTimeStep() == 0.25);
+
+   Mesh *mesh_new = dc_new.GetMesh();
+   REQUIRE(mesh_new->GetNE() == mesh.GetNE());
+   REQUIRE(mesh_new->GetNBE() == mesh.GetNBE());
+   REQUIRE(mesh_new->GetNV() == mesh.GetNV());
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      REQUIRE(mesh_new->GetAttribute(i) == mesh.GetAttribute(i));
+   }
+
+   Vector nodes_diff(*mesh_new->GetNodes());
+   nodes_diff -= *mesh.GetNodes();
+   REQUIRE(nodes_diff.Normlinf() == 0.0);
+
+   GridFunction *u_new = dc_new.GetField("u");
+   GridFunction *E_new = dc_new.GetField("E");
+   REQUIRE(u_new);
+   REQUIRE(E_new);
+   REQUIRE(u_new->FESpace()->GetVDim() == 3);
+   Vector u_diff(*u_new), E_diff(*E_new);
+   u_diff -= u;
+   E_diff -= E;
+   REQUIRE(u_diff.Normlinf() == 0.0);
+   REQUIRE(E_diff.Normlinf() == 0.0);
+
+   REQUIRE(remove("checkpoint_00003/index") == 0);
+   REQUIRE(remove("checkpoint_00003/data.00000") == 0);
+   REQUIRE(rmdir("checkpoint_00003") == 0);
+}
+
+#ifdef MFEM_USE_MPI
+
+static double checkpoint_u(const Vector &x)
+{
+   return x(0)*x(0) - 2.0*x(0)*x(1) + x(1) + 0.5;
+}
+
+// Attribute of the element with center @a x
+static int checkpoint_attr(const Vector &x)
+{
+   return (x(0) + 2.0*x(1) < 1.5) ? 1 : 2;
+}
+
+static Vector ElementCenter(Mesh &mesh, int i)
+{
+   Vector x(mesh.SpaceDimension());
+   ElementTransformation *T = mesh.GetElementTransformation(i);
+   T->Transform(Geometries.GetCenter(mesh.GetElementBaseGeometry(i)), x);
+   return x;
+}
+
+// Save a checkpoint of a mesh and a field on the ranks of @a comm
+static void SaveParCheckpoint(MPI_Comm comm, int ranks_per_file)
+{
+   Mesh mesh(6, 5, Element::QUADRILATERAL, true, 2.0, 1.0);
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      mesh.SetAttribute(i, checkpoint_attr(ElementCenter(mesh, i)));
+   }
+   mesh.SetAttributes();
+   ParMesh pmesh(comm, mesh);
+
+   H1_FECollection fec(2, 2);
+   ParFiniteElementSpace fes(&pmesh, &fec);
+   ParGridFunction u(&fes);
+   FunctionCoefficient coeff(checkpoint_u);
+   u.ProjectCoefficient(coeff);
+
+   CheckpointDataCollection dc("pcheckpoint", &pmesh);
+   dc.RegisterField("u", &u);
+   dc.SetRanksPerFile(ranks_per_file);
+   dc.SetCycle(2);
+   dc.SetTime(0.5);
+   dc.SetPadDigits(5);
+   dc.Save();
+   REQUIRE(dc.Error() == DataCollection::NO_ERROR);
+}
+
+// Load the checkpoint of SaveParCheckpoint() on the ranks of @a comm
+static void LoadParCheckpoint(MPI_Comm comm)
+{
+   CheckpointDataCollection dc(comm, "pcheckpoint");
+   dc.SetPadDigits(5);
+   dc.Load(2);
+   REQUIRE(dc.Error() == DataCollection::NO_ERROR);
+   REQUIRE(dc.GetTime() == 0.5);
+
+   ParMesh *pmesh = dynamic_cast<ParMesh*>(dc.GetMesh());
+   REQUIRE(pmesh);
+   REQUIRE(pmesh->GetGlobalNE() == 30);
+   for (int i = 0; i < pmesh->GetNE(); i++)
+   {
+      REQUIRE(pmesh->GetAttribute(i) ==
+              checkpoint_attr(ElementCenter(*pmesh, i)));
+   }
+
+   ParGridFunction *u = dynamic_cast<ParGridFunction*>(dc.GetField("u"));
+   REQUIRE(u);
+   FunctionCoefficient coeff(checkpoint_u);
+   REQUIRE(u->ComputeMaxError(coeff) < 1e-12);
+}
+
+static void RemoveParCheckpoint()
+{
+   REQUIRE(remove("pcheckpoint_00002/index") == 0);
+   for (int f = 0; ; f++)
+   {
+      char name[64];
+      snprintf(name, sizeof(name), "pcheckpoint_00002/data.%05d", f);
+      if (remove(name) != 0) { break; }
+   }
+   REQUIRE(rmdir("pcheckpoint_00002") == 0);
+}
+
+// Save a checkpoint on N ranks and load it on M ranks
+TEST_CASE("Save and load parallel checkpoints", "[DataCollection], [Parallel]")
+{
+   int rank, size;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+   MPI_Comm_size(MPI_COMM_WORLD, &size);
+   const int nranks[3] = { size, (size + 1)/2, 1 };
+
+   for (int s = 0; s < 3; s++)
+   {
+      for (int l = 0; l < 3; l++)
+      {
+         const int n_save = nranks[s], n_load = nranks[l];
+         CAPTURE(n_save);
+         CAPTURE(n_load);
+         MPI_Comm save_comm, load_comm;
+         MPI_Comm_split(MPI_COMM_WORLD, rank < n_save ? 0 : MPI_UNDEFINED,
+                        rank, &save_comm);
+         MPI_Comm_split(MPI_COMM_WORLD, rank < n_load ? 0 : MPI_UNDEFINED,
+                        rank, &load_comm);
+         if (save_comm != MPI_COMM_NULL)
+         {
+            SaveParCheckpoint(save_comm, 1 + s);
+            MPI_Comm_free(&save_comm);
+         }
+         MPI_Barrier(MPI_COMM_WORLD);
+         if (load_comm != MPI_COMM_NULL)
+         {
+            LoadParCheckpoint(load_comm);
+            MPI_Comm_free(&load_comm);
+         }
+         MPI_Barrier(MPI_COMM_WORLD);
+         if (rank == 0) { RemoveParCheckpoint(); }
+         MPI_Barrier(MPI_COMM_WORLD);
+      }
+   }
+}
+
+#endif // MFEM_USE_MPI
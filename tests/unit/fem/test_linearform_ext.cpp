@@ -0,0 +1,224 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "catch.hpp"
+
+using namespace mfem;
+
+namespace linearform_ext
+{
+
+static void map(const Vector &x, Vector &y)
+{
+   y = x;
+   y(0) = x(0) + 0.1*sin(3.0*x(1));
+   y(1) = x(1) + 0.05*x(0)*x(0);
+}
+
+static double f(const Vector &x)
+{
+   double r = 1.0;
+   for (int d = 0; d < x.Size(); d++) { r += cos(x(d) + d); }
+   return r;
+}
+
+static void vf(const Vector &x, Vector &y)
+{
+   for (int d = 0; d < y.Size(); d++) { y(d) = f(x) * (d + 1) + x(d); }
+}
+
+static Mesh *MakeMesh(int dim, bool simplex)
+{
+   Mesh *mesh;
+   if (dim == 2)
+   {
+      mesh = new Mesh(3, 3, simplex ? Element::TRIANGLE :
+                      Element::QUADRILATERAL, true);
+   }
+   else
+   {
+      mesh = new Mesh(2, 2, 2, simplex ? Element::TETRAHEDRON :
+                      Element::HEXAHEDRON, true);
+      if (simplex) { mesh->ReorientTetMesh(); }
+   }
+   mesh->Transform(map);
+   return mesh;
+}
+
+// Assemble @a lf with and without fast assembly and compare the results
+static void TestFastAssembly(LinearForm &lf)
+{
+   lf.Assemble();
+   Vector b_ref(lf);
+
+   lf.UseFastAssembly(true);
+   lf.Assemble();
+   b_ref -= lf;
+   REQUIRE(b_ref.Normlinf() < 1e-12 * lf.Normlinf());
+   lf.UseFastAssembly(false);
+}
+
+TEST_CASE("LinearForm fast assembly", "[LinearForm]")
+{
+   for (int dim = 2; dim <= 3; dim++)
+   {
+      for (int simplex = 0; simplex <= 1; simplex++)
+      {
+         for (int order = 1; order <= 3; order++)
+         {
+            CAPTURE(dim);
+            CAPTURE(simplex);
+            CAPTURE(order);
+            Mesh *mesh = MakeMesh(dim, simplex);
+            FunctionCoefficient fcoeff(f);
+            ConstantCoefficient two(2.0);
+            VectorFunctionCoefficient vcoeff(dim, vf);
+            Array<int> bdr_marker(mesh->bdr_attributes.Max());
+            bdr_marker = 0;
+            bdr_marker[0] = 1;
+
+            // Scalar H1
+            {
+               H1_FECollection fec(order, dim);
+               FiniteElementSpace fes(mesh, &fec);
+               LinearForm lf(&fes);
+               lf.AddDomainIntegrator(new DomainLFIntegrator(fcoeff));
+               lf.AddDomainIntegrator(new DomainLFIntegrator(two));
+               lf.AddBoundaryIntegrator(new BoundaryLFIntegrator(fcoeff));
+               lf.AddBoundaryIntegrator(new BoundaryLFIntegrator(two),
+                                        bdr_marker);
+               TestFastAssembly(lf);
+            }
+
+            // Vector H1
+            for (int ordering = 0; ordering <= 1; ordering++)
+            {
+               H1_FECollection fec(order, dim);
+               FiniteElementSpace fes(mesh, &fec, dim, ordering);
+               LinearForm lf(&fes);
+               lf.AddDomainIntegrator(new VectorDomainLFIntegrator(vcoeff));
+               TestFastAssembly(lf);
+            }
+
+            // Nedelec and Raviart-Thomas
+            {
+               ND_FECollection nd_fec(order, dim);
+               FiniteElementSpace nd_fes(mesh, &nd_fec);
+               LinearForm nd_lf(&nd_fes);
+               nd_lf.AddDomainIntegrator(new VectorFEDomainLFIntegrator(vcoeff));
+               TestFastAssembly(nd_lf);
+
+               RT_FECollection rt_fec(order-1, dim);
+               FiniteElementSpace rt_fes(mesh, &rt_fec);
+               LinearForm rt_lf(&rt_fes);
+               rt_lf.AddDomainIntegrator(new VectorFEDomainLFIntegrator(vcoeff));
+               TestFastAssembly(rt_lf);
+            }
+
+            delete mesh;
+         }
+      }
+   }
+}
+
+// Integrators that opt out of threaded assembly, so that LinearForm::Assemble()
+// uses the serial element loop
+class SerialDomainLFIntegrator : public DomainLFIntegrator
+{
+public:
+   SerialDomainLFIntegrator(Coefficient &Q) : DomainLFIntegrator(Q) { }
+   virtual bool SupportsThreadedAssembly() const { return false; }
+};
+
+class SerialVectorDomainLFIntegrator : public VectorDomainLFIntegrator
+{
+public:
+   SerialVectorDomainLFIntegrator(VectorCoefficient &Q)
+      : VectorDomainLFIntegrator(Q) { }
+   virtual bool SupportsThreadedAssembly() const { return false; }
+};
+
+class SerialVectorFEDomainLFIntegrator : public VectorFEDomainLFIntegrator
+{
+public:
+   SerialVectorFEDomainLFIntegrator(VectorCoefficient &Q)
+      : VectorFEDomainLFIntegrator(Q) { }
+   virtual bool SupportsThreadedAssembly() const { return false; }
+};
+
+static void CheckEqual(const Vector &a, const Vector &b)
+{
+   Vector diff(a);
+   diff -= b;
+   REQUIRE(diff.Normlinf() < 1e-12 * b.Normlinf());
+}
+
+// With MFEM_USE_THREADED_ASSEMBLY, the integrators supporting threaded
+// assembly are assembled with colored OpenMP loops; compare them with the
+// serial loop.
+TEST_CASE("LinearForm threaded assembly", "[LinearForm]")
+{
+   for (int dim = 2; dim <= 3; dim++)
+   {
+      for (int simplex = 0; simplex <= 1; simplex++)
+      {
+         CAPTURE(dim);
+         CAPTURE(simplex);
+         Mesh *mesh = MakeMesh(dim, simplex);
+         mesh->UniformRefinement();
+         if (dim == 2) { mesh->UniformRefinement(); }
+         if (dim == 3 && simplex) { mesh->ReorientTetMesh(); }
+         const int order = 2;
+         FunctionCoefficient fcoeff(f);
+         VectorFunctionCoefficient vcoeff(dim, vf);
+
+         H1_FECollection fec(order, dim);
+         FiniteElementSpace fes(mesh, &fec);
+         LinearForm lf(&fes), lf_serial(&fes), lf_mixed(&fes);
+         lf.AddDomainIntegrator(new DomainLFIntegrator(fcoeff));
+         lf.Assemble();
+         lf_serial.AddDomainIntegrator(new SerialDomainLFIntegrator(fcoeff));
+         lf_serial.Assemble();
+         CheckEqual(lf, lf_serial);
+
+         // One integrator without threaded assembly disables it for all
+         lf_mixed.AddDomainIntegrator(new DomainLFIntegrator(fcoeff));
+         lf_mixed.AddDomainIntegrator(new SerialDomainLFIntegrator(fcoeff));
+         lf_mixed.Assemble();
+         lf_serial *= 2.0;
+         CheckEqual(lf_mixed, lf_serial);
+
+         FiniteElementSpace vfes(mesh, &fec, dim);
+         LinearForm vlf(&vfes), vlf_serial(&vfes);
+         vlf.AddDomainIntegrator(new VectorDomainLFIntegrator(vcoeff));
+         vlf.Assemble();
+         vlf_serial.AddDomainIntegrator(
+            new SerialVectorDomainLFIntegrator(vcoeff));
+         vlf_serial.Assemble();
+         CheckEqual(vlf, vlf_serial);
+
+         ND_FECollection nd_fec(order, dim);
+         FiniteElementSpace nd_fes(mesh, &nd_fec);
+         LinearForm nd_lf(&nd_fes), nd_lf_serial(&nd_fes);
+         nd_lf.AddDomainIntegrator(new VectorFEDomainLFIntegrator(vcoeff));
+         nd_lf.Assemble();
+         nd_lf_serial.AddDomainIntegrator(
+            new SerialVectorFEDomainLFIntegrator(vcoeff));
+         nd_lf_serial.Assemble();
+         CheckEqual(nd_lf, nd_lf_serial);
+
+         delete mesh;
+      }
+   }
+}
+
+} // namespace linearform_ext
@@ -0,0 +1,211 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "catch.hpp"
+
+#include <vector>
+
+using namespace mfem;
+
+namespace lp_error
+{
+
+static double func(const Vector &x)
+{
+   double f = 0.5;
+   for (int d = 0; d < x.Size(); d++) { f += sin((d + 1)*x(d)); }
+   return f;
+}
+
+static void vfunc(const Vector &x, Vector &v)
+{
+   for (int d = 0; d < v.Size(); d++) { v(d) = func(x) + d*x(d)*x(d); }
+}
+
+static double wfunc(const Vector &x) { return 1.0 + x(0); }
+
+static void vwfunc(const Vector &x, Vector &v)
+{
+   for (int d = 0; d < v.Size(); d++) { v(d) = 1.0 + d - x(0); }
+}
+
+static void CheckClose(double a, double b)
+{
+   REQUIRE(std::abs(a - b) <= 1e-12*std::max(1.0, std::abs(b)));
+}
+
+// The errors of the GridFunctions @a u (scalar) and @a uv (vector), computed
+// either with the element loop or with the batched kernels.
+static void ComputeErrors(GridFunction &u, GridFunction &uv,
+                          std::vector<double> &errors)
+{
+   const int sdim = u.FESpace()->GetMesh()->SpaceDimension();
+   const int ne = u.FESpace()->GetNE();
+   FunctionCoefficient exsol(func), weight(wfunc);
+   VectorFunctionCoefficient vexsol(sdim, vfunc), v_weight(sdim, vwfunc);
+   Array<int> elems(ne);
+   for (int i = 0; i < ne; i++) { elems[i] = i % 2; }
+
+   errors.clear();
+   const double ps[3] = { 1.0, 2.0, infinity() };
+   for (int k = 0; k < 3; k++)
+   {
+      errors.push_back(u.ComputeLpError(ps[k], exsol));
+      errors.push_back(u.ComputeLpError(ps[k], exsol, &weight));
+      errors.push_back(uv.ComputeLpError(ps[k], vexsol));
+      errors.push_back(uv.ComputeLpError(ps[k], vexsol, &weight));
+      errors.push_back(uv.ComputeLpError(ps[k], vexsol, NULL, &v_weight));
+   }
+   errors.push_back(uv.ComputeL2Error(vexsol, NULL, &elems));
+
+   Vector elem_errors(ne);
+   u.ComputeElementLpErrors(3.0, exsol, elem_errors, &weight);
+   errors.insert(errors.end(), elem_errors.GetData(),
+                 elem_errors.GetData() + ne);
+   uv.ComputeElementMaxErrors(vexsol, elem_errors);
+   errors.insert(errors.end(), elem_errors.GetData(),
+                 elem_errors.GetData() + ne);
+   uv.ComputeElementL2Errors(vexsol, elem_errors);
+   errors.insert(errors.end(), elem_errors.GetData(),
+                 elem_errors.GetData() + ne);
+}
+
+TEST_CASE("Batched Lp errors", "[GridFunction]")
+{
+   for (int dim = 2; dim <= 3; dim++)
+   {
+      for (int type = 0; type <= 1; type++)
+      {
+         for (int dg = 0; dg <= 1; dg++)
+         {
+            CAPTURE(dim);
+            CAPTURE(type);
+            CAPTURE(dg);
+            const int order = 2;
+            Mesh *mesh;
+            if (dim == 2)
+            {
+               mesh = new Mesh(4, 3, type ? Element::TRIANGLE :
+                               Element::QUADRILATERAL, true, 1.5, 1.0);
+            }
+            else
+            {
+               mesh = new Mesh(2, 3, 2, type ? Element::TETRAHEDRON :
+                               Element::HEXAHEDRON, true, 1.5, 1.0, 1.0);
+            }
+            FiniteElementCollection *fec;
+            if (dg) { fec = new L2_FECollection(order, dim); }
+            else { fec = new H1_FECollection(order, dim); }
+
+            // Without mesh nodes, the errors are computed with the element
+            // loop, with linear nodes, with the batched kernels
+            std::vector<double> errors[2];
+            for (int curved = 0; curved <= 1; curved++)
+            {
+               if (curved) { mesh->SetCurvature(1); }
+               FiniteElementSpace fes(mesh, fec), vfes(mesh, fec, dim);
+               GridFunction u(&fes), uv(&vfes);
+               FunctionCoefficient exsol(func);
+               VectorFunctionCoefficient vexsol(dim, vfunc);
+               u.ProjectCoefficient(exsol);
+               uv.ProjectCoefficient(vexsol);
+               // Perturb the fields, so that the errors are not too small
+               for (int i = 0; i < u.Size(); i++) { u(i) += 0.01*(i % 3); }
+               for (int i = 0; i < uv.Size(); i++) { uv(i) -= 0.02*(i % 5); }
+               ComputeErrors(u, uv, errors[curved]);
+            }
+            REQUIRE(errors[0].size() == errors[1].size());
+            double max_error = 0.0;
+            for (size_t i = 0; i < errors[0].size(); i++)
+            {
+               CAPTURE(i);
+               CheckClose(errors[1][i], errors[0][i]);
+               max_error = std::max(max_error, errors[0][i]);
+            }
+            REQUIRE(max_error > 1e-3);
+
+            delete fec;
+            delete mesh;
+         }
+      }
+   }
+}
+
+TEST_CASE("Batched Lp errors of moving meshes", "[GridFunction]")
+{
+   // The errors must follow the mesh nodes, even if they are modified
+   // between two calls
+   Mesh mesh(3, 3, Element::QUADRILATERAL, true);
+   mesh.SetCurvature(2);
+   H1_FECollection fec(2, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+   GridFunction u(&fes);
+   u = 0.0;
+   ConstantCoefficient one(1.0);
+   CheckClose(u.ComputeL1Error(one), 1.0);
+   *mesh.GetNodes() *= 2.0;
+   CheckClose(u.ComputeL1Error(one), 4.0);
+   CheckClose(u.ComputeL2Error(one), 2.0);
+   CheckClose(u.ComputeMaxError(one), 1.0);
+
+   // Vector finite elements use the element loop
+   ND_FECollection nd_fec(2, 2);
+   FiniteElementSpace nd_fes(&mesh, &nd_fec);
+   GridFunction und(&nd_fes);
+   und = 0.0;
+   Vector unit(2);
+   unit(0) = 0.6;
+   unit(1) = 0.8;
+   VectorConstantCoefficient vone(unit);
+   CheckClose(und.ComputeL2Error(vone), 2.0);
+}
+
+static double linear_func(const Vector &x) { return x(0) + 2.0*x(1); }
+
+TEST_CASE("Batched Lp errors after MoveNodes", "[GridFunction]")
+{
+   // The exact solution must be evaluated at the current coordinates of the
+   // quadrature points, after the nodes are moved
+   Mesh mesh(3, 3, Element::QUADRILATERAL, true);
+   mesh.SetCurvature(2);
+   H1_FECollection fec(2, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+   GridFunction u(&fes);
+   FunctionCoefficient exsol(linear_func);
+
+   // The layout of the QuadratureInterpolator used for the errors must be
+   // preserved
+   const IntegrationRule &ir = IntRules.Get(Geometry::SQUARE, 2*2 + 3);
+   const QuadratureInterpolator *qi = fes.GetQuadratureInterpolator(ir);
+   qi->SetOutputLayout(QVectorLayout::byVDIM);
+
+   u.ProjectCoefficient(exsol);
+   REQUIRE(u.ComputeL2Error(exsol) < 1e-12);
+   REQUIRE(qi->GetOutputLayout() == QVectorLayout::byVDIM);
+
+   Vector disp(*mesh.GetNodes());
+   disp *= 0.5;
+   mesh.MoveNodes(disp);
+   u.ProjectCoefficient(exsol);
+   REQUIRE(u.ComputeL2Error(exsol) < 1e-12);
+   REQUIRE(u.ComputeMaxError(exsol) < 1e-12);
+
+   // The mesh without nodes is not modified
+   Mesh lin_mesh(3, 3, Element::QUADRILATERAL, true);
+   FiniteElementSpace lin_fes(&lin_mesh, &fec);
+   GridFunction lin_u(&lin_fes);
+   lin_u.ProjectCoefficient(exsol);
+   REQUIRE(lin_u.ComputeL2Error(exsol) < 1e-12);
+   REQUIRE(lin_mesh.GetNodes() == NULL);
+}
+
+} // namespace lp_error
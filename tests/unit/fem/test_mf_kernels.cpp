@@ -0,0 +1,96 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "catch.hpp"
+#include "mfem.hpp"
+
+using namespace mfem;
+
+namespace mf_kernels
+{
+
+void test_mf(Mesh &&mesh, int order, const int pb)
+{
+   mesh.EnsureNodes();
+   int dim = mesh.Dimension();
+
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fespace(&mesh, &fec);
+
+   BilinearForm k_mf(&fespace);
+   BilinearForm k_fa(&fespace);
+
+   ConstantCoefficient coeff(2.5);
+
+   if (pb == 0) // Mass
+   {
+      k_fa.AddDomainIntegrator(new MassIntegrator(coeff));
+      k_mf.AddDomainIntegrator(new MassIntegrator(coeff));
+   }
+   else if (pb == 1) // Diffusion
+   {
+      k_fa.AddDomainIntegrator(new DiffusionIntegrator(coeff));
+      k_mf.AddDomainIntegrator(new DiffusionIntegrator(coeff));
+   }
+   else if (pb == 2) // Mass + Diffusion
+   {
+      k_fa.AddDomainIntegrator(new MassIntegrator);
+      k_fa.AddDomainIntegrator(new DiffusionIntegrator(coeff));
+      k_mf.AddDomainIntegrator(new MassIntegrator);
+      k_mf.AddDomainIntegrator(new DiffusionIntegrator(coeff));
+   }
+
+   k_fa.Assemble();
+   k_fa.Finalize();
+
+   k_mf.SetAssemblyLevel(AssemblyLevel::NONE);
+   k_mf.Assemble();
+
+   GridFunction x(&fespace), y_fa(&fespace), y_mf(&fespace);
+
+   x.Randomize(1);
+
+   k_fa.Mult(x, y_fa);
+   k_mf.Mult(x, y_mf);
+
+   y_mf -= y_fa;
+   REQUIRE(y_mf.Normlinf() < 1.e-12 * std::max(y_fa.Normlinf(), 1.0));
+}
+
+TEST_CASE("Matrix-Free Assembly", "[MatrixFree]")
+{
+   SECTION("2D")
+   {
+      for (int pb : {0, 1, 2})
+      {
+         for (int order : {1, 2, 3, 4})
+         {
+            test_mf(Mesh("../../data/periodic-square.mesh", 1, 1), order, pb);
+            test_mf(Mesh("../../data/star-q3.mesh", 1, 1), order, pb);
+            test_mf(Mesh("../../data/amr-quad.mesh", 1, 1), order, pb);
+         }
+      }
+   }
+
+   SECTION("3D")
+   {
+      for (int pb : {0, 1, 2})
+      {
+         for (int order : {1, 2, 3})
+         {
+            test_mf(Mesh("../../data/periodic-cube.mesh", 1, 1), order, pb);
+            test_mf(Mesh("../../data/fichera-q3.mesh", 1, 1), order, pb);
+         }
+      }
+   }
+}
+
+} // namespace mf_kernels
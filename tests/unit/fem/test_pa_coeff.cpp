@@ -156,6 +156,67 @@ TEST_CASE("H1 pa_coeff")
    }
 }
 
+TEST_CASE("H1 simplex pa_coeff", "[PartialAssembly]")
+{
+   for (dimension = 2; dimension < 4; ++dimension)
+   {
+      Mesh *mesh = (dimension == 2) ?
+                   new Mesh(2, 2, Element::TRIANGLE, true) :
+                   new Mesh(2, 2, 2, Element::TETRAHEDRON, true);
+      if (dimension == 3) { mesh->ReorientTetMesh(); }
+      // Make the element Jacobians non-constant across the mesh
+      mesh->EnsureNodes();
+      GridFunction *nodes = mesh->GetNodes();
+      for (int i = 0; i < nodes->Size(); i++)
+      {
+         (*nodes)(i) += 0.05*sin(7.0*i);
+      }
+
+      FunctionCoefficient coeff(&coeffFunction);
+      for (int integrator = 0; integrator < 3; ++integrator)
+      {
+         for (int order = 1; order < 6; ++order)
+         {
+            H1_FECollection fec(order, dimension);
+            FiniteElementSpace fespace(mesh, &fec);
+
+            BilinearForm paform(&fespace);
+            BilinearForm assemblyform(&fespace);
+            paform.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+            if (integrator < 2)
+            {
+               paform.AddDomainIntegrator(new DiffusionIntegrator(coeff));
+               assemblyform.AddDomainIntegrator(new DiffusionIntegrator(coeff));
+            }
+            if (integrator > 0)
+            {
+               paform.AddDomainIntegrator(new MassIntegrator(coeff));
+               assemblyform.AddDomainIntegrator(new MassIntegrator(coeff));
+            }
+            paform.Assemble();
+            assemblyform.Assemble();
+            assemblyform.Finalize();
+
+            Vector xin(fespace.GetVSize());
+            xin.Randomize();
+            Vector y_pa(fespace.GetVSize()), y_mat(fespace.GetVSize());
+            paform.Mult(xin, y_pa);
+            assemblyform.SpMat().Mult(xin, y_mat);
+            y_pa -= y_mat;
+            REQUIRE(y_pa.Normlinf() < 1.e-12*y_mat.Normlinf());
+
+            Vector pa_diag(fespace.GetVSize()), mat_diag(fespace.GetVSize());
+            paform.AssembleDiagonal(pa_diag);
+            assemblyform.SpMat().GetDiag(mat_diag);
+            pa_diag -= mat_diag;
+            REQUIRE(pa_diag.Normlinf() < 1.e-12*mat_diag.Normlinf());
+         }
+      }
+
+      delete mesh;
+   }
+}
+
 TEST_CASE("Hcurl/Hdiv pa_coeff")
 {
    for (dimension = 2; dimension < 4; ++dimension)
@@ -481,4 +542,120 @@ TEST_CASE("Hcurl/Hdiv mixed pa_coeff")
    }
 }
 
+double tdFunction(const Vector &x, double t)
+{
+   return coeffFunction(x) + t*(x(0) + 1.0);
+}
+
+TEST_CASE("PA reassembly of coefficients", "[PartialAssembly]")
+{
+   for (dimension = 2; dimension < 4; ++dimension)
+   {
+      Mesh *mesh = (dimension == 2) ?
+                   new Mesh(3, 3, Element::QUADRILATERAL, true) :
+                   new Mesh(2, 2, 2, Element::HEXAHEDRON, true);
+      H1_FECollection fec(2, dimension);
+      FiniteElementSpace fes(mesh, &fec);
+
+      FunctionCoefficient q(tdFunction);
+      ConstantCoefficient c(2.0);
+      q.SetTime(0.0);
+
+      BilinearForm paform(&fes);
+      paform.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      paform.AddDomainIntegrator(new MassIntegrator(q));
+      paform.AddDomainIntegrator(new DiffusionIntegrator(q));
+      paform.AddDomainIntegrator(new DiffusionIntegrator(c));
+      paform.Assemble();
+
+      Vector x(fes.GetVSize()), y_pa(fes.GetVSize()), y_ref(fes.GetVSize());
+      x.Randomize(1);
+
+      for (int step = 1; step <= 2; step++)
+      {
+         q.SetTime(0.5*step);
+         c.constant = 2.0 + step;
+         paform.ReassembleCoefficients();
+         paform.Mult(x, y_pa);
+
+         BilinearForm refform(&fes);
+         refform.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+         refform.AddDomainIntegrator(new MassIntegrator(q));
+         refform.AddDomainIntegrator(new DiffusionIntegrator(q));
+         refform.AddDomainIntegrator(new DiffusionIntegrator(c));
+         refform.Assemble();
+         refform.Mult(x, y_ref);
+
+         y_pa -= y_ref;
+         REQUIRE(y_pa.Normlinf() <= 1e-12*y_ref.Normlinf());
+      }
+
+      delete mesh;
+   }
+}
+
+TEST_CASE("Hcurl/Hdiv simplex pa_coeff", "[PartialAssembly]")
+{
+   for (dimension = 2; dimension < 4; ++dimension)
+   {
+      Mesh *mesh = (dimension == 2) ?
+                   new Mesh(2, 2, Element::TRIANGLE, true) :
+                   new Mesh(2, 2, 2, Element::TETRAHEDRON, true);
+      if (dimension == 3) { mesh->ReorientTetMesh(); }
+      // Make the element Jacobians non-constant across the mesh
+      mesh->EnsureNodes();
+      GridFunction *nodes = mesh->GetNodes();
+      for (int i = 0; i < nodes->Size(); i++)
+      {
+         (*nodes)(i) += 0.05*sin(7.0*i);
+      }
+
+      FunctionCoefficient coeff(&coeffFunction);
+      FunctionCoefficient coeff2(&linearFunction);
+
+      for (int spaceType = 0; spaceType < 2; ++spaceType)
+      {
+         for (int order = 1; order < 4; ++order)
+         {
+            FiniteElementCollection *fec = (spaceType == 0) ?
+                                           (FiniteElementCollection*) new ND_FECollection(order, dimension) :
+                                           (FiniteElementCollection*) new RT_FECollection(order-1, dimension);
+            FiniteElementSpace fespace(mesh, fec);
+
+            BilinearForm paform(&fespace);
+            BilinearForm assemblyform(&fespace);
+            paform.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+            paform.AddDomainIntegrator(new VectorFEMassIntegrator(coeff));
+            assemblyform.AddDomainIntegrator(new VectorFEMassIntegrator(coeff));
+            if (spaceType == 0)
+            {
+               paform.AddDomainIntegrator(new CurlCurlIntegrator(coeff2));
+               assemblyform.AddDomainIntegrator(new CurlCurlIntegrator(coeff2));
+            }
+            paform.Assemble();
+            assemblyform.Assemble();
+            assemblyform.Finalize();
+
+            Vector xin(fespace.GetVSize());
+            xin.Randomize();
+            Vector y_pa(fespace.GetVSize()), y_mat(fespace.GetVSize());
+            paform.Mult(xin, y_pa);
+            assemblyform.SpMat().Mult(xin, y_mat);
+            y_pa -= y_mat;
+            REQUIRE(y_pa.Normlinf() < 1.e-12*y_mat.Normlinf());
+
+            Vector pa_diag(fespace.GetVSize()), mat_diag(fespace.GetVSize());
+            paform.AssembleDiagonal(pa_diag);
+            assemblyform.SpMat().GetDiag(mat_diag);
+            pa_diag -= mat_diag;
+            REQUIRE(pa_diag.Normlinf() < 1.e-12*mat_diag.Normlinf());
+
+            delete fec;
+         }
+      }
+
+      delete mesh;
+   }
+}
+
 } // namespace pa_coeff
@@ -288,6 +288,69 @@ TEST_CASE("Nonlinear Convection", "[PartialAssembly], [NonlinearPA]")
    }
 }
 
+void hyperelastic_deformation(const Vector &x, Vector &y)
+{
+   y = x;
+   y(0) += 0.1 * x(0) * x(1);
+   y(1) += 0.05 * sin(M_PI * x(0));
+}
+
+double test_nl_hyperelastic_nd(int dim, HyperelasticModel &model)
+{
+   Mesh *mesh =
+      (dim == 2) ?
+      new Mesh(2, 2, Element::QUADRILATERAL, 0, 1.0, 1.0):
+      new Mesh(2, 2, 2, Element::HEXAHEDRON, 0, 1.0, 1.0, 1.0);
+
+   int order = 2;
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(mesh, &fec, dim);
+
+   Array<int> ess_bdr(mesh->bdr_attributes.Max());
+   ess_bdr = 0;
+   ess_bdr[0] = 1;
+
+   GridFunction x(&fes), dx(&fes), y_fa(&fes), y_pa(&fes);
+   VectorFunctionCoefficient deform(dim, hyperelastic_deformation);
+   x.ProjectCoefficient(deform);
+   dx.Randomize(3);
+
+   NonlinearForm nlf_fa(&fes);
+   nlf_fa.AddDomainIntegrator(new HyperelasticNLFIntegrator(&model));
+   nlf_fa.SetEssentialBC(ess_bdr);
+
+   NonlinearForm nlf_pa(&fes);
+   nlf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   nlf_pa.AddDomainIntegrator(new HyperelasticNLFIntegrator(&model));
+   nlf_pa.SetEssentialBC(ess_bdr);
+   nlf_pa.Setup();
+
+   nlf_fa.Mult(x, y_fa);
+   nlf_pa.Mult(x, y_pa);
+   y_fa -= y_pa;
+   double difference = y_fa.Norml2();
+
+   nlf_fa.GetGradient(x).Mult(dx, y_fa);
+   nlf_pa.GetGradient(x).Mult(dx, y_pa);
+   y_fa -= y_pa;
+   difference += y_fa.Norml2();
+
+   delete mesh;
+
+   return difference;
+}
+
+TEST_CASE("Nonlinear Hyperelasticity", "[PartialAssembly], [NonlinearPA]")
+{
+   NeoHookeanModel neo_hookean(1.0, 10.0);
+   InverseHarmonicModel inverse_harmonic;
+   for (int dim = 2; dim <= 3; dim++)
+   {
+      REQUIRE(test_nl_hyperelastic_nd(dim, neo_hookean) == Approx(0.0));
+      REQUIRE(test_nl_hyperelastic_nd(dim, inverse_harmonic) == Approx(0.0));
+   }
+}
+
 template <typename INTEGRATOR>
 double test_vector_pa_integrator(int dim)
 {
@@ -457,4 +520,126 @@ TEST_CASE("PA Convection", "[PartialAssembly]")
    }
 }//test case
 
+void test_pa_fused(Mesh &&mesh, int order)
+{
+   mesh.EnsureNodes();
+   int dim = mesh.Dimension();
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fespace(&mesh, &fec);
+
+   // Mass and diffusion support fusing the element restriction with the
+   // kernels, so the PA action below reads and writes the L-vectors directly.
+   ConstantCoefficient one(1.0), two(2.0);
+   BilinearForm k_pa(&fespace), k_fa(&fespace);
+   k_pa.AddDomainIntegrator(new MassIntegrator(two));
+   k_pa.AddDomainIntegrator(new DiffusionIntegrator(one));
+   k_fa.AddDomainIntegrator(new MassIntegrator(two));
+   k_fa.AddDomainIntegrator(new DiffusionIntegrator(one));
+   k_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   k_pa.Assemble();
+   k_fa.Assemble();
+   k_fa.Finalize();
+
+   GridFunction x(&fespace), y_pa(&fespace), y_fa(&fespace);
+   x.Randomize(1);
+   k_pa.Mult(x, y_pa);
+   k_fa.Mult(x, y_fa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() < 1e-12 * y_fa.Normlinf());
+}
+
+TEST_CASE("PA Fused Restriction", "[PartialAssembly]")
+{
+   SECTION("2D")
+   {
+      for (int order : {1, 2, 3, 4, 5})
+      {
+         test_pa_fused(Mesh("../../data/star-q3.mesh", 1, 1), order);
+         test_pa_fused(Mesh("../../data/amr-quad.mesh", 1, 1), order);
+      }
+   }
+
+   SECTION("3D")
+   {
+      for (int order : {1, 2, 3})
+      {
+         test_pa_fused(Mesh("../../data/fichera-q3.mesh", 1, 1), order);
+         test_pa_fused(Mesh("../../data/fichera-amr.mesh", 1, 1), order);
+      }
+      // Generic (non-specialized) kernel
+      test_pa_fused(Mesh("../../data/fichera-q3.mesh", 1, 1), 5);
+   }
+}
+
+#ifdef MFEM_USE_MPI
+
+void test_par_pa_convection(Mesh &&mesh, int order)
+{
+   int dim = mesh.Dimension();
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+   mesh.Clear();
+
+   L2_FECollection fec(order, dim, BasisType::GaussLobatto);
+   ParFiniteElementSpace fespace(&pmesh, &fec);
+
+   ParBilinearForm k_pa(&fespace);
+   ParBilinearForm k_fa(&fespace);
+
+   VectorFunctionCoefficient vel_coeff(dim, velocity_function);
+
+   AddConvectionIntegrators(k_fa, vel_coeff, true);
+   AddConvectionIntegrators(k_pa, vel_coeff, true);
+
+   k_fa.Assemble();
+   k_fa.Finalize();
+
+   k_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   k_pa.Assemble();
+
+   Array<int> ess_tdof_list;
+   OperatorPtr A_pa, A_fa;
+   k_pa.FormSystemMatrix(ess_tdof_list, A_pa);
+   k_fa.FormSystemMatrix(ess_tdof_list, A_fa);
+
+   // The PA action overlaps the face-neighbor exchange of x with the element
+   // kernels. Repeat it with a modified x to also check the reuse of the
+   // persistent exchange.
+   Vector x(fespace.GetTrueVSize());
+   Vector y_pa(fespace.GetTrueVSize()), y_fa(fespace.GetTrueVSize());
+   x.Randomize(1 + pmesh.GetMyRank());
+   for (int it = 0; it < 2; it++)
+   {
+      if (it == 1) { x *= -2.0; }
+      A_pa->Mult(x, y_pa);
+      A_fa->Mult(x, y_fa);
+      y_pa -= y_fa;
+
+      double err = y_pa.Normlinf(), max_err;
+      MPI_Allreduce(&err, &max_err, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      REQUIRE(max_err < 1.e-12);
+   }
+}
+
+TEST_CASE("Parallel PA Convection", "[PartialAssembly], [Parallel]")
+{
+   SECTION("2D")
+   {
+      for (int order : {1, 2, 3})
+      {
+         test_par_pa_convection(
+            Mesh(6, 6, Element::QUADRILATERAL, true, 1.0, 1.0), order);
+         test_par_pa_convection(Mesh("../../data/star-q3.mesh", 1, 1), order);
+      }
+   }
+
+   SECTION("3D")
+   {
+      int order = 2;
+      test_par_pa_convection(
+         Mesh(3, 3, 3, Element::HEXAHEDRON, true, 1.0, 1.0, 1.0), order);
+   }
+}
+
+#endif // MFEM_USE_MPI
+
 }// namespace pa_kernels
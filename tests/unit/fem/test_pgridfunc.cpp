@@ -0,0 +1,74 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "catch.hpp"
+#include "mfem.hpp"
+
+using namespace mfem;
+
+#ifdef MFEM_USE_MPI
+
+static double linear_func(const Vector &x) { return x(0) + 2.0*x(1); }
+
+// Value of linear_func() at the center of the face-neighbor element i
+static double nbr_center_value(ParMesh &pmesh, int i)
+{
+   const Element *el = pmesh.face_nbr_elements[i];
+   Vector c(2);
+   c = 0.0;
+   for (int k = 0; k < el->GetNVertices(); k++)
+   {
+      const double *v = pmesh.face_nbr_vertices[el->GetVertices()[k]]();
+      c(0) += v[0] / el->GetNVertices();
+      c(1) += v[1] / el->GetNVertices();
+   }
+   return linear_func(c);
+}
+
+TEST_CASE("ParGridFunction face-neighbor exchange", "[Parallel]")
+{
+   Mesh mesh(8, 8, Element::QUADRILATERAL, true, 1.0, 1.0);
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+   pmesh.ExchangeFaceNbrData();
+
+   L2_FECollection fec(0, 2);
+   ParFiniteElementSpace fes(&pmesh, &fec);
+   ParGridFunction x(&fes);
+   FunctionCoefficient coeff(linear_func);
+   x.ProjectCoefficient(coeff);
+
+   // Repeat the exchange to reuse the persistent requests. In the last one,
+   // the data is changed before the completion, which must not affect the
+   // exchanged values.
+   for (int it = 0; it < 3; it++)
+   {
+      x.ExchangeFaceNbrDataBegin();
+      if (it == 2) { x *= 2.0; }
+      x.ExchangeFaceNbrDataEnd();
+
+      const Vector &nbr_data = x.FaceNbrData();
+      double err = 0.0;
+      for (int i = 0; i < pmesh.face_nbr_elements.Size(); i++)
+      {
+         const double nbr_value = nbr_center_value(pmesh, i);
+         err = std::max(err, std::abs(nbr_data(i) - nbr_value));
+      }
+      REQUIRE(err < 1e-12);
+   }
+
+   x.ExchangeFaceNbrData();
+   for (int i = 0; i < pmesh.face_nbr_elements.Size(); i++)
+   {
+      REQUIRE(x.FaceNbrData()(i) == Approx(2.0*nbr_center_value(pmesh, i)));
+   }
+}
+
+#endif // MFEM_USE_MPI
@@ -0,0 +1,121 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "catch.hpp"
+
+using namespace mfem;
+
+namespace pmultigrid
+{
+
+class DiffusionBuilder : public BilinearFormBuilder
+{
+private:
+   Coefficient &q;
+
+public:
+   DiffusionBuilder(Coefficient &q_) : q(q_) { }
+
+   virtual void AddIntegrators(BilinearForm &form) const
+   {
+      form.AddDomainIntegrator(new DiffusionIntegrator(q));
+   }
+};
+
+double coeff(const Vector &x)
+{
+   return 1.0 + x(0)*x(0) + 0.5*x(1);
+}
+
+// Solve a diffusion problem with CG, preconditioned with p-multigrid, and
+// check the result against a solution with a fully assembled matrix.
+static int SolvePMultigrid(Mesh &mesh, int order, Vector &error)
+{
+   H1_FECollection fec(order, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_bdr(mesh.bdr_attributes.Max());
+   ess_bdr = 1;
+
+   FunctionCoefficient q(coeff);
+   ConstantCoefficient one(1.0);
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+
+   DiffusionBuilder builder(q);
+   PMultigridPreconditioner mg(fes, ess_bdr, builder);
+   REQUIRE(mg.NumLevels() == mg.GetFESpaceHierarchy().GetNumLevels());
+
+   GridFunction x(&fes);
+   x = 0.0;
+   OperatorPtr A;
+   Vector B, X;
+   mg.FormFineLinearSystem(x, b, A, X, B);
+
+   CGSolver cg;
+   cg.SetRelTol(1e-12);
+   cg.SetMaxIter(200);
+   cg.SetOperator(*A);
+   cg.SetPreconditioner(mg);
+   cg.Mult(B, X);
+   REQUIRE(cg.GetConverged());
+   mg.RecoverFineFEMSolution(X, b, x);
+
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(q));
+   a.Assemble();
+   Array<int> ess_tdof_list;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+   GridFunction x_ref(&fes);
+   x_ref = 0.0;
+   OperatorPtr A_ref;
+   Vector B_ref, X_ref;
+   a.FormLinearSystem(ess_tdof_list, x_ref, b, A_ref, X_ref, B_ref);
+   GSSmoother gs(*A_ref.As<SparseMatrix>());
+   PCG(*A_ref, gs, B_ref, X_ref, -1, 2000, 1e-24, 0.0);
+   a.RecoverFEMSolution(X_ref, b, x_ref);
+
+   error = x;
+   error -= x_ref;
+   return cg.GetNumIterations();
+}
+
+TEST_CASE("PMultigridPreconditioner", "[PMultigrid]")
+{
+   for (int order : {1, 2, 3, 4, 6})
+   {
+      for (int simplex = 0; simplex <= 1; simplex++)
+      {
+         CAPTURE(order);
+         CAPTURE(simplex);
+         Mesh mesh(6, 6, simplex ? Element::TRIANGLE : Element::QUADRILATERAL,
+                   true);
+         Vector error;
+         const int iter = SolvePMultigrid(mesh, order, error);
+         // Jacobi-based smoothing is less effective on high order simplices
+         REQUIRE(iter <= (simplex ? 60 : 30));
+         REQUIRE(error.Normlinf() < 1e-10);
+      }
+   }
+
+   SECTION("3D")
+   {
+      Mesh mesh(3, 3, 3, Element::HEXAHEDRON, true);
+      Vector error;
+      const int iter = SolvePMultigrid(mesh, 4, error);
+      REQUIRE(iter <= 30);
+      REQUIRE(error.Normlinf() < 1e-10);
+   }
+}
+
+} // namespace pmultigrid
@@ -0,0 +1,281 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "catch.hpp"
+
+using namespace mfem;
+
+namespace reorder_dofs
+{
+
+double func(const Vector &x)
+{
+   double r = 1.0;
+   for (int d = 0; d < x.Size(); d++) { r += sin((d + 1)*x(d)); }
+   return r;
+}
+
+void vfunc(const Vector &x, Vector &v)
+{
+   for (int d = 0; d < v.Size(); d++) { v(d) = func(x) + d; }
+}
+
+// Scramble the element order of the mesh, as e.g. in meshes from Gmsh
+void Scramble(Mesh &mesh)
+{
+   const int ne = mesh.GetNE(), p = 7919; // p is prime and ne < p
+   Array<int> ordering(ne);
+   for (int i = 0; i < ne; i++) { ordering[i] = (i*p) % ne; }
+   mesh.ReorderElements(ordering);
+}
+
+int Decode(int dof) { return (dof >= 0) ? dof : -1 - dof; }
+
+// Map a signed DOF through the old -> new map, preserving the sign
+int MapDof(const Array<int> &map, int dof)
+{
+   return (dof >= 0) ? map[dof] : -1 - map[-1 - dof];
+}
+
+// Check that all DOF accessors of 'fes' agree with the ones of 'fes_ref' up to
+// a single permutation and return that permutation.
+void CheckConsistent(FiniteElementSpace &fes_ref, FiniteElementSpace &fes,
+                     Array<int> &map)
+{
+   Mesh &mesh = *fes.GetMesh();
+   REQUIRE(fes.GetNDofs() == fes_ref.GetNDofs());
+
+   map.SetSize(fes.GetNDofs());
+   map = -1;
+   Array<int> dofs_ref, dofs;
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      fes_ref.GetElementDofs(e, dofs_ref);
+      fes.GetElementDofs(e, dofs);
+      REQUIRE(dofs.Size() == dofs_ref.Size());
+      for (int j = 0; j < dofs.Size(); j++)
+      {
+         // signs are preserved
+         REQUIRE((dofs[j] >= 0) == (dofs_ref[j] >= 0));
+         int &m = map[Decode(dofs_ref[j])];
+         if (m < 0) { m = Decode(dofs[j]); }
+         REQUIRE(m == Decode(dofs[j]));
+      }
+   }
+   // the map is a permutation
+   Array<int> marker(map.Size());
+   marker = 0;
+   for (int i = 0; i < map.Size(); i++)
+   {
+      REQUIRE(map[i] >= 0);
+      marker[map[i]]++;
+   }
+   REQUIRE(marker.Min() == 1);
+   REQUIRE(marker.Max() == 1);
+
+   auto check = [&](int n, void (FiniteElementSpace::*get)(int, Array<int>&)
+                    const)
+   {
+      for (int i = 0; i < n; i++)
+      {
+         (fes_ref.*get)(i, dofs_ref);
+         (fes.*get)(i, dofs);
+         REQUIRE(dofs.Size() == dofs_ref.Size());
+         for (int j = 0; j < dofs.Size(); j++)
+         {
+            REQUIRE(dofs[j] == MapDof(map, dofs_ref[j]));
+         }
+      }
+   };
+   check(mesh.GetNBE(), &FiniteElementSpace::GetBdrElementDofs);
+   check(mesh.GetNFaces(), &FiniteElementSpace::GetFaceDofs);
+   check(mesh.GetNV(), &FiniteElementSpace::GetVertexDofs);
+   check(mesh.GetNE(), &FiniteElementSpace::GetElementInteriorDofs);
+   if (mesh.Dimension() > 1)
+   {
+      check(mesh.GetNEdges(), &FiniteElementSpace::GetEdgeDofs);
+      check(mesh.GetNEdges(), &FiniteElementSpace::GetEdgeInteriorDofs);
+   }
+   if (mesh.Dimension() > 2)
+   {
+      check(mesh.GetNFaces(), &FiniteElementSpace::GetFaceInteriorDofs);
+   }
+}
+
+// Average distance of the nonzeros from the diagonal
+double AverageBandwidth(const SparseMatrix &A)
+{
+   const int *I = A.GetI(), *J = A.GetJ();
+   double bw = 0.0;
+   for (int i = 0; i < A.Height(); i++)
+   {
+      for (int k = I[i]; k < I[i+1]; k++) { bw += std::abs(J[k] - i); }
+   }
+   return bw/A.NumNonZeroElems();
+}
+
+void TestReorder(Mesh &mesh, FiniteElementCollection &fec, bool scalar)
+{
+   const int dim = mesh.Dimension();
+   Scramble(mesh);
+
+   FiniteElementSpace fes_ref(&mesh, &fec);
+   FiniteElementSpace fes(&mesh, &fec);
+   fes.ReorderElementToDofTable();
+
+   Array<int> map;
+   CheckConsistent(fes_ref, fes, map);
+
+   // Reordering again composes the renumberings
+   Array<int> ordering;
+   mesh.GetHilbertElementOrdering(ordering);
+   fes.ReorderDofs(ordering);
+   CheckConsistent(fes_ref, fes, map);
+
+   // The element restriction uses the new numbering
+   Vector x(fes.GetVSize()), x_ref(fes.GetVSize());
+   x_ref.Randomize(1);
+   for (int i = 0; i < map.Size(); i++) { x(map[i]) = x_ref(i); }
+   const Operator *R = fes.GetElementRestriction(ElementDofOrdering::NATIVE);
+   const Operator *R_ref =
+      fes_ref.GetElementRestriction(ElementDofOrdering::NATIVE);
+   Vector ex(R->Height()), ex_ref(R->Height());
+   R->Mult(x, ex);
+   R_ref->Mult(x_ref, ex_ref);
+   ex -= ex_ref;
+   REQUIRE(ex.Normlinf() == 0.0);
+
+   // Full and partial assembly give the same results in both numberings
+   ConstantCoefficient one(1.0);
+   FunctionCoefficient f_coeff(func);
+   VectorFunctionCoefficient vf_coeff(dim, vfunc);
+
+   double energy[2];
+   SparseMatrix *mat[2];
+   FiniteElementSpace *spaces[2] = { &fes_ref, &fes };
+   for (int s = 0; s < 2; s++)
+   {
+      GridFunction u(spaces[s]);
+      if (scalar) { u.ProjectCoefficient(f_coeff); }
+      else { u.ProjectCoefficient(vf_coeff); }
+
+      BilinearForm a(spaces[s]);
+      if (scalar) { a.AddDomainIntegrator(new DiffusionIntegrator(one)); }
+      else { a.AddDomainIntegrator(new CurlCurlIntegrator(one)); }
+      a.AddDomainIntegrator(scalar ? (BilinearFormIntegrator*)
+                            new MassIntegrator(f_coeff) :
+                            new VectorFEMassIntegrator(f_coeff));
+      a.Assemble();
+      a.Finalize();
+      mat[s] = a.LoseMat();
+      energy[s] = mat[s]->InnerProduct(u, u);
+
+      if (!UsesTensorBasis(*spaces[s])) { continue; }
+      BilinearForm a_pa(spaces[s]);
+      a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      if (scalar) { a_pa.AddDomainIntegrator(new DiffusionIntegrator(one)); }
+      else { a_pa.AddDomainIntegrator(new CurlCurlIntegrator(one)); }
+      a_pa.AddDomainIntegrator(scalar ? (BilinearFormIntegrator*)
+                               new MassIntegrator(f_coeff) :
+                               new VectorFEMassIntegrator(f_coeff));
+      a_pa.Assemble();
+      Vector y(u.Size()), y_pa(u.Size());
+      mat[s]->Mult(u, y);
+      a_pa.Mult(u, y_pa);
+      y_pa -= y;
+      REQUIRE(y_pa.Normlinf() < 1e-10*y.Normlinf());
+   }
+   REQUIRE(energy[1] == Approx(energy[0]));
+
+   // The Hilbert renumbering improves the locality of the matrix
+   REQUIRE(AverageBandwidth(*mat[1]) < 0.5*AverageBandwidth(*mat[0]));
+   delete mat[0];
+   delete mat[1];
+}
+
+} // namespace reorder_dofs
+
+using namespace reorder_dofs;
+
+TEST_CASE("FiniteElementSpace DOF reordering", "[FiniteElementSpace]")
+{
+   SECTION("H1 on quadrilaterals")
+   {
+      Mesh mesh(12, 12, Element::QUADRILATERAL, true);
+      H1_FECollection fec(3, 2);
+      TestReorder(mesh, fec, true);
+   }
+
+   SECTION("H1 on tetrahedra")
+   {
+      Mesh mesh(4, 4, 4, Element::TETRAHEDRON, true);
+      H1_FECollection fec(2, 3);
+      TestReorder(mesh, fec, true);
+   }
+
+   SECTION("ND on hexahedra")
+   {
+      Mesh mesh(5, 5, 5, Element::HEXAHEDRON, true);
+      ND_FECollection fec(2, 3);
+      TestReorder(mesh, fec, false);
+   }
+
+   SECTION("Update() restores the natural numbering")
+   {
+      Mesh mesh(4, 4, Element::QUADRILATERAL, true);
+      H1_FECollection fec(2, 2);
+      FiniteElementSpace fes(&mesh, &fec);
+      fes.ReorderElementToDofTable();
+      mesh.UniformRefinement();
+      fes.Update(false);
+      FiniteElementSpace fes_ref(&mesh, &fec);
+      Array<int> dofs, dofs_ref;
+      for (int e = 0; e < mesh.GetNE(); e++)
+      {
+         fes.GetElementDofs(e, dofs);
+         fes_ref.GetElementDofs(e, dofs_ref);
+         REQUIRE(dofs.Size() == dofs_ref.Size());
+         for (int j = 0; j < dofs.Size(); j++)
+         {
+            REQUIRE(dofs[j] == dofs_ref[j]);
+         }
+      }
+   }
+
+   SECTION("Unsupported spaces only reorder the element-to-DOF table")
+   {
+      Mesh mesh(4, 4, Element::QUADRILATERAL, true);
+      mesh.SetCurvature(2);
+      FiniteElementSpace *nodal_fes = mesh.GetNodes()->FESpace();
+      Mesh nc_mesh(4, 4, Element::QUADRILATERAL, true);
+      nc_mesh.EnsureNCMesh();
+      H1_FECollection fec(2, 2);
+      FiniteElementSpace nc_fes(&nc_mesh, &fec);
+      FiniteElementSpace *spaces[2] = { &nc_fes, nodal_fes };
+      for (int s = 0; s < 2; s++)
+      {
+         CAPTURE(s);
+         FiniteElementSpace &fes = *spaces[s];
+         fes.ReorderElementToDofTable();
+         // The DOFs are numbered by first touch in the element order
+         const Table &el_dof = fes.GetElementToDofTable();
+         const int *J = el_dof.GetJ();
+         int max_dof = -1;
+         for (int k = 0; k < el_dof.Size_of_connections(); k++)
+         {
+            const int dof = (J[k] >= 0) ? J[k] : -1 - J[k];
+            REQUIRE(dof <= max_dof + 1);
+            max_dof = std::max(max_dof, dof);
+         }
+      }
+   }
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+using namespace mfem;
+
+#include "catch.hpp"
+
+#include <map>
+#include <vector>
+#include <utility>
+
+TEST_CASE("HashTable", "[General]")
+{
+   // small initial size to exercise rehashing
+   HashTable<Hashed2> ht(16, 16);
+   std::map<std::pair<int, int>, int> ref;
+
+   auto key = [](int a, int b)
+   {
+      return std::make_pair(std::min(a, b), std::max(a, b));
+   };
+   auto check = [&]()
+   {
+      REQUIRE(ht.Size() == (int) ref.size());
+      for (const auto &kv : ref)
+      {
+         REQUIRE(ht.FindId(kv.first.second, kv.first.first) == kv.second);
+         REQUIRE(ht.IdExists(kv.second));
+      }
+      int count = 0;
+      for (auto it = ht.begin(); it != ht.end(); ++it) { count++; }
+      REQUIRE(count == ht.Size());
+   };
+
+   // insert pseudo-random pairs, some of them repeatedly
+   unsigned seed = 12345;
+   auto rnd = [&]()
+   {
+      seed = 1103515245u*seed + 12345u;
+      return int(seed >> 20);
+   };
+   for (int i = 0; i < 5000; i++)
+   {
+      int a = rnd(), b = rnd();
+      int id = ht.GetId(a, b);
+      auto res = ref.insert(std::make_pair(key(a, b), id));
+      REQUIRE(res.first->second == id);
+   }
+   check();
+   REQUIRE(ht.FindId(-5, -7) == -1);
+
+   // delete every third item, ids are reused by new items
+   std::vector<std::pair<int, int>> keys;
+   for (const auto &kv : ref) { keys.push_back(kv.first); }
+   for (size_t i = 0; i < keys.size(); i += 3)
+   {
+      int id = ref[keys[i]];
+      ht.Delete(id);
+      REQUIRE(!ht.IdExists(id));
+      ref.erase(keys[i]);
+   }
+   check();
+   for (size_t i = 0; i < keys.size(); i += 3)
+   {
+      ref[keys[i]] = ht.GetId(keys[i].first, keys[i].second);
+   }
+   check();
+   REQUIRE(ht.NumFreeIds() == 0);
+
+   // move items under new parents
+   for (size_t i = 1; i < keys.size(); i += 5)
+   {
+      auto old_key = keys[i];
+      auto new_key = key(-1 - old_key.first, old_key.second);
+      int id = ref[old_key];
+      ht.Reparent(id, new_key.first, new_key.second);
+      ref.erase(old_key);
+      ref[new_key] = id;
+      REQUIRE(ht.FindId(old_key.first, old_key.second) == -1);
+   }
+   check();
+
+   // a copy is independent of the original
+   HashTable<Hashed2> copy(ht);
+   ht.DeleteAll();
+   REQUIRE(ht.Size() == 0);
+   for (const auto &kv : ref)
+   {
+      REQUIRE(copy.FindId(kv.first.first, kv.first.second) == kv.second);
+      REQUIRE(ht.FindId(kv.first.first, kv.first.second) == -1);
+   }
+}
+
+TEST_CASE("HashTable with four indices", "[General]")
+{
+   HashTable<Hashed4> ht(16, 16);
+   const int n = 12;
+   for (int i = 0; i < n; i++)
+   {
+      for (int j = i+1; j < n; j++)
+      {
+         for (int k = j+1; k < n; k++)
+         {
+            REQUIRE(ht.GetId(k, i, j, 100) == ht.GetId(j, k, i));
+         }
+      }
+   }
+   REQUIRE(ht.Size() == n*(n-1)*(n-2)/6);
+   for (int i = 0; i < ht.NumIds(); i += 2) { ht.Delete(i); }
+   for (int i = 0; i < ht.NumIds(); i++)
+   {
+      const Hashed4 &item = ht[i];
+      REQUIRE(ht.FindId(item.p3, item.p1, item.p2) == ((i % 2) ? i : -1));
+   }
+}
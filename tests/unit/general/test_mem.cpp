@@ -111,4 +111,103 @@ TEST_CASE("MemoryManager", "[MemoryManager]")
    }
 }
 
+TEST_CASE("HostPool", "[MemoryManager]")
+{
+   const MemoryPoolStats s0 = mm.GetHostPoolStats();
+   for (int i = 0; i < 10; i++)
+   {
+      TestMemoryTypes(MemoryType::HOST_POOL, false, 1000 + i);
+   }
+   const MemoryPoolStats s1 = mm.GetHostPoolStats();
+   // All sizes are in the same size class: only the first block is new
+   REQUIRE(s1.misses - s0.misses <= 1);
+   REQUIRE(s1.hits - s0.hits >= 9);
+   REQUIRE(s1.bytes_in_use == s0.bytes_in_use);
+   REQUIRE(s1.peak_bytes >= 1009*sizeof(double));
+   REQUIRE(s1.bytes_cached >= 1009*sizeof(double));
+
+   mm.ReleaseHostPool();
+   REQUIRE(mm.GetHostPoolStats().bytes_cached == 0);
+}
+
+static void AssembleMassAndDiffusion(int order)
+{
+   Mesh mesh(4, 4, 4, Element::HEXAHEDRON);
+   // The conforming assembly on a nonconforming mesh creates sparse matrices
+   // that own wrapped arrays, e.g. in Transpose()
+   mesh.EnsureNCMesh();
+   Array<Refinement> refs;
+   refs.Append(Refinement(0));
+   mesh.GeneralRefinement(refs);
+   H1_FECollection fec(order, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   ConstantCoefficient one(1.0);
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new MassIntegrator(one));
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.Assemble();
+   Array<int> ess_tdof_list;
+   SparseMatrix A;
+   a.FormSystemMatrix(ess_tdof_list, A);
+   REQUIRE(A.Height() == fes.GetTrueVSize());
+   REQUIRE(A.NumNonZeroElems() > 0);
+}
+
+TEST_CASE("HostPool BilinearForm", "[MemoryManager]")
+{
+   const MemoryType h_mt = mm.GetHostMemoryType();
+   const MemoryType d_mt = mm.GetDeviceMemoryType();
+   mm.Configure(MemoryType::HOST_POOL, MemoryType::HOST_POOL);
+
+   // The first assembly also fills global caches, e.g. the integration rules
+   AssembleMassAndDiffusion(2);
+   const MemoryPoolStats s0 = mm.GetHostPoolStats();
+   AssembleMassAndDiffusion(2);
+   const MemoryPoolStats s1 = mm.GetHostPoolStats();
+   // All pool memory, including the wrapped arrays owned by the sparse
+   // matrices and tables, is returned to the pool
+   REQUIRE(s1.bytes_in_use == s0.bytes_in_use);
+   REQUIRE(s1.hits > s0.hits);
+
+   mm.Configure(h_mt, d_mt);
+   mm.ReleaseHostPool();
+}
+
+TEST_CASE("HostPool external arrays", "[MemoryManager]")
+{
+   const MemoryType h_mt = mm.GetHostMemoryType();
+   const MemoryType d_mt = mm.GetDeviceMemoryType();
+   mm.Configure(MemoryType::HOST_POOL, MemoryType::HOST_POOL);
+   const MemoryPoolStats s0 = mm.GetHostPoolStats();
+
+   // Arrays allocated with new[] and adopted by a Vector are not returned to
+   // the pool
+   {
+      Vector v;
+      v.SetDataAndSize(new double[100], 100);
+      v.MakeDataOwner();
+      Memory<int> m(new int[50], 50, true);
+      m.Delete();
+   }
+   MemoryPoolStats s1 = mm.GetHostPoolStats();
+   REQUIRE(s1.bytes_in_use == s0.bytes_in_use);
+   REQUIRE(s1.bytes_cached == s0.bytes_cached);
+
+   // A pool block wrapped with a smaller size is returned to its size class
+   {
+      Memory<double> block(1000);
+      Memory<double> m(block.Write(MemoryClass::HOST, 1000), 10, true);
+      block.ClearOwnerFlags();
+      s1 = mm.GetHostPoolStats();
+      REQUIRE(s1.bytes_in_use >= s0.bytes_in_use + 1000*sizeof(double));
+      m.Delete();
+   }
+   s1 = mm.GetHostPoolStats();
+   REQUIRE(s1.bytes_in_use == s0.bytes_in_use);
+   REQUIRE(s1.bytes_cached >= 1000*sizeof(double));
+
+   mm.Configure(h_mt, d_mt);
+   mm.ReleaseHostPool();
+}
+
 #endif // _WIN32
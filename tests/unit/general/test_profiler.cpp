@@ -0,0 +1,132 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+using namespace mfem;
+
+#include "catch.hpp"
+
+#include <sstream>
+#include <string>
+
+static int CountOf(const std::string &s, const std::string &sub)
+{
+   int count = 0;
+   for (size_t pos = s.find(sub); pos != std::string::npos;
+        pos = s.find(sub, pos + 1)) { count++; }
+   return count;
+}
+
+TEST_CASE("Profiler", "[General]")
+{
+   Profiler::Reset();
+
+   SECTION("Disabled")
+   {
+      {
+         MFEM_PERF_SCOPE("test-disabled");
+         Profiler::AddCount("test-count");
+      }
+      std::ostringstream out;
+      Profiler::Print(out);
+      REQUIRE(out.str().find("test-disabled") == std::string::npos);
+   }
+
+   SECTION("Regions and counters")
+   {
+      Profiler::Enable(true);
+      for (int i = 0; i < 3; i++)
+      {
+         MFEM_PERF_SCOPE("test-outer");
+         Profiler::AddCount("test-count", 2.0);
+         {
+            MFEM_PERF_SCOPE("test-inner");
+         }
+      }
+      {
+         // The same name in another parent is a separate region
+         MFEM_PERF_SCOPE("test-inner");
+      }
+      Profiler::Disable();
+      {
+         MFEM_PERF_SCOPE("test-after");
+      }
+
+      std::ostringstream out;
+      Profiler::Print(out);
+      const std::string table = out.str();
+      REQUIRE(CountOf(table, "test-outer") == 1);
+      REQUIRE(CountOf(table, "test-inner") == 2);
+      REQUIRE(CountOf(table, "test-after") == 0);
+      REQUIRE(table.find("  test-inner") != std::string::npos);
+
+      std::istringstream in(table.substr(table.find("test-outer")));
+      std::string name;
+      long calls;
+      in >> name >> calls;
+      REQUIRE(calls == 3);
+      std::getline(in, name);
+      in >> name >> name;
+      REQUIRE(name == "test-count");
+      double count;
+      in >> count;
+      REQUIRE(count == 6.0);
+
+      std::ostringstream trace;
+      Profiler::PrintChromeTrace(trace);
+      REQUIRE(CountOf(trace.str(), "\"ph\":\"X\"") == 7);
+      REQUIRE(trace.str().find("\"traceEvents\"") != std::string::npos);
+   }
+
+   SECTION("Solver iterations")
+   {
+      const int n = 50;
+      SparseMatrix A(n);
+      for (int i = 0; i < n; i++)
+      {
+         A.Add(i, i, 2.0);
+         if (i > 0) { A.Add(i, i-1, -1.0); }
+         if (i < n-1) { A.Add(i, i+1, -1.0); }
+      }
+      A.Finalize();
+      Vector b(n), x(n);
+      b = 1.0;
+
+      CGSolver cg;
+      cg.SetOperator(A);
+      cg.SetRelTol(1e-12);
+      cg.SetMaxIter(2*n);
+
+      Profiler::Enable();
+      x = 0.0;
+      cg.Mult(b, x);
+      x = 0.0;
+      cg.Mult(b, x);
+      Profiler::Disable();
+
+      std::ostringstream out;
+      Profiler::Print(out);
+      const std::string table = out.str();
+      std::istringstream in(table.substr(table.find("CGSolver::Mult")));
+      std::string name;
+      long calls;
+      in >> name >> calls;
+      REQUIRE(calls == 2);
+      std::getline(in, name);
+      in >> name >> name;
+      REQUIRE(name == "iterations");
+      double iterations;
+      in >> iterations;
+      REQUIRE(iterations == 2*cg.GetNumIterations());
+   }
+
+   Profiler::Reset();
+}
@@ -245,3 +245,143 @@ TEST_CASE("LUFactors RightSolve", "[DenseMatrix]")
 
    REQUIRE(C.MaxMaxNorm() < tol);
 }
+
+TEST_CASE("DenseTensor batched LU, inverse and product", "[DenseMatrix]")
+{
+   const int m = 5, nb = 7;
+   DenseTensor A(m, m, nb), B(m, 3, nb);
+   for (int k = 0; k < nb; k++)
+   {
+      for (int j = 0; j < m; j++)
+      {
+         for (int i = 0; i < m; i++)
+         {
+            // Nonsymmetric matrices requiring pivoting
+            A(i,j,k) = (i == (j+k) % m ? 10.0 : 0.0) + 1.0/(1.0 + i + 2*j + k);
+         }
+         if (j < 3) { for (int i = 0; i < m; i++) { B(i,j,k) = i - j + k; } }
+      }
+   }
+
+   SECTION("BatchLUFactor and BatchLUSolve")
+   {
+      DenseTensor Alu(A);
+      Array<int> P;
+      REQUIRE(BatchLUFactor(Alu, P));
+
+      Vector X(m*nb), AX(m*nb), b(m*nb);
+      b.Randomize(1);
+      X = b;
+      BatchLUSolve(Alu, P, X);
+      for (int k = 0; k < nb; k++)
+      {
+         Vector Xk(X.GetData() + k*m, m), AXk(AX.GetData() + k*m, m);
+         A(k).Mult(Xk, AXk);
+
+         // The factors can be used with LUFactors
+         Vector Yk(m);
+         for (int i = 0; i < m; i++) { Yk(i) = b(i + k*m); }
+         LUFactors lu(Alu.GetData(k), &P[k*m]);
+         lu.Solve(m, 1, Yk.GetData());
+         Yk -= Xk;
+         REQUIRE(Yk.Normlinf() < 1e-12);
+      }
+      AX -= b;
+      REQUIRE(AX.Normlinf() < 1e-12);
+   }
+
+   SECTION("BatchInverse and BatchMult")
+   {
+      DenseTensor Ainv, AinvB, AAinvB;
+      BatchInverse(A, Ainv);
+      BatchMult(Ainv, B, AinvB);
+      BatchMult(A, AinvB, AAinvB);
+      REQUIRE(AAinvB.SizeI() == m);
+      REQUIRE(AAinvB.SizeJ() == 3);
+      REQUIRE(AAinvB.SizeK() == nb);
+
+      double err = 0.0;
+      for (int k = 0; k < nb; k++)
+      {
+         DenseMatrix Ainv_k(m);
+         DenseMatrixInverse(A(k)).GetInverseMatrix(Ainv_k);
+         Ainv_k -= Ainv(k);
+         err = std::max(err, Ainv_k.MaxMaxNorm());
+         for (int j = 0; j < 3; j++)
+         {
+            for (int i = 0; i < m; i++)
+            {
+               err = std::max(err, std::abs(AAinvB(i,j,k) - B(i,j,k)));
+            }
+         }
+      }
+      REQUIRE(err < 1e-12);
+   }
+
+   SECTION("Singular matrix")
+   {
+      DenseTensor Alu(A);
+      for (int i = 0; i < m; i++) { Alu(i,2,3) = 0.0; }
+      Array<int> P;
+      REQUIRE_FALSE(BatchLUFactor(Alu, P));
+   }
+}
+
+TEST_CASE("DenseTensor batched LU of many matrices", "[DenseMatrix]")
+{
+   // Batches of several groups of matrices for the host kernels, including
+   // partial groups, and matrices too large for them
+   const int sizes[4][2] = { {1, 3}, {4, 19}, {12, 17}, {70, 3} };
+   for (int s = 0; s < 4; s++)
+   {
+      const int m = sizes[s][0], nb = sizes[s][1];
+      CAPTURE(m);
+      CAPTURE(nb);
+      DenseTensor A(m, m, nb);
+      for (int k = 0; k < nb; k++)
+      {
+         for (int j = 0; j < m; j++)
+         {
+            for (int i = 0; i < m; i++)
+            {
+               A(i,j,k) = (i == (j+k) % m ? 10.0 : 0.0) +
+                          1.0/(1.0 + i + 2*j + k);
+            }
+         }
+      }
+
+      DenseTensor Alu(A), Ainv;
+      Array<int> P;
+      REQUIRE(BatchLUFactor(Alu, P));
+      BatchInverse(A, Ainv);
+      Vector X(m*nb), b(m*nb);
+      b.Randomize(1);
+      X = b;
+      BatchLUSolve(Alu, P, X);
+
+      double err = 0.0;
+      for (int k = 0; k < nb; k++)
+      {
+         // Compare with the factors computed by LUFactors
+         DenseMatrix Ak_lu(A(k));
+         Array<int> Pk(m);
+         LUFactors lu(Ak_lu.Data(), Pk.GetData());
+         lu.Factor(m);
+         Vector Yk(b.GetData() + k*m, m), Xk(X.GetData() + k*m, m);
+         Vector Zk(Yk);
+         lu.Solve(m, 1, Zk.GetData());
+         Zk -= Xk;
+         err = std::max(err, Zk.Normlinf());
+
+         DenseMatrix Ainv_k(m);
+         DenseMatrixInverse(A(k)).GetInverseMatrix(Ainv_k);
+         Ainv_k -= Ainv(k);
+         err = std::max(err, Ainv_k.MaxMaxNorm());
+      }
+      REQUIRE(err < 1e-12);
+
+      // A singular matrix in the last group is detected
+      for (int i = 0; i < m; i++) { Alu(i,0,nb-1) = 0.0; }
+      REQUIRE_FALSE(BatchLUFactor(Alu, P));
+   }
+}
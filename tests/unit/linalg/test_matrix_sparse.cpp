@@ -0,0 +1,60 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "catch.hpp"
+#include "mfem.hpp"
+
+using namespace mfem;
+
+TEST_CASE("SparseMatrix SELL-C-sigma", "[SparseMatrix]")
+{
+   // Rectangular matrix with a few empty rows and rows of varying length, with
+   // a number of rows that is not a multiple of the slice size.
+   const int height = 103, width = 57;
+   SparseMatrix A(height, width);
+   for (int i = 0; i < height; i++)
+   {
+      if (i % 17 == 5) { continue; }
+      const int row_size = 1 + (7*i) % 13;
+      for (int k = 0; k < row_size; k++)
+      {
+         A.Add(i, (3*i + 5*k) % width, 1.0 + 0.1*i - 0.3*k);
+      }
+   }
+   A.Finalize();
+
+   Vector x(width), y_csr(height), y_sell(height);
+   x.Randomize(1);
+   A.Mult(x, y_csr);
+
+   for (int C : {4, 8})
+   {
+      for (int sigma : {C, 8*C, 1024})
+      {
+         A.ResetSELL();
+         A.BuildSELL(C, sigma);
+         REQUIRE(A.HasSELL());
+
+         A.Mult(x, y_sell);
+         y_sell -= y_csr;
+         REQUIRE(y_sell.Normlinf() < 1e-12 * y_csr.Normlinf());
+
+         y_sell = 1.0;
+         A.AddMult(x, y_sell, -2.0);
+         y_sell.Add(2.0, y_csr);
+         y_sell -= 1.0;
+         REQUIRE(y_sell.Normlinf() < 1e-12 * y_csr.Normlinf());
+      }
+   }
+
+   A.ResetSELL();
+   REQUIRE(!A.HasSELL());
+}
@@ -14,6 +14,10 @@ using namespace mfem;
 
 #include "catch.hpp"
 
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
 TEST_CASE("Gecko integration in MFEM", "[Mesh]")
 {
    Array<int> perm;
@@ -91,3 +95,289 @@ TEST_CASE("Gecko integration in MFEM", "[Mesh]")
       }
    }
 }
+
+TEST_CASE("Vertex-based element coloring", "[Mesh]")
+{
+   auto check_coloring = [](Mesh &mesh)
+   {
+      Array<int> colors;
+      const int num_colors = mesh.GetVertexElementColoring(colors);
+      REQUIRE(colors.Size() == mesh.GetNE());
+      REQUIRE(colors.Min() == 0);
+      REQUIRE(colors.Max() == num_colors - 1);
+
+      Table *vert_elem = mesh.GetVertexToElementTable();
+      bool conflict = false;
+      for (int v = 0; v < vert_elem->Size(); v++)
+      {
+         const int *el = vert_elem->GetRow(v);
+         for (int i = 0; i < vert_elem->RowSize(v); i++)
+         {
+            for (int j = i+1; j < vert_elem->RowSize(v); j++)
+            {
+               conflict |= (colors[el[i]] == colors[el[j]]);
+            }
+         }
+      }
+      delete vert_elem;
+      REQUIRE(!conflict);
+   };
+
+   SECTION("Quad mesh")
+   {
+      Mesh mesh(6, 5, Element::QUADRILATERAL);
+      check_coloring(mesh);
+   }
+
+   SECTION("Tet mesh")
+   {
+      Mesh mesh(3, 4, 2, Element::TETRAHEDRON);
+      check_coloring(mesh);
+   }
+}
+
+static void CompareMeshes(Mesh &m1, Mesh &m2)
+{
+   REQUIRE(m2.Dimension() == m1.Dimension());
+   REQUIRE(m2.SpaceDimension() == m1.SpaceDimension());
+   REQUIRE(m2.GetNE() == m1.GetNE());
+   REQUIRE(m2.GetNBE() == m1.GetNBE());
+   REQUIRE(m2.GetNV() == m1.GetNV());
+   REQUIRE((m2.ncmesh != NULL) == (m1.ncmesh != NULL));
+
+   Array<int> v1, v2;
+   for (int i = 0; i < m1.GetNE(); i++)
+   {
+      REQUIRE(m2.GetAttribute(i) == m1.GetAttribute(i));
+      m1.GetElementVertices(i, v1);
+      m2.GetElementVertices(i, v2);
+      REQUIRE(v2 == v1);
+   }
+   for (int i = 0; i < m1.GetNBE(); i++)
+   {
+      REQUIRE(m2.GetBdrAttribute(i) == m1.GetBdrAttribute(i));
+      m1.GetBdrElementVertices(i, v1);
+      m2.GetBdrElementVertices(i, v2);
+      REQUIRE(v2 == v1);
+   }
+   for (int i = 0; i < m1.GetNV(); i++)
+   {
+      for (int d = 0; d < m1.SpaceDimension(); d++)
+      {
+         REQUIRE(m2.GetVertex(i)[d] == m1.GetVertex(i)[d]);
+      }
+   }
+   REQUIRE((m2.GetNodes() != NULL) == (m1.GetNodes() != NULL));
+   if (m1.GetNodes())
+   {
+      Vector diff(*m2.GetNodes());
+      diff -= *m1.GetNodes();
+      REQUIRE(diff.Normlinf() == 0.0);
+   }
+}
+
+TEST_CASE("Binary mesh format", "[Mesh]")
+{
+   Mesh mesh(3, 2, 2, Element::HEXAHEDRON);
+   for (int i = 0; i < mesh.GetNE(); i++) { mesh.SetAttribute(i, 1 + i%3); }
+
+   SECTION("Conforming mesh")
+   {
+      std::stringstream stream;
+      mesh.PrintBinary(stream);
+      Mesh mesh2(stream);
+      CompareMeshes(mesh, mesh2);
+   }
+
+   SECTION("Curved mesh")
+   {
+      mesh.SetCurvature(2);
+      std::stringstream stream;
+      mesh.PrintBinary(stream);
+      Mesh mesh2(stream);
+      CompareMeshes(mesh, mesh2);
+   }
+
+   SECTION("Non-conforming mesh")
+   {
+      Array<int> refs;
+      refs.Append(0);
+      refs.Append(5);
+      mesh.GeneralRefinement(refs, 1);
+      std::stringstream stream;
+      mesh.PrintBinary(stream);
+      Mesh mesh2(stream);
+      CompareMeshes(mesh, mesh2);
+
+      // the refinement hierarchy is preserved
+      REQUIRE(mesh2.ncmesh->GetNumRootElements() == 12);
+      REQUIRE(mesh2.ncmesh->GetNEdges() == mesh.ncmesh->GetNEdges());
+      REQUIRE(mesh2.ncmesh->GetNFaces() == mesh.ncmesh->GetNFaces());
+   }
+
+   SECTION("Memory-mapped file and grid function")
+   {
+      const char *mesh_file = "binary_mesh_test.mesh";
+      const char *gf_file = "binary_mesh_test.gf";
+
+      H1_FECollection fec(3, mesh.Dimension());
+      FiniteElementSpace fes(&mesh, &fec, 2);
+      GridFunction x(&fes);
+      x.Randomize(1);
+      {
+         std::ofstream mesh_out(mesh_file, std::ios::binary);
+         mesh.PrintBinary(mesh_out);
+         std::ofstream gf_out(gf_file, std::ios::binary);
+         x.SaveBinary(gf_out);
+      }
+
+      Mesh mesh2(mesh_file, 1, 1);
+      CompareMeshes(mesh, mesh2);
+
+      mapped_ifstream gf_in(gf_file);
+      REQUIRE(gf_in.good());
+      GridFunction x2(&mesh2, gf_in);
+      REQUIRE(x2.FESpace()->GetVDim() == 2);
+      x2 -= x;
+      REQUIRE(x2.Normlinf() == 0.0);
+
+      std::remove(mesh_file);
+      std::remove(gf_file);
+   }
+}
+
+// Check that the parts of the partitioning are non-empty and connected, and
+// return the part weights in @a part_weight.
+static void CheckHilbertPartitioning(Mesh &mesh, const int *partitioning,
+                                     int nparts, const Array<double> &weights,
+                                     Array<double> &part_weight)
+{
+   const Table &el_to_el = mesh.ElementToElementTable();
+   const int NE = mesh.GetNE();
+   for (int i = 0; i < NE; i++)
+   {
+      REQUIRE((partitioning[i] >= 0 && partitioning[i] < nparts));
+   }
+   part_weight.SetSize(nparts);
+   part_weight = 0.0;
+   Array<int> visited(NE), stack;
+   visited = 0;
+   for (int p = 0; p < nparts; p++)
+   {
+      // depth-first search through the first element of the part
+      int first = -1;
+      for (int i = 0; i < NE && first < 0; i++)
+      {
+         if (partitioning[i] == p) { first = i; }
+      }
+      REQUIRE(first >= 0);
+      stack.Append(first);
+      visited[first] = 1;
+      while (stack.Size())
+      {
+         const int el = stack.Last();
+         stack.DeleteLast();
+         part_weight[p] += weights[el];
+         for (int j = 0; j < el_to_el.RowSize(el); j++)
+         {
+            const int nb = el_to_el.GetRow(el)[j];
+            if (!visited[nb] && partitioning[nb] == p)
+            {
+               visited[nb] = 1;
+               stack.Append(nb);
+            }
+         }
+      }
+   }
+   // all elements are reached from the first element of their part
+   REQUIRE(visited.Min() == 1);
+}
+
+TEST_CASE("Hilbert curve partitioning", "[Mesh]")
+{
+   for (int dim = 2; dim <= 3; dim++)
+   {
+      CAPTURE(dim);
+      Mesh *mesh = (dim == 2) ?
+                   new Mesh(16, 16, Element::QUADRILATERAL) :
+                   new Mesh(8, 8, 8, Element::HEXAHEDRON);
+      const int NE = mesh->GetNE();
+      const int nparts = 7;
+      Array<double> weights(NE), part_weight;
+
+      // uniform weights: the parts differ by at most one element
+      weights = 1.0;
+      int *partitioning = mesh->GenerateHilbertPartitioning(nparts);
+      CheckHilbertPartitioning(*mesh, partitioning, nparts, weights,
+                               part_weight);
+      REQUIRE(part_weight.Max() - part_weight.Min() <= 1.0);
+
+      int *partitioning6 = mesh->GeneratePartitioning(nparts, 6);
+      for (int i = 0; i < NE; i++)
+      {
+         REQUIRE(partitioning6[i] == partitioning[i]);
+      }
+      delete [] partitioning6;
+      delete [] partitioning;
+
+      // elements in the right half of the domain are three times heavier
+      Vector center;
+      for (int i = 0; i < NE; i++)
+      {
+         mesh->GetElementCenter(i, center);
+         weights[i] = (center(0) > 0.5) ? 3.0 : 1.0;
+      }
+      partitioning = mesh->GenerateHilbertPartitioning(nparts, &weights);
+      CheckHilbertPartitioning(*mesh, partitioning, nparts, weights,
+                               part_weight);
+      REQUIRE(part_weight.Max() - part_weight.Min() <= 2*weights.Max());
+      delete [] partitioning;
+
+      // uneven weights, spanning several orders of magnitude
+      for (int i = 0; i < NE; i++) { weights[i] = pow(10.0, i % 4); }
+      partitioning = mesh->GenerateHilbertPartitioning(nparts, &weights);
+      CheckHilbertPartitioning(*mesh, partitioning, nparts, weights,
+                               part_weight);
+      REQUIRE(part_weight.Max() - part_weight.Min() <= 2*weights.Max());
+      delete [] partitioning;
+
+      // zero weights in a corner of the domain and everywhere
+      for (int i = 0; i < NE; i++)
+      {
+         mesh->GetElementCenter(i, center);
+         weights[i] = (center(0) > 0.75 && center(1) > 0.75) ? 0.0 : 1.0;
+      }
+      partitioning = mesh->GenerateHilbertPartitioning(nparts, &weights);
+      CheckHilbertPartitioning(*mesh, partitioning, nparts, weights,
+                               part_weight);
+      REQUIRE(part_weight.Max() - part_weight.Min() <= 2*weights.Max());
+      delete [] partitioning;
+
+      weights = 0.0;
+      partitioning = mesh->GenerateHilbertPartitioning(nparts, &weights);
+      CheckHilbertPartitioning(*mesh, partitioning, nparts, weights,
+                               part_weight);
+      delete [] partitioning;
+
+      // more parts than elements
+      partitioning = mesh->GenerateHilbertPartitioning(NE + 3);
+      for (int i = 0; i < NE; i++) { REQUIRE(partitioning[i] == i); }
+      delete [] partitioning;
+
+      delete mesh;
+   }
+
+   // a zero weight on any element of a small mesh, including the last one
+   // along the curve
+   Mesh mesh(2, 2, Element::QUADRILATERAL);
+   Array<double> weights(mesh.GetNE()), part_weight;
+   for (int k = 0; k < mesh.GetNE(); k++)
+   {
+      CAPTURE(k);
+      weights = 1.0;
+      weights[k] = 0.0;
+      int *partitioning = mesh.GenerateHilbertPartitioning(2, &weights);
+      CheckHilbertPartitioning(mesh, partitioning, 2, weights, part_weight);
+      delete [] partitioning;
+   }
+}
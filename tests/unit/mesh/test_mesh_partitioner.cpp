@@ -0,0 +1,266 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "catch.hpp"
+#include "general/text.hpp"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace mfem;
+
+namespace mesh_partitioner
+{
+
+// For each communication group (given by its sorted list of parts), the
+// coordinates of the centers of the shared entities, in the order listed
+typedef std::map<std::vector<int>, std::vector<double> > GroupCenters;
+
+static void AddCenter(const Mesh &mesh, const int *v, int nv,
+                      std::vector<double> &centers)
+{
+   for (int d = 0; d < mesh.SpaceDimension(); d++)
+   {
+      double c = 0.0;
+      for (int i = 0; i < nv; i++) { c += mesh.GetVertex(v[i])[d]; }
+      centers.push_back(c / nv);
+   }
+}
+
+// Load the part printed by MeshPartitioner::PrintPart(), checking its group
+// topology and adding the centers of its shared entities to @a centers.
+static Mesh *LoadPart(const std::string &str, int part, GroupCenters &centers)
+{
+   const std::string tag = "mfem_serial_mesh_end";
+   const size_t pos = str.find(tag);
+   REQUIRE(pos != std::string::npos);
+   std::istringstream serial_in(str.substr(0, pos) + "mfem_mesh_end\n");
+   Mesh *mesh = new Mesh(serial_in, 1, 0, false);
+   const int dim = mesh->Dimension();
+
+   std::istringstream in(str.substr(pos + tag.size()));
+   std::string ident;
+   int ngroups, n;
+   in >> ident;
+   REQUIRE(ident == "communication_groups");
+   in >> ident >> ngroups;
+   skip_comment_lines(in, '#');
+   std::vector<std::vector<int> > groups(ngroups);
+   for (int gr = 0; gr < ngroups; gr++)
+   {
+      in >> n;
+      groups[gr].resize(n);
+      for (int i = 0; i < n; i++) { in >> groups[gr][i]; }
+   }
+   REQUIRE(groups[0] == std::vector<int>(1, part));
+
+   int total[3] = { 0, 0, 0 }, count[3] = { 0, 0, 0 };
+   for (int d = 0; d < dim; d++) { in >> ident >> total[d]; }
+   for (int gr = 1; gr < ngroups; gr++)
+   {
+      REQUIRE(std::find(groups[gr].begin(), groups[gr].end(), part) !=
+              groups[gr].end());
+      std::vector<double> &c = centers[groups[gr]];
+      for (int d = 0; d < dim; d++)
+      {
+         skip_comment_lines(in, '#');
+         in >> ident >> n;
+         count[d] += n;
+         for (int i = 0; i < n; i++)
+         {
+            int geom = (d == 0) ? Geometry::POINT : Geometry::SEGMENT, v[4];
+            if (d == 2) { in >> geom; }
+            for (int j = 0; j < Geometry::NumVerts[geom]; j++) { in >> v[j]; }
+            AddCenter(*mesh, v, Geometry::NumVerts[geom], c);
+         }
+      }
+   }
+   for (int d = 0; d < dim; d++) { REQUIRE(count[d] == total[d]); }
+   in >> ident;
+   REQUIRE(ident == "mfem_mesh_end");
+   return mesh;
+}
+
+static void TestPartitioner(Mesh &mesh, int nxyz[])
+{
+   int *partitioning = mesh.CartesianPartitioning(nxyz);
+   int nparts = 1;
+   for (int d = 0; d < mesh.Dimension(); d++) { nparts *= nxyz[d]; }
+   MeshPartitioner partitioner(mesh, nparts, partitioning);
+   delete [] partitioning;
+
+   GroupCenters all_centers;
+   int ne = 0, nbe = 0;
+   double vol = 0.0;
+   for (int p = 0; p < nparts; p++)
+   {
+      CAPTURE(p);
+      std::ostringstream out;
+      partitioner.PrintPart(p, out);
+      GroupCenters centers;
+      Mesh *part = LoadPart(out.str(), p, centers);
+      REQUIRE(part->GetNE() == partitioner.GetPartNE(p));
+      REQUIRE(part->GetNBE() == partitioner.GetPartNBE(p));
+      ne += part->GetNE();
+      nbe += part->GetNBE();
+      for (int i = 0; i < part->GetNE(); i++)
+      {
+         vol += part->GetElementVolume(i);
+      }
+      REQUIRE((part->GetNodes() != NULL) == (mesh.GetNodes() != NULL));
+
+      // All the parts in a group must list the same shared entities
+      for (GroupCenters::iterator it = centers.begin(); it != centers.end();
+           ++it)
+      {
+         if (all_centers.count(it->first) == 0)
+         {
+            all_centers[it->first] = it->second;
+         }
+         else
+         {
+            const std::vector<double> &c = all_centers[it->first];
+            REQUIRE(c.size() == it->second.size());
+            for (size_t i = 0; i < c.size(); i++)
+            {
+               REQUIRE(std::abs(c[i] - it->second[i]) < 1e-12);
+            }
+         }
+      }
+      delete part;
+   }
+   REQUIRE(ne == mesh.GetNE());
+   REQUIRE(nbe == mesh.GetNBE());
+
+   double mesh_vol = 0.0;
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      mesh_vol += mesh.GetElementVolume(i);
+   }
+   REQUIRE(vol == Approx(mesh_vol));
+}
+
+TEST_CASE("MeshPartitioner", "[Mesh]")
+{
+   int nxyz[3] = { 2, 2, 2 };
+   for (int dim = 1; dim <= 3; dim++)
+   {
+      for (int type = 0; type <= 1; type++)
+      {
+         for (int curved = 0; curved <= 1; curved++)
+         {
+            CAPTURE(dim);
+            CAPTURE(type);
+            CAPTURE(curved);
+            Mesh *mesh;
+            if (dim == 1)
+            {
+               if (type == 1) { continue; }
+               mesh = new Mesh(8);
+               nxyz[0] = 3;
+            }
+            else if (dim == 2)
+            {
+               mesh = new Mesh(4, 5, type ? Element::TRIANGLE :
+                               Element::QUADRILATERAL, true);
+               nxyz[0] = 2;
+            }
+            else
+            {
+               mesh = new Mesh(3, 4, 3, type ? Element::TETRAHEDRON :
+                               Element::HEXAHEDRON, true);
+               nxyz[0] = 2;
+            }
+            if (curved) { mesh->SetCurvature(2); }
+            TestPartitioner(*mesh, nxyz);
+            delete mesh;
+         }
+      }
+   }
+}
+
+#ifdef MFEM_USE_MPI
+
+static Vector ElementCenter(Mesh &mesh, int i)
+{
+   Vector x(mesh.SpaceDimension());
+   ElementTransformation *T = mesh.GetElementTransformation(i);
+   T->Transform(Geometries.GetCenter(mesh.GetElementBaseGeometry(i)), x);
+   return x;
+}
+
+// Compare ParMesh::Distribute() with the ParMesh constructor replicating the
+// serial mesh on all ranks
+TEST_CASE("ParMesh::Distribute", "[Mesh], [Parallel]")
+{
+   int rank, size;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+   MPI_Comm_size(MPI_COMM_WORLD, &size);
+   const int root = size - 1;
+
+   for (int dim = 2; dim <= 3; dim++)
+   {
+      for (int type = 0; type <= 1; type++)
+      {
+         for (int curved = 0; curved <= 1; curved++)
+         {
+            CAPTURE(dim);
+            CAPTURE(type);
+            CAPTURE(curved);
+            // The vertex coordinates are not exact in decimal form
+            Mesh *mesh;
+            if (dim == 2)
+            {
+               mesh = new Mesh(3, 7, type ? Element::TRIANGLE :
+                               Element::QUADRILATERAL, true, 1.0, 0.7);
+            }
+            else
+            {
+               mesh = new Mesh(3, 2, 3, type ? Element::TETRAHEDRON :
+                               Element::HEXAHEDRON, true, 1.0, 0.7, 0.3);
+            }
+            if (curved) { mesh->SetCurvature(2); }
+            int *partitioning = mesh->GeneratePartitioning(size);
+
+            ParMesh ref_pmesh(MPI_COMM_WORLD, *mesh, partitioning);
+            ParMesh *pmesh =
+               ParMesh::Distribute(MPI_COMM_WORLD, rank == root ? mesh : NULL,
+                                   root, rank == root ? partitioning : NULL);
+            delete [] partitioning;
+            delete mesh;
+
+            REQUIRE(pmesh->GetNE() == ref_pmesh.GetNE());
+            REQUIRE(pmesh->GetNBE() == ref_pmesh.GetNBE());
+            REQUIRE(pmesh->GetNV() == ref_pmesh.GetNV());
+            REQUIRE(pmesh->GetNSharedFaces() == ref_pmesh.GetNSharedFaces());
+            REQUIRE(pmesh->GetNGroups() == ref_pmesh.GetNGroups());
+            REQUIRE(pmesh->GetGlobalNE() == ref_pmesh.GetGlobalNE());
+            REQUIRE((pmesh->GetNodes() != NULL) == (bool) curved);
+            for (int i = 0; i < pmesh->GetNE(); i++)
+            {
+               REQUIRE(pmesh->GetAttribute(i) == ref_pmesh.GetAttribute(i));
+               Vector diff = ElementCenter(*pmesh, i);
+               diff -= ElementCenter(ref_pmesh, i);
+               REQUIRE(diff.Normlinf() < 1e-14);
+            }
+            delete pmesh;
+         }
+      }
+   }
+}
+
+#endif // MFEM_USE_MPI
+
+} // namespace mesh_partitioner
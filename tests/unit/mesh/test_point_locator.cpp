@@ -0,0 +1,202 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "catch.hpp"
+
+using namespace mfem;
+
+namespace point_locator
+{
+
+static double func(const Vector &x)
+{
+   double f = 1.0;
+   for (int d = 0; d < x.Size(); d++) { f += (d + 1)*x(d)*x(d) - x(d); }
+   return f;
+}
+
+static void vfunc(const Vector &x, Vector &v)
+{
+   for (int d = 0; d < v.Size(); d++) { v(d) = func(x) + d*x(d); }
+}
+
+// Map random reference points in random elements to physical points
+static void RandomPoints(Mesh &mesh, int npts, DenseMatrix &points,
+                         Array<int> &elems)
+{
+   const int sdim = mesh.SpaceDimension();
+   points.SetSize(sdim, npts);
+   elems.SetSize(npts);
+   srand(1234);
+   Vector x;
+   for (int k = 0; k < npts; k++)
+   {
+      elems[k] = rand() % mesh.GetNE();
+      IntegrationPoint ip;
+      const Geometry::Type geom = mesh.GetElementBaseGeometry(elems[k]);
+      const double r[3] = { rand()/(double)RAND_MAX, rand()/(double)RAND_MAX,
+                            rand()/(double)RAND_MAX
+                          };
+      ip.Set3(r[0], r[1], r[2]);
+      if (geom == Geometry::TRIANGLE) { ip.y *= 1.0 - ip.x; }
+      if (geom == Geometry::TETRAHEDRON)
+      {
+         ip.y *= 1.0 - ip.x;
+         ip.z *= 1.0 - ip.x - ip.y;
+      }
+      ElementTransformation *T = mesh.GetElementTransformation(elems[k]);
+      T->SetIntPoint(&ip);
+      x.SetDataAndSize(points.GetColumn(k), sdim);
+      T->Transform(ip, x);
+   }
+}
+
+static void TestPointLocator(Mesh &mesh)
+{
+   const int npts = 200;
+   const int sdim = mesh.SpaceDimension();
+   DenseMatrix points;
+   Array<int> elems;
+   RandomPoints(mesh, npts, points, elems);
+
+   PointLocator locator(mesh);
+   Array<int> elem_ids;
+   Array<IntegrationPoint> ips;
+   REQUIRE(locator.FindPoints(points, elem_ids, ips) == npts);
+
+   // The found points are mapped back to the given physical points
+   Vector x(sdim), y;
+   for (int k = 0; k < npts; k++)
+   {
+      REQUIRE(elem_ids[k] >= 0);
+      ElementTransformation *T = mesh.GetElementTransformation(elem_ids[k]);
+      T->SetIntPoint(&ips[k]);
+      T->Transform(ips[k], x);
+      points.GetColumnReference(k, y);
+      x -= y;
+      REQUIRE(x.Normlinf() < 1e-10);
+   }
+
+   // A point outside of the mesh is not found
+   DenseMatrix outside(sdim, 1);
+   outside = 10.0;
+   Array<int> outside_ids;
+   Array<IntegrationPoint> outside_ips;
+   REQUIRE(locator.FindPoints(outside, outside_ids, outside_ips) == 0);
+   REQUIRE(outside_ids[0] == -1);
+
+   // Mesh::FindPoints() gives the same elements and reference points
+   Array<int> mesh_elem_ids;
+   Array<IntegrationPoint> mesh_ips;
+   REQUIRE(mesh.FindPoints(points, mesh_elem_ids, mesh_ips) == npts);
+   REQUIRE(mesh_elem_ids.Size() == npts);
+   REQUIRE(mesh_ips.Size() == npts);
+   for (int k = 0; k < npts; k++)
+   {
+      CAPTURE(k);
+      REQUIRE(mesh_elem_ids[k] == elem_ids[k]);
+      REQUIRE(mesh_ips[k].x == Approx(ips[k].x));
+      REQUIRE(mesh_ips[k].y == Approx(ips[k].y));
+      REQUIRE(mesh_ips[k].z == Approx(ips[k].z));
+   }
+
+   // GetPointValues() matches the element-wise evaluation
+   const int order = 2, dim = mesh.Dimension();
+   H1_FECollection h1_fec(order, dim);
+   ND_FECollection nd_fec(order, dim);
+   FiniteElementSpace h1_fes(&mesh, &h1_fec);
+   FiniteElementSpace h1v_fes(&mesh, &h1_fec, sdim);
+   FiniteElementSpace nd_fes(&mesh, &nd_fec);
+   GridFunction u(&h1_fes), uv(&h1v_fes), und(&nd_fes);
+   FunctionCoefficient coeff(func);
+   VectorFunctionCoefficient vcoeff(sdim, vfunc);
+   u.ProjectCoefficient(coeff);
+   uv.ProjectCoefficient(vcoeff);
+   und.ProjectCoefficient(vcoeff);
+
+   GridFunction *gfs[3] = { &u, &uv, &und };
+   for (int g = 0; g < (dim == 1 ? 1 : 3); g++)
+   {
+      CAPTURE(g);
+      GridFunction &gf = *gfs[g];
+      DenseMatrix vals, vals2;
+      REQUIRE(gf.GetPointValues(points, vals2, &locator) == npts);
+      locator.FindPoints(points, elem_ids, ips);
+      gf.GetPointValues(elem_ids, ips, vals);
+      REQUIRE(vals.Height() == gf.VectorDim());
+      REQUIRE(vals.Width() == npts);
+      Vector val;
+      for (int k = 0; k < npts; k++)
+      {
+         ElementTransformation *T = mesh.GetElementTransformation(elem_ids[k]);
+         T->SetIntPoint(&ips[k]);
+         gf.GetVectorValue(*T, ips[k], val);
+         for (int d = 0; d < val.Size(); d++)
+         {
+            REQUIRE(std::abs(vals(d,k) - val(d)) < 1e-12);
+            REQUIRE(std::abs(vals2(d,k) - val(d)) < 1e-12);
+         }
+      }
+   }
+}
+
+TEST_CASE("PointLocator", "[Mesh]")
+{
+   for (int dim = 1; dim <= 3; dim++)
+   {
+      for (int type = 0; type <= 1; type++)
+      {
+         for (int curved = 0; curved <= 1; curved++)
+         {
+            CAPTURE(dim);
+            CAPTURE(type);
+            CAPTURE(curved);
+            Mesh *mesh;
+            if (dim == 1)
+            {
+               if (type == 1) { continue; }
+               mesh = new Mesh(10);
+            }
+            else if (dim == 2)
+            {
+               mesh = new Mesh(5, 6, type ? Element::TRIANGLE :
+                               Element::QUADRILATERAL, true);
+            }
+            else
+            {
+               mesh = new Mesh(3, 4, 3, type ? Element::TETRAHEDRON :
+                               Element::HEXAHEDRON, true);
+               if (type) { mesh->ReorientTetMesh(); }
+            }
+            if (curved)
+            {
+               // Perturb the nodes with a smooth displacement
+               mesh->SetCurvature(3);
+               GridFunction &nodes = *mesh->GetNodes();
+               const FiniteElementSpace *fes = nodes.FESpace();
+               for (int j = 0; j < fes->GetNDofs(); j++)
+               {
+                  const double x = nodes(fes->DofToVDof(j, 0));
+                  for (int d = 0; d < mesh->SpaceDimension(); d++)
+                  {
+                     nodes(fes->DofToVDof(j, d)) += 0.03*sin(3.0*x + d);
+                  }
+               }
+            }
+            TestPointLocator(*mesh);
+            delete mesh;
+         }
+      }
+   }
+}
+
+} // namespace point_locator